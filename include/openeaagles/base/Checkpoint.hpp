@@ -0,0 +1,109 @@
+
+#ifndef __oe_base_Checkpoint_H__
+#define __oe_base_Checkpoint_H__
+
+#include "openeaagles/base/Object.hpp"
+
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace oe {
+namespace base {
+
+//------------------------------------------------------------------------------
+// Class: Checkpoint
+//
+// Description: Compact binary snapshot of the dynamic state of a component tree
+//              (see Component::saveState() and Component::restoreState()).
+//
+//    The state is written, in order, with the put functions, and is read back,
+//    in the same order, by a Checkpoint::Reader.  Values are stored in their
+//    native (binary) format, so a checkpoint can only be read on the same
+//    platform.  A checkpoint can be written to and read from a stream.
+//
+//    Each component's state is written inside a section (see beginSection()
+//    and endSection()), which is prefixed with its length.  A section must be
+//    read to its end, otherwise endSection() fails the reader (i.e., the
+//    checkpoint doesn't match the reader's objects); skipSection() skips the
+//    rest of a section on purpose.
+//
+//    Once written, a checkpoint isn't changed by reading it, and each reader
+//    has its own read position, so a single checkpoint can be shared (it's
+//    ref()'d) and restored by any number of threads at the same time (e.g.,
+//    to branch a number of runs from one checkpoint).
+//------------------------------------------------------------------------------
+class Checkpoint : public Object
+{
+   DECLARE_SUBCLASS(Checkpoint, Object)
+
+public:
+   static const unsigned int FORMAT_VERSION = 1;
+
+   // ---
+   // Checkpoint reader
+   // ---
+   class Reader {
+   public:
+      explicit Reader(const Checkpoint* const cp);
+
+      // True if all reads have been valid
+      bool isOk() const                            { return ok; }
+
+      // True if we're at the end of the checkpoint or the current section
+      bool isEnd() const;
+
+      bool get(void* const data, const std::size_t n);
+      bool getDoubles(double* const data, const std::size_t n);
+      bool getString(std::string* const s);
+
+      template <class T> bool get(T* const v) {
+         static_assert(std::is_trivially_copyable<T>::value, "Checkpoint::Reader::get(): type is not trivially copyable");
+         return get(static_cast<void*>(v), sizeof(T));
+      }
+
+      bool beginSection();                         // Enters the next section
+      bool endSection();                           // Leaves the current section; fails if it wasn't read to its end
+      bool skipSection();                          // Skips the rest of the current section
+
+   private:
+      const std::vector<unsigned char>& buff;      // Checkpoint data
+      std::size_t pos {};                          // Read position
+      std::vector<std::size_t> ends;               // Ends of the open sections
+      bool ok {true};                              // All reads are valid
+   };
+
+public:
+   Checkpoint();
+
+   // Writes 'n' bytes of data
+   void put(const void* const data, const std::size_t n);
+   void putDoubles(const double* const data, const std::size_t n);
+   void putString(const char* const s);
+
+   template <class T> void put(const T& v) {
+      static_assert(std::is_trivially_copyable<T>::value, "Checkpoint::put(): type is not trivially copyable");
+      put(static_cast<const void*>(&v), sizeof(T));
+   }
+
+   void beginSection();                            // Starts a length prefixed section
+   void endSection();                              // Ends the current section
+
+   std::size_t getSize() const                     { return buff.size(); }
+   const unsigned char* getData() const            { return buff.data(); }
+   void clear();
+
+   // Write/read the checkpoint to/from a (binary) stream
+   bool write(std::ostream& sout) const;
+   bool read(std::istream& sin);
+
+private:
+   std::vector<unsigned char> buff;                // Checkpoint data
+   std::vector<std::size_t> starts;                // Starts of the open sections
+};
+
+}
+}
+
+#endif
@@ -3,8 +3,13 @@
 #define __oe_base_Component_H__
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/EventTable.hpp"
+#include "openeaagles/base/Checkpoint.hpp"
+#include "openeaagles/base/FrameProfiler.hpp"
 #include "openeaagles/base/safe_ptr.hpp"
 
+#include <atomic>
+
 namespace oe {
 namespace base {
 class Identifier;
@@ -36,6 +41,9 @@ class String;
 //
 //    printTimingStats     <Number>     ! Enable/disable the printing of the timing statistics (default: false)
 //
+//    profile              <Number>     ! Frame profiling of this component and its subtree: true(1) on, false(0) off
+//                                      ! (default: inherited from our container) (see FrameProfiler)
+//
 //    freeze               <Number>     ! Freeze flag: true(1)- frozen, false(0)- unfrozen; (default: false)
 //
 //    enableMessageType    <Identifier> ! Enable message type { WARNING, INFO, DEBUG, DATA, USER } (default: MSG_ERROR | MSG_WARNING)
@@ -66,13 +74,27 @@ class String;
 //          Time-Critical Frame -- This routine will be called by our container
 //          at a steady rate of 1/dt, where 'dt' is the  delta time in seconds
 //          between calls.  The component time statistics are computed by this
-//          function (see slots 'enableTimingStats' and 'printTimingStats').
+//          function (see slots 'enableTimingStats' and 'printTimingStats'), and the
+//          frame is recorded by the FrameProfiler, if we're being profiled (see
+//          slot 'profile').
 //
 //       updateData(double dt)
 //          Non-time-critical (i.e., background) update of the component, where
 //          'dt' is the delta time in seconds between calls.  Derived classes
 //          will provide updateData() routines, as needed.
 //
+//       dataFrame(double dt)
+//          Background Frame -- This routine is called by our container's
+//          updateData() to call our updateData().
+//
+//       bool isTcFrameDue(double* dt)
+//       bool isDataFrameDue(double* dt)
+//          Update rate control -- Called by tcFrame() and dataFrame() before
+//          calling updateTC() and updateData().  Derived classes that run at
+//          a reduced rate return false to skip a frame, or return true with
+//          'dt' set to the time since their last update.  The default is to
+//          run every frame.
+//
 //       bool isFrozen()
 //       freeze(bool flag)
 //          Gets/Sets our freeze flag.  When the freeze flag is set, delta time is
@@ -82,6 +104,15 @@ class String;
 //       reset()
 //          Sets this component to its initial conditions.
 //
+//       saveState(Checkpoint* cp)
+//       bool restoreState(Checkpoint::Reader* rd)
+//          Saves/restores the dynamic state of this component and its children
+//          to/from a checkpoint.  Our children's states are saved in order, and
+//          are restored into our children in the same order, so a checkpoint is
+//          restored into a reset() copy of the same configuration.  Derived
+//          classes that have dynamic state save it in their own checkpoint
+//          section, and restore it, before calling their base class function.
+//
 //       bool isShutdown()
 //          True if the component is shutting down or already shutdown. (e.g., received
 //          a SHUTDOWN_EVENT event).
@@ -140,6 +171,12 @@ class String;
 //          to the child component Pair.
 //             -- Component index number is one based
 //
+//       The results of findByName(), findByType() and findContainerByType() are
+//       cached by each component, and the caches are invalidated whenever the
+//       component tree changes anywhere (i.e., processComponents(), container(),
+//       reset() and deleted components).  Derived classes that change their
+//       component lists by other means should call componentTreeChanged().
+//
 //       Identifier* findNameOfComponent(Component* p)
 //          Returns a ref()'d pointer to an Identifier that contains the name of
 //          components 'p'; checking our children first then the grandchildren, etc.
@@ -181,8 +218,9 @@ class String;
 //
 //    The event() function can be implemented using the BEGIN_EVENT_HANDLER()
 //    and END_EVENT_HANDLER() macros.  Along with the macros ON_EVENT(), ON_EVENT_OBJ(),
-//    ON_ANYKEY() and ON_ANYKEY_OBJ(), these macros are used to build an event dispatch
-//    table.  Components will typically provide functions, "event handlers", that will
+//    ON_ANYKEY(), ON_ANYKEY_OBJ() and ON_ANYEVENT(), these macros are used to build an
+//    event dispatch table (see EventTable.hpp), which is indexed by event token.
+//    Components will typically provide functions, "event handlers", that will
 //    process the individual event tokens.
 //
 //          BEGIN_EVENT_HANDLER(Foo)
@@ -287,7 +325,7 @@ public:
    const Component* container() const                                        { return containerPtr; }
    Component* findContainerByType(const std::type_info& type);
    const Component* findContainerByType(const std::type_info& type) const;
-   Component* container(Component* const p)                                  { return (containerPtr = p); }
+   Component* container(Component* const p);
 
    unsigned int getNumberOfComponents() const;
 
@@ -314,12 +352,16 @@ public:
    virtual void updateTC(const double dt = 0.0);
    virtual void updateData(const double dt = 0.0);
    void tcFrame(const double dt = 0.0);
+   void dataFrame(const double dt = 0.0);
 
    virtual bool isFrozen() const;
    virtual bool isNotFrozen() const;
    virtual void freeze(const bool fflag);
    virtual void reset();
 
+   virtual void saveState(Checkpoint* const cp) const;
+   virtual bool restoreState(Checkpoint::Reader* const rd);
+
    bool isShutdown() const                                                   { return shutdown; }
    bool isNotShutdown() const                                                { return !shutdown; }
 
@@ -367,11 +409,19 @@ public:
    virtual bool setTimingStatsEnabled(const bool b);
    virtual bool setPrintTimingStats(const bool b);
 
+   // Frame profiling (see FrameProfiler); isProfiled() is true if our mode,
+   // or the mode inherited from our containers, is FrameProfiler::ON.
+   FrameProfiler::Mode getProfileMode() const;
+   virtual bool setProfileMode(const FrameProfiler::Mode mode);
+   bool isProfiled() const;
+   unsigned long long getProfileId() const                                   { return profileId; }
+
    // Slot functions
    virtual bool setSlotComponent(PairStream* const multiple);        // Sets the components list
    virtual bool setSlotComponent(Component* const single);           // Sets a single component
    virtual bool setSlotEnableTimingStats(const Number* const num);   // Sets the timing enabled flag
    virtual bool setSlotPrintTimingStats(const Number* const num);    // Sets the print timing stats flag
+   virtual bool setSlotProfile(const Number* const num);             // Sets the profile mode (on or off)
    virtual bool setSlotFreeze(const Number* const num);              // Sets the freeze flag
    virtual bool setSlotEnableMsgType(const Identifier* const msg);   // Enables message types by name
    virtual bool setSlotEnableMsgType(const Number* const msg);       // Enables message types by bit
@@ -381,6 +431,9 @@ public:
    virtual bool isMessageEnabled(const unsigned short msgType) const override;
 
 protected:
+   virtual bool isTcFrameDue(double* const dt);     // Run this time-critical frame? (default: true)
+   virtual bool isDataFrameDue(double* const dt);   // Run this background frame? (default: true)
+
    virtual void printTimingStats();         // Print statistics on component timing
    virtual bool shutdownNotification();     // We're shutting down
    virtual bool onEventReset();             // Reset event handler
@@ -403,7 +456,18 @@ protected:
          Component* const remove = nullptr   // Optional component to remove
       );
 
+   // Invalidates all of the components' find caches
+   static void componentTreeChanged();
+
 private:
+   class FindCache;
+   bool getCachedFind(const int kind, const char* const name, const std::type_info* const type, const unsigned int gen, const void** const result) const;
+   void putCachedFind(const int kind, const char* const name, const std::type_info* const type, const unsigned int gen, const void* const result) const;
+   const Pair* lookupByName(const char* const slotname) const;
+   const Pair* lookupByType(const std::type_info& type) const;
+
+   static std::atomic<unsigned int> treeVersion;   // Component tree version; changed when any tree changes
+
    safe_ptr<PairStream> components;    // Child components
    Component* containerPtr {};         // We are a component of this container
 
@@ -412,8 +476,14 @@ private:
 
    Statistic* timingStats {};          // Timing statistics
    bool pts {};                        // Print timing statistics
+   std::atomic<int> profileMode {FrameProfiler::INHERIT};   // Frame profile mode
+   mutable std::atomic<unsigned int> profileCache {};       // isProfiled() result; (tree version << 1) | profiled
+   unsigned long long profileId {FrameProfiler::newComponentId()};  // Profile ID; unique to this instance, never copied
    bool frz {};                        // Freeze flag -- true if this component is frozen
    bool shutdown {};                   // True if this component is being (or has been) shutdown
+
+   mutable FindCache* findCache {};    // Cache of our find results
+   mutable long findCacheLock {};      // Semaphore to protect 'findCache'
 };
 
 }
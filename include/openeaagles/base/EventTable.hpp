@@ -0,0 +1,117 @@
+#ifndef __oe_base_EventTable_H__
+#define __oe_base_EventTable_H__
+
+#include <atomic>
+#include <typeinfo>
+#include <vector>
+
+namespace oe {
+namespace base {
+class Component;
+class Object;
+
+//------------------------------------------------------------------------------
+// Class: EventTable
+// Description: Event dispatch table for a Component class (see Component.hpp)
+//
+// Event tables map event tokens to the class's "on event" handlers.  They're
+// usually defined using the macros BEGIN_EVENT_HANDLER, ON_EVENT, ON_EVENT_OBJ,
+// ON_ANYKEY, ON_ANYKEY_OBJ, ON_ANYEVENT and END_EVENT_HANDLER (see macros.hpp),
+// which build a single, static table per class the first time the class's
+// event() function is called.
+//
+// The handlers are added in the order of the macros, and for each token the
+// table keeps the list of handlers that can receive that token, in the same
+// order.  Dispatching an event is an index lookup, by token, into these lists,
+// and the handlers are called until one of them returns true.
+//
+// Handlers that require an argument of a given type, ObjType, check the
+// argument's type using isType<ObjType>(), which caches the last argument
+// type to pass the check, so that repeated events with the same argument
+// type do not need a dynamic_cast<>.
+//
+//------------------------------------------------------------------------------
+class EventTable
+{
+public:
+   // Event handler: calls the component's "on event" function
+   using Handler = bool (*)(Component* const, const int, Object* const);
+
+   // Argument type check (or zero if there's no argument)
+   using TypeCheck = bool (*)(Object* const);
+
+   // Builder function; adds the handlers to the table
+   using Builder = void (*)(EventTable* const);
+
+public:
+   explicit EventTable(Builder builder);
+   EventTable(const EventTable&) = delete;
+   EventTable& operator=(const EventTable&) = delete;
+   virtual ~EventTable() = default;
+
+   // Adds a handler for the event token, 'token'
+   void add(const int token, Handler handler, TypeCheck check);
+
+   // Adds a handler for all key events (see eventTokens.hpp)
+   void addAnyKey(Handler handler, TypeCheck check);
+
+   // Adds a handler for all events
+   void addAnyEvent(Handler handler, TypeCheck check);
+
+   // Dispatches the event, 'event', with the optional argument, 'obj', to
+   // component 'p' using this table; returns true if the event was used.
+   bool dispatch(Component* const p, const int event, Object* const obj) const {
+      const Range* r = (event <= maxKeyEvent ? &otherKeys : &otherEvents);
+      if (event >= minToken && event <= maxToken) r = &index[event - minToken];
+      return (r->n > 0 && dispatch(*r, p, event, obj));
+   }
+
+   // Returns true if 'obj' is of type ObjType (i.e., dynamic_cast<ObjType*>(obj) != nullptr)
+   template <class ObjType>
+   static bool isType(Object* const obj) {
+      static std::atomic<const std::type_info*> lastType {};
+      const std::type_info* const t = &typeid(*obj);
+      if (t == lastType.load(std::memory_order_relaxed)) return true;
+      const bool ok = (dynamic_cast<ObjType*>(obj) != nullptr);
+      if (ok) lastType.store(t, std::memory_order_relaxed);
+      return ok;
+   }
+
+private:
+   enum { TOKEN, ANY_KEY, ANY_EVENT };
+
+   struct Entry {
+      int kind {TOKEN};             // TOKEN, ANY_KEY or ANY_EVENT
+      int token {};                 // Event token (TOKEN only)
+      Handler handler {};           // "On event" handler
+      TypeCheck check {};           // Argument type check, or zero
+   };
+
+   struct Call {
+      Handler handler {};           // "On event" handler
+      TypeCheck check {};           // Argument type check, or zero
+   };
+
+   struct Range {
+      unsigned int first {};        // First index into 'calls'
+      unsigned int n {};            // Number of handlers
+   };
+
+   bool dispatch(const Range& r, Component* const p, const int event, Object* const obj) const;
+   void compile();
+   Range makeRange(const int token, const bool anyToken);
+
+   std::vector<Entry> entries;            // Handlers, in the order they were added
+   std::vector<Call> calls;               // Lists of handlers, by token
+   std::vector<Range> index;              // Handlers by token: [ minToken ... maxToken ]
+   Range otherKeys;                       // Handlers for key events that are not mapped
+   Range otherEvents;                     // Handlers for other events that are not mapped
+   int minToken {};                       // Smallest mapped token
+   int maxToken {-1};                     // Largest mapped token
+   int maxKeyEvent {};                    // Component::MAX_KEY_EVENT
+};
+
+}
+}
+
+#endif
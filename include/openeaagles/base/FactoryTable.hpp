@@ -0,0 +1,76 @@
+#ifndef __oe_base_FactoryTable_H__
+#define __oe_base_FactoryTable_H__
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace oe {
+namespace base {
+class Object;
+
+//------------------------------------------------------------------------------
+// Class: FactoryTable
+// Description: Hashed table of factory names and object creation functions,
+//              used by the library factory() functions (see factory.hpp).
+//
+// The table is usually a function level static in the library's factory(),
+// so it's built the first time factory() is called:
+//
+//    Object* factory(const std::string& name)
+//    {
+//       static const FactoryTable table {
+//          { Foo::getFactoryName(),  FactoryTable::make<Foo> },
+//          { Bar::getFactoryName(),  FactoryTable::make<Bar> },
+//       };
+//       return table.create(name);
+//    }
+//
+// The names are hashed into an open addressing table, so finding a name is
+// a single hash and (usually) one string compare.  If a name is in the list
+// more than once, then the first entry is used.
+//
+//------------------------------------------------------------------------------
+class FactoryTable
+{
+public:
+   // Object creation function; returns a new, default object
+   using Creator = Object* (*)();
+
+   struct Entry {
+      const char* name;             // Factory name
+      Creator create;               // Creation function
+   };
+
+   // Creation function for class T
+   template <class T>
+   static Object* make()            { return new T(); }
+
+public:
+   FactoryTable(std::initializer_list<Entry> entries);
+   FactoryTable(const FactoryTable&) = delete;
+   FactoryTable& operator=(const FactoryTable&) = delete;
+   virtual ~FactoryTable() = default;
+
+   // Returns a new object with factory name 'name', or zero if the
+   // name isn't in the table.
+   Object* create(const std::string& name) const;
+
+private:
+   struct Slot {
+      const char* name {};          // Factory name (or zero if empty)
+      std::size_t len {};           // Length of the name
+      Creator create {};            // Creation function
+   };
+
+   static std::size_t hash(const char* const s, const std::size_t len);
+
+   std::vector<Slot> slots;         // Hash table; size is a power of two
+   std::size_t mask {};             // slots.size() - 1
+};
+
+}
+}
+
+#endif
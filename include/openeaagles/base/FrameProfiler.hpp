@@ -0,0 +1,142 @@
+
+#ifndef __oe_base_FrameProfiler_H__
+#define __oe_base_FrameProfiler_H__
+
+#include <atomic>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace oe {
+namespace base {
+class Component;
+
+//------------------------------------------------------------------------------
+// Class: FrameProfiler
+//
+// Description: Hierarchical frame profiler for the component tree's time-critical
+//              (tcFrame()) and background (updateData()) processing.
+//
+//    Profiling is turned on and off by subtree: a component's profile mode
+//    (see Component::setProfileMode() and the 'profile' slot) is ON, OFF or
+//    INHERIT (default) from its container.  The profiler does nothing, beyond
+//    a single atomic load per frame, until at least one component is ON, and
+//    it can be disabled globally with setEnabled(false).
+//
+//    Each profiled frame is a Scope, which reads the processor's time stamp
+//    counter at the start and end of the frame.  Each thread records its scopes
+//    into its own call tree (per-node call count, total, self, max and per-phase
+//    times) and into its own ring buffer of the last RING_SIZE scopes.  A thread
+//    that starts in the middle of the component tree (e.g., a Simulation pool
+//    thread) places its scopes under the component's containers, so the threads'
+//    trees line up.
+//
+//    A thread's call tree nodes are keyed by their component's profile ID (see
+//    newComponentId()), which is never reused, so a new component at a deleted
+//    component's address gets its own nodes.  clear() drops all of the call
+//    tree nodes; each thread drops its nodes at the start of its next frame,
+//    when none of them are in use.
+//
+//    A thread's data is kept after the thread exits, so its scopes are still
+//    in the merged call tree and the trace, until the next clear(), which
+//    frees it.
+//
+//    The call trees of all threads are merged, by component name, by
+//    getCallTree() and printCallTree(), and the ring buffers can be exported in
+//    the Chrome trace event format (chrome://tracing) by writeChromeTrace().
+//
+//    The phase of each scope is set per thread by setPhase() (e.g., Simulation
+//    sets the phase before each of its four T/C phases).
+//------------------------------------------------------------------------------
+class FrameProfiler
+{
+   struct ThreadData;                              // Per thread call tree and ring buffer
+
+public:
+   // Component profile modes
+   enum Mode { INHERIT, ON, OFF };
+
+   static const unsigned int MAX_PHASES = 4;          // Number of phases
+   static const unsigned int RING_SIZE = 65536;       // Scopes per thread ring buffer
+
+   // Merged call tree node
+   struct Node {
+      std::string name;                               // Component name
+      unsigned int depth {};                          // Depth in the tree (roots are zero)
+      unsigned long long count {};                    // Number of calls
+      double totalTime {};                            // Total time (sec)
+      double selfTime {};                             // Total time less the time of the child scopes (sec)
+      double maxTime {};                              // Max time of a single call (sec)
+      double phaseTime[MAX_PHASES] {};                // Total time by phase (sec)
+   };
+
+   // Profiled frame; records the frame of component 'c', if it's being profiled,
+   // from construction to destruction.
+   class Scope {
+   public:
+      explicit Scope(const Component* const c)    { if (isActive()) begin(c); }
+      Scope(const Scope&) = delete;
+      Scope& operator=(const Scope&) = delete;
+      ~Scope()                                     { if (td != nullptr) end(); }
+
+   private:
+      void begin(const Component* const c);
+      void end();
+
+      ThreadData* td {};                           // Our thread's data (or zero if not recording)
+      unsigned int node {};                        // Our node in the thread's call tree
+      unsigned int prevNode {};                    // Thread's current node when we started
+      unsigned long long t0 {};                    // Start time (ticks)
+   };
+
+public:
+   FrameProfiler() = delete;
+
+   static bool isEnabled()                         { return enabled.load(std::memory_order_relaxed); }
+   static void setEnabled(const bool flg)          { enabled.store(flg, std::memory_order_relaxed); }
+
+   // True if enabled and at least one component's profile mode is ON
+   static bool isActive()                          { return (numOn.load(std::memory_order_relaxed) > 0 && isEnabled()); }
+
+   // Sets the calling thread's current phase [ 0 .. MAX_PHASES-1 ]
+   static void setPhase(const unsigned int phase);
+
+   // Merged call tree, in depth first order with each node's children in
+   // decreasing total time; returns the number of nodes.
+   static unsigned int getCallTree(std::vector<Node>* const tree);
+
+   // Prints the merged call tree; nodes with less than 'minTime' seconds total are not printed.
+   static void printCallTree(std::ostream& sout, const double minTime = 0.0);
+
+   // Writes the ring buffers in the Chrome trace event (JSON) format
+   static bool writeChromeTrace(std::ostream& sout);
+
+   // Clears all statistics, ring buffers and call tree nodes
+   static void clear();
+
+   // Time stamp counter frequency (ticks per second)
+   static double getTicksPerSecond();
+
+   // Used by Component to count the components with profile mode ON
+   static void addProfiledComponents(const int n)  { numOn.fetch_add(n, std::memory_order_relaxed); }
+
+   // Used by Component for its (unique, never zero) profile ID
+   static unsigned long long newComponentId()      { return nextId.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+   static ThreadData* getThreadData();             // Calling thread's data
+   static std::vector<std::shared_ptr<ThreadData>> getAllThreadData();
+
+   static std::atomic<bool> enabled;               // Global enable flag
+   static std::atomic<int> numOn;                  // Number of components with profile mode ON
+   static std::atomic<unsigned long long> nextId;  // Next component profile ID
+   static long threadsLock;                        // Semaphore for 'threads'
+   static std::vector<std::shared_ptr<ThreadData>> threads;  // All threads' data (including exited threads' until clear())
+   static unsigned int nextThreadIndex;            // Index of the next thread's data
+};
+
+}
+}
+
+#endif
@@ -315,7 +315,7 @@ class Object : public Referenced
 
    // slot table functions
    public: static const SlotTable& getSlotTable();
-   protected: virtual bool setSlotByIndex(const int slotindex, Object* const obj);
+   public: virtual bool setSlotByIndex(const int slotindex, Object* const obj);
    public: bool setSlotByName(const char* const slotname, Object* const obj);
    public: const char* slotIndex2Name(const int slotindex) const;
    public: int slotName2Index(const char* const slotname) const;
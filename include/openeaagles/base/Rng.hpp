@@ -3,6 +3,8 @@
 #define __oe_base_Rng_H__
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/Checkpoint.hpp"
+#include <atomic>
 #include <cmath>
 
 namespace oe {
@@ -65,7 +67,22 @@ class Number;
 //
 // Factory name: Rng
 // Slots:
-//    seed      <Number>  ! seed (default: 5489UL first instance only)
+//    seed      <Number>  ! seed; also sets the default seed of the streams
+//                        ! that haven't been seeded (default: 5489UL)
+//
+// Streams:
+//    All instances within a thread share the generator's state, its 'stream',
+//    and each thread draws from its own stream.  A base::Thread owns its
+//    stream, which its creator can seed with setRngSeed() before creating it
+//    (e.g., the Station's threads and the Simulation's thread pools, which
+//    use their creator's seed and their own index; see also
+//    simulation::BatchRunner).  Any other thread's stream is seeded on its
+//    first use with the default seed, setDefaultSeed(), and the order of its
+//    first use: the first such thread gets the plain default seed, and the
+//    others get indexes from 0x80000000 up, which the owners' indexes
+//    (see seedStream()) don't use.  getThreadStream() returns the calling thread's stream, so a
+//    thread's owner can save, restore or reseed it (e.g., in a checkpoint)
+//    while the thread is idle.
 //------------------------------------------------------------------------------
 class Rng : public Object
 {
@@ -226,6 +243,37 @@ public:
    //-----------------------------------------------------------------
    double drawErlang(const unsigned int m, const double a);
 
+   //----
+   // compile time constants
+   //----
+   static const int n = 624, m = 397;
+
+   //----
+   // generator state (see "Streams" above)
+   //----
+   struct Stream {
+      unsigned int state[n] {};  // state vector array
+      int p {n};                 // position in state array
+      bool init {};              // stream has been seeded
+      unsigned int seed {};      // seed
+   };
+
+   static Stream* getThreadStream();                      // calling thread's stream
+   static unsigned int getThreadSeed();                   // calling thread's seed (seeds its stream on first use)
+   static void setThreadStream(Stream* const s);          // draw from 's' (zero: the thread's own stream)
+   // seeds 's' with 'seed' (index zero) or with the array {seed, index}
+   static void seedStream(Stream* const s, const unsigned int seed, const unsigned int index);
+
+   static unsigned int getDefaultSeed();                  // default seed of the unseeded streams
+   static void setDefaultSeed(const unsigned int s);
+
+   //----
+   // save/restore a stream's generator state (see Checkpoint); default: the
+   // calling thread's stream
+   //----
+   static void saveState(Checkpoint* const cp, const Stream* const s = nullptr);
+   static bool restoreState(Checkpoint::Reader* const rd, Stream* const s = nullptr);
+
    //----
    // slot functions
    //----
@@ -234,20 +282,20 @@ public:
 private:
 
    //----
-   // compile time constants
+   // the calling thread's stream: its own, unless setThreadStream() was used
    //----
-   static const int n = 624, m = 397;
+   static Stream& stream();
+   static thread_local Stream ownStream;
+   static thread_local Stream* curStream;
 
-   //----
-   // the variables below are static (no duplicates can exist)
-   //----
-   static unsigned int state[n];   // state vector array
-   static int p;                    // position in state array
-   static bool init;
+   static std::atomic<unsigned int> defaultSeed;   // default seed of the unseeded streams
+   static std::atomic<unsigned int> nextIndex;     // index of the next stream seeded on first use
 
    //----
    // private functions used to generate the pseudo random numbers
    //----
+   static void initStream(Stream* const s);              // seeds 's' on first use
+   static void seedArray(Stream* const s, const unsigned int*, int size);
    unsigned int twiddle(unsigned int, unsigned int);     // used by gen_state()
    void gen_state();                                     // generate new state
 
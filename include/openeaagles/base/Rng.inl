@@ -260,14 +260,14 @@ inline double Rng::drawErlang(const unsigned int m, const double a)
 //----
 inline unsigned int Rng::drawInt32()
 { 
-   if (p == n) {
-      gen_state(); // new state vector needed
+   Stream& s = stream();
+   if (s.p == n) {
+      gen_state(); // new state vector needed (and seeds the stream on first use)
       // gen_state() is split off to be non-inline, because it is only called once
       // in every 624 calls and otherwise irand() would become too big to get inlined
-      p = 0; // reset position
    }
 
-   unsigned int x = state[p++];
+   unsigned int x = s.state[s.p++];
    x ^= (x >> 11);
    x ^= (x << 7) & 0x9D2C5680UL;
    x ^= (x << 15) & 0xEFC60000UL;
@@ -275,6 +275,15 @@ inline unsigned int Rng::drawInt32()
    return ( x ^ (x >> 18) );
 }
 
+//----
+// the calling thread's stream
+//----
+inline Rng::Stream& Rng::stream()
+{
+   Stream* const s = curStream;
+   return (s != nullptr ? *s : ownStream);
+}
+
 //----
 // inline for speed, must therefore reside in header file
 //----
@@ -2,6 +2,8 @@
 #ifndef __oe_base_SlotTable_H__
 #define __oe_base_SlotTable_H__
 
+#include <vector>
+
 namespace oe {
 namespace base {
 
@@ -21,6 +23,10 @@ namespace base {
 // Slot tables are usually defined using the macros BEGIN_SLOTTABLE and
 // END_SLOTTABLE (see macros.hpp).
 //
+// Each table hashes its own slot names when it's constructed, so index()
+// is a hash lookup in this table, and then in each base class table, in
+// turn, until the name is found.
+//
 //------------------------------------------------------------------------------
 class SlotTable
 {
@@ -43,9 +49,15 @@ public:
    const char* name(const unsigned int slotindex) const;
 
 private:
+   void buildHash();
+   unsigned int localIndex(const char* const slotname) const;
+
    SlotTable* baseTable {};   // Pointer to base class's slot table
    char** slots1 {};          // Array of slot names
    unsigned int nslots1 {};   // Number of slots in table
+
+   std::vector<unsigned int> hash;  // Hash of our slot names: local index + 1 (or zero if empty)
+   unsigned int hashMask {};        // hash.size() - 1
 };
 
 }
@@ -307,6 +307,7 @@ protected:
    virtual bool onEntry(Object* const msg = nullptr);
    virtual bool onReturn(Object* const msg = nullptr);
    virtual bool onExit();
+   virtual bool onStMachEvent(const int event, Object* const obj);
 
    // ---
    // State machine list functions
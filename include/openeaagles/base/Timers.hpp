@@ -3,6 +3,7 @@
 #define __oe_base_Timer_H__
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/Checkpoint.hpp"
 
 namespace oe {
 namespace base {
@@ -88,6 +89,10 @@ public:
     // Updates this timer.  Usually called by updateTimers().
     virtual void update(const double dt);
 
+    // Saves/restores the timer's state (see Checkpoint)
+    virtual void saveState(Checkpoint* const cp) const;
+    virtual bool restoreState(Checkpoint::Reader* const rd);
+
 protected:
     // Slot functions
     virtual bool setSlotTimerValue(const Time* const msg);    // Sets the timer value
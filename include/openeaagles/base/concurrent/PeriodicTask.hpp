@@ -18,11 +18,64 @@ class Component;
 //    work function, userFunc(), which is called at fixed rate of 'rate' Hz
 //    until the parent component is shutdown.  A value of 1.0/rate is passed
 //    to userFunc() as the delta time parameter.
+//
+// Frame scheduling:
+//
+//    Frames are scheduled on absolute deadlines, start time plus N frame
+//    periods, using a monotonic clock, so the frames don't drift and changes
+//    to the system's time of day don't affect the loop.
+//
+//    An overrun is a frame that ends after the start of the next frame; the
+//    overrun policy sets the next frame's deadline:
+//
+//       OVERRUN_CATCH_UP  -- (default*) the missed frames are run back-to-back,
+//                            without waiting, until the loop is back on schedule.
+//       OVERRUN_SKIP      -- the missed frames are skipped; the next frame starts
+//                            at the next deadline on the original schedule.
+//       OVERRUN_STRETCH   -- the overrun frame is stretched; the next frame starts
+//                            now and the schedule is shifted by the overrun.
+//
+//    With the variable delta time flag, the delta time passed to userFunc() is
+//    adjusted for skipped and stretched frames (i.e., the time since the start
+//    of the previous frame).
+//
+//    *) If the policy hasn't been set, it's OVERRUN_STRETCH when the variable
+//       delta time flag is set, which is the flag's original behavior: the
+//       overrun frame's delta time and the schedule are stretched by the overrun.
+//
+//    The spin time is a hybrid wait for better wake up accuracy: the thread
+//    sleeps until 'spin time' seconds before the deadline, and then spins
+//    until the deadline.  Zero (default) to only sleep.
+//
+// Frame statistics (see FrameStats):
+//
+//    Frame time is userFunc()'s run time; lateness is the time from a frame's
+//    deadline to the actual start of the frame (wake up latency, or the delay
+//    from a previous overrun).  The lateness histogram bins' upper limits are
+//    given by getLatenessBinLimit().
 //------------------------------------------------------------------------------
 class PeriodicTask : public Thread
 {
    DECLARE_SUBCLASS(PeriodicTask, Thread)
 
+public:
+   enum OverrunPolicy { OVERRUN_CATCH_UP, OVERRUN_SKIP, OVERRUN_STRETCH };
+
+   static const unsigned int NUM_LATENESS_BINS = 8;
+
+   // Snapshot of the frame statistics (seconds)
+   struct FrameStats {
+      unsigned int frames {};                   // Total frame count
+      unsigned int overruns {};                 // Number of overrun frames
+      unsigned int skipped {};                  // Number of skipped frames (OVERRUN_SKIP only)
+      double lastFrameTime {};                  // Last frame's run time
+      double avgFrameTime {};                   // Average frame run time
+      double maxFrameTime {};                   // Max frame run time
+      double avgLateness {};                    // Average frame start lateness
+      double maxLateness {};                    // Max frame start lateness
+      unsigned int lateness[NUM_LATENESS_BINS] {};  // Lateness histogram
+   };
+
 public:
    PeriodicTask(Component* const parent, const double priority, const double rate);
 
@@ -30,29 +83,58 @@ public:
    unsigned int getTotalFrameCount() const;        // Total frame count
 
    // Busted (overrun) frames statistics; overrun frames time (seconds)
-   // (Windows only)
    const Statistic& getBustedFrameStats() const;
 
-   // Variable delta time flag (windows only).
+   // Frame statistics; can be called from any thread
+   void getFrameStats(FrameStats* const stats) const;
+   void clearFrameStats();
+
+   // Upper limit (seconds) of lateness histogram bin 'bin'
+   static double getLatenessBinLimit(const unsigned int bin);
+
+   // Variable delta time flag.
    // If false (default), delta time is always passed as one over the update rate;
    // If true and there's a frame overrun then a delta time adjusted for the overrun
    // is used.
    bool isVariableDeltaTimeEnabled() const;
    bool setVariableDeltaTimeFlag(const bool enable);
 
+   // Overrun policy (default: OVERRUN_CATCH_UP, or OVERRUN_STRETCH with
+   // the variable delta time flag); set before the thread is created
+   OverrunPolicy getOverrunPolicy() const;
+   bool setOverrunPolicy(const OverrunPolicy policy);
+
+   // Spin time (seconds) before each deadline (default: 0, sleep only)
+   double getSpinTime() const;
+   bool setSpinTime(const double seconds);
+
    // User defined work function
    private: virtual unsigned long userFunc(const double dt) =0;
 
 protected:
    PeriodicTask();
 
+   // Adds a frame to the frame statistics
+   void frameStats(const double frameTime, const double lateness, const double overrun, const unsigned int skipped);
+
 private:
    virtual unsigned long mainThreadFunc() override;
 
    double rate {};         // Loop rate (hz); until our parent shuts down
-   Statistic bfStats {};   // Busted (overrun) frame statistics (windows only)
+   Statistic bfStats {};   // Busted (overrun) frame statistics
    unsigned int tcnt {};   // total frame count
    bool vdtFlg {};         // Variable delta time flag
+   OverrunPolicy policy {OVERRUN_CATCH_UP};  // Overrun policy
+   bool policySet {};      // Overrun policy has been set
+   double spinTime {};     // Spin time before each deadline (sec)
+
+   // Frame statistics
+   Statistic ftStats {};   // Frame run time statistics
+   Statistic ltStats {};   // Frame start lateness statistics
+   unsigned int ocnt {};   // Overrun frame count
+   unsigned int scnt {};   // Skipped frame count
+   unsigned int lateness[NUM_LATENESS_BINS] {};  // Lateness histogram
+   mutable long statsLock {};  // Semaphore to protect the frame statistics
 };
 
 }
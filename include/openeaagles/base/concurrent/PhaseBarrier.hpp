@@ -0,0 +1,90 @@
+
+#ifndef __oe_base_PhaseBarrier_H__
+#define __oe_base_PhaseBarrier_H__
+
+#include <atomic>
+
+namespace oe {
+namespace base {
+
+//------------------------------------------------------------------------------
+// Class: PhaseBarrier
+//
+// Description: Reusable start/complete barrier between one coordinator thread
+//              and a fixed pool of worker threads.
+//
+//    The coordinator calls start() to release all of the workers into the
+//    next phase, and then waitForCompleted() to wait until each worker has
+//    called completed().  Workers call waitForStart() with the last phase that
+//    they've seen, which returns the new phase.
+//
+//    A phase costs one atomic increment to start and one atomic decrement per
+//    worker to complete; there are no per-worker signals.  Waiting threads
+//    spin for 'spinCount' iterations before going to sleep in the kernel
+//    (futex on Linux), and the kernel wake up is only called when there is a
+//    sleeping waiter.  On single processor systems the default spin count
+//    is zero.
+//
+//    The number of workers can only be changed between phases (i.e., not
+//    while the workers are running).
+//
+// Example:
+//
+//    Coordinator:                       Worker:
+//       barrier.start();                   unsigned int ph = barrier.getPhase();
+//       ... our share of the work ...      while (...) {
+//       barrier.waitForCompleted();           ph = barrier.waitForStart(ph);
+//                                             ... work ...
+//                                             barrier.completed();
+//                                          }
+//------------------------------------------------------------------------------
+class PhaseBarrier
+{
+public:
+   static const unsigned int DEFAULT_SPIN_COUNT = 4000;
+
+public:
+   explicit PhaseBarrier(const unsigned int numWorkers = 0);
+   PhaseBarrier(const PhaseBarrier&) = delete;
+   PhaseBarrier& operator=(const PhaseBarrier&) = delete;
+   ~PhaseBarrier() = default;
+
+   unsigned int getNumWorkers() const     { return numWorkers; }
+   void setNumWorkers(const unsigned int n);
+
+   unsigned int getSpinCount() const      { return spinCount; }
+   void setSpinCount(const unsigned int n);
+
+   // Current phase
+   unsigned int getPhase() const;
+
+   // Coordinator: release the workers into the next phase
+   void start();
+
+   // Coordinator: wait for all workers to complete the current phase
+   void waitForCompleted();
+
+   // Worker: wait for the phase to change from 'phase'; returns the new phase
+   unsigned int waitForStart(const unsigned int phase);
+
+   // Worker: this worker has completed the current phase
+   void completed();
+
+private:
+   // Implementation dependent
+   static void waitOn(std::atomic<int>* const addr, const int value);   // Sleep while *addr == value
+   static void wakeAll(std::atomic<int>* const addr);                   // Wake all sleepers on addr
+   static void pause();                                                 // Spin loop hint
+
+   std::atomic<int> phase {};          // Phase counter
+   std::atomic<int> pending {};        // Number of workers that have not completed the phase
+   std::atomic<int> startWaiters {};   // Number of workers sleeping on 'phase'
+   std::atomic<int> doneWaiters {};    // Number of coordinators sleeping on 'pending'
+   unsigned int numWorkers {};         // Number of workers
+   unsigned int spinCount {};          // Spin iterations before sleeping
+};
+
+}
+}
+
+#endif
@@ -7,6 +7,7 @@
 namespace oe {
 namespace base {
 class Component;
+class PhaseBarrier;
 
 //------------------------------------------------------------------------------
 // Class: SyncTask
@@ -20,6 +21,12 @@ class Component;
 //    'completed' signal, or use the static function waitForAllCompleted() to
 //    wait for several sync task threads.  Loop will end with the shutdown of
 //    the parent.
+//
+//    A pool of sync tasks can instead share a PhaseBarrier (see setBarrier()),
+//    which must be set before the thread is created.  The tasks then wait for
+//    the barrier's start() in place of their own 'start' signal, and report
+//    to the barrier's completed() in place of their own 'completed' signal,
+//    so the parent releases and waits for the whole pool once per phase.
 //------------------------------------------------------------------------------
 class SyncTask : public Thread
 {
@@ -35,6 +42,11 @@ public:
    //Returns the index of the first thread that is completed, or -1 if an error
    static int waitForAnyCompleted(SyncTask** threads, const unsigned int num);
 
+   // Shared start/completed barrier (or zero to use our own signals);
+   // must be set before the thread is created.
+   PhaseBarrier* getBarrier() const                { return barrier; }
+   bool setBarrier(PhaseBarrier* const b);
+
    virtual bool terminate() override;
 
    // User defined work function
@@ -57,6 +69,9 @@ private:
    // Implementation dependent
    void* startSig {};      // Start signal
    void* completedSig {};  // completed signal
+
+   PhaseBarrier* barrier {};     // Shared start/completed barrier (not owned)
+   unsigned int barrierPhase {}; // Last barrier phase that we've started
 };
 
 }
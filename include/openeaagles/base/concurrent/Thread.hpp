@@ -19,8 +19,11 @@
 #define __oe_base_Thread_H__
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/Rng.hpp"
 #include "openeaagles/base/util/platform_api.hpp"
 
+#include <vector>
+
 namespace oe {
 namespace base {
 class Component;
@@ -83,6 +86,24 @@ class Component;
 //          ( 0.0, 0.1 )               (-5)
 //              0.0           THREAD_PRIORITY_IDLE(-15)
 //
+//
+// CPU affinity:
+//
+//    The thread can be restricted to a set of processors using setCpuAffinity()
+//    before the thread is created.  An empty set (default) lets the thread run
+//    on any of the processors assigned to the process.  Use getCpuNode() to
+//    find the NUMA node of a processor.  Processors that aren't online (see
+//    getNumOnlineCpus()) are ignored, and if the affinity can't be set, then
+//    a warning is reported and the thread runs on any processor.
+//
+//
+// Random numbers:
+//
+//    The thread owns the random number stream that its child thread draws
+//    from (see Rng).  Its creator can seed the stream using setRngSeed(),
+//    before the thread is created or while the thread is idle; an unseeded
+//    stream is seeded on its first use.
+//
 //------------------------------------------------------------------------------
 class Thread : public Object
 {
@@ -107,9 +128,29 @@ public:
    // -- set before creating the thread --
    bool setStackSize(const size_t size);
 
+   // Processors (by index) that the thread can run on (empty if any processor)
+   const std::vector<unsigned int>& getCpuAffinity() const;
+
+   // Set the processors that the thread can run on (or an empty set for any)
+   // -- set before creating the thread --
+   bool setCpuAffinity(const std::vector<unsigned int>& cpus);
+
    // number of processors assigned to this process
    static unsigned short getNumProcessors();
 
+   // number of processors that are online; valid processor indexes are less than this
+   static unsigned int getNumOnlineCpus();
+
+   // NUMA node of processor 'cpu' (zero if unknown or not a NUMA system)
+   static unsigned int getCpuNode(const unsigned int cpu);
+
+   // The child thread's random number stream
+   Rng::Stream* getRngStream();
+
+   // Seed the child thread's random number stream (see Rng::seedStream())
+   // -- set before creating the thread, or while the thread is idle --
+   bool setRngSeed(const unsigned int seed, const unsigned int index);
+
 protected: // Functions
    Thread();
    Component* getParent();
@@ -138,6 +179,8 @@ private: // Data
    double priority {};     // Thread priority (0->lowest, 1->highest)
    bool killed {};         // Are we terminated?
    size_t stackSize {};    // Stack size in bytes (zero to use the system default stack size)
+   std::vector<unsigned int> cpuAffinity;  // Processors that we can run on (empty for any)
+   Rng::Stream rngStream;  // Child thread's random number stream
 
    // Implementation dependent
    void* theThread {};     // Thread handle
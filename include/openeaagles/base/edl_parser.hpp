@@ -3,11 +3,13 @@
 #define __oe_base_edl_parser_H__
 
 #include <string>
+#include <vector>
 
 namespace oe {
 namespace base {
 
 class Object;
+class PairStream;
 
 //
 // factory function signature (e.g., factory(const std::string& name); )
@@ -21,6 +23,47 @@ typedef Object* (*factory_func)(const std::string& name);
 //
 extern Object* edl_parser(const std::string& filename, factory_func f, unsigned int* num_errors = nullptr);
 
+//
+// edl_parser( list of text filenames to parse, user supplied factory function to create objects,
+//             pointer to variable for the total num of errors found, max number of parser threads )
+//
+// -- the files are independent of each other and are parsed in parallel; the
+//    results are returned in a PairStream in the same order as the list of
+//    files.  Results that are named slots (i.e., "name: ( ... )") keep their
+//    names, and all others are named by their position in the list ("__merged_1",
+//    "__merged_2", ...), with a "_N" suffix, if needed, so they don't match a kept name
+// -- both parsers are reentrant, but the factory function, and the objects'
+//    constructors and slot functions, must be safe to call from several threads
+//    when using more than one thread.
+//
+extern PairStream* edl_parser(const std::vector<std::string>& filenames, factory_func f,
+                              unsigned int* num_errors = nullptr, const unsigned int num_threads = 1);
+
+//
+// edl_compile( text filename to parse, snapshot filename to write, user supplied factory function,
+//              pointer to variable for num of errors found )
+//
+// -- compiles the EDL file into a binary snapshot: the parse tree with the
+//    objects' slot names resolved to slot index numbers.  Returns true if the
+//    snapshot was written; it's not written if there were any errors.
+//
+extern bool edl_compile(const std::string& filename, const std::string& snapshot, factory_func f,
+                        unsigned int* num_errors = nullptr);
+
+//
+// edl_load( text filename, snapshot filename, user supplied factory function,
+//           pointer to variable for num of errors found, update a stale snapshot? )
+//
+// -- constructs the objects from the snapshot, without scanning, parsing or
+//    slot name lookups, if the snapshot was compiled from the current EDL file
+//    (size and hash) and the classes' slot tables haven't changed.  Otherwise
+//    the EDL file is parsed, and if 'update' is true and there were no errors,
+//    then the snapshot is recompiled.  If the EDL file is missing then the
+//    snapshot is used as is.
+//
+extern Object* edl_load(const std::string& filename, const std::string& snapshot, factory_func f,
+                        unsigned int* num_errors = nullptr, const bool update = true);
+
 }
 }
 
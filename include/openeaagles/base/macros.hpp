@@ -76,8 +76,11 @@
 //
 //    BEGIN_EVENT_HANDLER(ThisType) and END_EVENT_HANDLER() 
 //       These macros, along with the ON_EVENT() and ON_ANYKEY() macros
-//       below, implement an event dispatch table, which is actually the
-//       event() function for class 'ThisType'.
+//       below, implement an event dispatch table (see EventTable.hpp) and
+//       the event() function for class 'ThisType'.  The table is built the
+//       first time event() is called, and is indexed by event token, so only
+//       the handlers mapped to the token are checked.  Only the ON_xxx()
+//       macros can be used between these two macros.
 //
 //       Typically "on event" functions are used to process the events.  The
 //       "on event" function will return a true if the event is processed or
@@ -100,6 +103,10 @@
 //       Maps any event token with an argument of type 'ObjType' to the "on event"
 //       member function, 'onEvent'.
 //
+//    ON_ANYEVENT(onEvent)
+//       Maps all events, key or not, with any (or no) argument to the "on event"
+//       member function, 'onEvent', which is passed the token and the argument.
+//
 //
 // StateMachine class macros:
 //
@@ -351,37 +358,57 @@
 #define BEGIN_EVENT_HANDLER(ThisType)                                                  \
     bool ThisType::event(const int _event, ::oe::base::Object* const _obj)             \
     {                                                                                  \
-        bool _used {};
+        using _EvtThis = ThisType;                                                     \
+        static const ::oe::base::EventTable _evtTable(                                 \
+            [](::oe::base::EventTable* const _tbl) {
 
 
 #define END_EVENT_HANDLER()                                                            \
+            } );                                                                       \
+        bool _used = _evtTable.dispatch(static_cast<_EvtThis*>(this), _event, _obj);  \
         if (!_used) _used = BaseClass::event(_event,_obj);                             \
         return _used;                                                                  \
     }
 
 
 #define ON_EVENT_OBJ(token,onEvent,ObjType)                                            \
-    if (!_used && token == _event && dynamic_cast<ObjType*>(_obj) != nullptr) {        \
-        _used = onEvent(static_cast<ObjType*>(_obj));                                  \
-    }
+    _tbl->add(token,                                                                   \
+        [](::oe::base::Component* const _c, const int, ::oe::base::Object* const _o) -> bool { \
+            return static_cast<_EvtThis*>(_c)->onEvent(static_cast<ObjType*>(_o));    \
+        },                                                                             \
+        &::oe::base::EventTable::isType<ObjType> );
 
 
 #define ON_EVENT(token,onEvent)                                                        \
-    if (!_used && token == _event) {                                                   \
-        _used = onEvent();                                                             \
-    }
+    _tbl->add(token,                                                                   \
+        [](::oe::base::Component* const _c, const int, ::oe::base::Object* const) -> bool { \
+            return static_cast<_EvtThis*>(_c)->onEvent();                              \
+        },                                                                             \
+        nullptr );
 
 
-#define ON_ANYKEY_OBJ(onEvent,ObjType)                                                       \
-    if (!_used && _event <= MAX_KEY_EVENT && dynamic_cast<ObjType*>(_obj) != nullptr) {      \
-        _used = onEvent(_event,(static_cast<ObjType*>(_obj)));                               \
-    }
+#define ON_ANYKEY_OBJ(onEvent,ObjType)                                                 \
+    _tbl->addAnyKey(                                                                   \
+        [](::oe::base::Component* const _c, const int _e, ::oe::base::Object* const _o) -> bool { \
+            return static_cast<_EvtThis*>(_c)->onEvent(_e,static_cast<ObjType*>(_o));    \
+        },                                                                             \
+        &::oe::base::EventTable::isType<ObjType> );
 
 
 #define ON_ANYKEY(onEvent)                                                             \
-    if (!_used && _event <= MAX_KEY_EVENT) {                                           \
-        _used = onEvent(_event);                                                       \
-    }
+    _tbl->addAnyKey(                                                                   \
+        [](::oe::base::Component* const _c, const int _e, ::oe::base::Object* const) -> bool { \
+            return static_cast<_EvtThis*>(_c)->onEvent(_e);                            \
+        },                                                                             \
+        nullptr );
+
+
+#define ON_ANYEVENT(onEvent)                                                           \
+    _tbl->addAnyEvent(                                                                 \
+        [](::oe::base::Component* const _c, const int _e, ::oe::base::Object* const _o) -> bool { \
+            return static_cast<_EvtThis*>(_c)->onEvent(_e,_o);                         \
+        },                                                                             \
+        nullptr );
 
 
 #define BEGIN_STATE_TABLE(ThisType)                                        \
@@ -0,0 +1,120 @@
+
+#ifndef __oe_base_mpsc_queue_H__
+#define __oe_base_mpsc_queue_H__
+
+#include <atomic>
+
+namespace oe {
+namespace base {
+
+//------------------------------------------------------------------------------
+// Template: mpsc_queue<T>
+//
+// Description: Lock-free, multiple producer, single consumer queue of items of
+//              type T
+//
+//    A fixed size ring of cells, each with a sequence number that tells the
+//    producers and the consumer whose turn it is to use the cell.  Producers
+//    claim a cell with an atomic compare and swap of the 'in' index, so any
+//    number of threads can put() at the same time without a semaphore, and a
+//    producer is never blocked by the consumer.  Only one thread at a time may
+//    get() items.
+//
+// Notes:
+//    1) Use the constructor's 'qsize' parameter to set the max size of the
+//       queue; it's rounded up to a power of two.
+//    2) Use put() to add items and get() to remove items; put() returns false
+//       if the queue is full, and get() returns zero if the queue is empty.
+//    3) isEmpty(), isNotEmpty() and entries() are for the consumer thread, and
+//       are only a snapshot while other threads are putting items on the queue.
+//
+// Examples:
+//    base::mpsc_queue<int>* q1 = new base::mpsc_queue<int>(100); // queue size 128 items
+//    q1->put(1);           // puts 1 on the queue (from any thread)
+//    q1->put(2);           // puts 2 on the queue (from any thread)
+//    int i = q1->get();    // i is equal to 1
+//    int j = q1->get();    // j is equal to 2
+//------------------------------------------------------------------------------
+template <class T> class mpsc_queue
+{
+public:
+   mpsc_queue(const unsigned int qsize) : SIZE(roundUp(qsize))   { init(); }
+   mpsc_queue(const mpsc_queue<T>& q1) : SIZE(q1.SIZE)            { init(); }
+   ~mpsc_queue()                                                  { delete[] cells; }
+
+   bool isEmpty() const           { return (entries() == 0); }
+   bool isNotEmpty() const        { return (entries() != 0); }
+   unsigned int entries() const   { return (in.load(std::memory_order_acquire) - out); }
+   unsigned int size() const      { return SIZE; }
+
+   // Puts an item at the back of the queue; returns false if the queue is full
+   bool put(T item) {
+      unsigned int pos = in.load(std::memory_order_relaxed);
+      for (;;) {
+         Cell& cell = cells[pos & (SIZE - 1)];
+         const unsigned int seq = cell.seq.load(std::memory_order_acquire);
+         const int dif = static_cast<int>(seq - pos);
+         if (dif == 0) {
+            // Our turn: claim the cell
+            if (in.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+               cell.item = item;
+               cell.seq.store(pos + 1, std::memory_order_release);
+               return true;
+            }
+         }
+         else if (dif < 0) {
+            // Full: the consumer hasn't emptied this cell yet
+            return false;
+         }
+         else {
+            // Another producer claimed the cell
+            pos = in.load(std::memory_order_relaxed);
+         }
+      }
+   }
+
+   // Gets an item from the front of the queue (consumer thread only)
+   T get() {
+      T p = 0;
+      Cell& cell = cells[out & (SIZE - 1)];
+      const unsigned int seq = cell.seq.load(std::memory_order_acquire);
+      if (static_cast<int>(seq - (out + 1)) == 0) {
+         p = cell.item;
+         cell.item = 0;
+         cell.seq.store(out + SIZE, std::memory_order_release);
+         out++;
+      }
+      return p;
+   }
+
+private:
+   struct Cell {
+      std::atomic<unsigned int> seq;
+      T item;
+   };
+
+   static unsigned int roundUp(const unsigned int n) {
+      unsigned int s = 2;
+      while (s < n) s <<= 1;
+      return s;
+   }
+
+   void init() {
+      cells = new Cell[SIZE];
+      for (unsigned int i = 0; i < SIZE; i++) {
+         cells[i].seq.store(i, std::memory_order_relaxed);
+         cells[i].item = 0;
+      }
+   }
+
+   mpsc_queue<T>& operator=(mpsc_queue<T>&) { return *this; }
+   Cell* cells {};                     // The queue's cells
+   const unsigned int SIZE {};         // Max size of the queue (power of two)
+   std::atomic<unsigned int> in {};    // In (put) index
+   unsigned int out {};                // Out (get) index; consumer only
+};
+
+}
+}
+
+#endif
@@ -167,6 +167,10 @@ void sqrtArray(const float*  const src, float*  const dst, const unsigned int n)
 void pow10Array(const double* const src, double* const dst, const unsigned int n);
 void pow10Array(const float*  const src, float*  const dst, const unsigned int n);
 
+// Computes the base 10 logarithms of 'n' src values and returns the results in 'dst'
+void log10Array(const double* const src, double* const dst, const unsigned int n);
+void log10Array(const float*  const src, float*  const dst, const unsigned int n);
+
 // Multiply an array of reals with a constant
 void multArrayConst(const double* const src, const double c, double* const dst, const unsigned int n);
 void multArrayConst(const float* const src, const float c, double* const dst, const unsigned int n);
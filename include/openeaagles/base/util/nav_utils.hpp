@@ -655,6 +655,113 @@ const double ellipseBsq  = ellipseB * ellipseB;
       );
 
 
+//==============================================================================
+// Batched (array) conversion functions
+//
+//    Convert 'n' sets of values in one call, using the array functions in
+//    math_utils.hpp (e.g., sinCosArray(), atan2Array()).  Same results as the
+//    single set versions, except convertEcef2GeodArray(), which uses a closed
+//    form method (see nav_utils.cpp) that's more accurate than the iterative
+//    convertEcef2Geod().  Also see aer2xyzArray().
+//==============================================================================
+
+   //------------------------------------------------------------------------------
+   // Flat-earth Brg/Dist to Lat/Lon, with Earth model, from a single starting
+   // (ref) point (see fbd2llE())
+   //------------------------------------------------------------------------------
+   bool fbd2llEArray(
+         const double slat,                 // IN:  Starting (reference) latitude (degs)
+         const double slon,                 // IN:  Starting (reference) longitude (degs)
+         const double* const brng,          // IN:  True bearing array (degs)
+         const double* const dist,          // IN:  Distance (ground range) array (nm)
+         double* const dlat,                // OUT: Destination latitude array (degs)
+         double* const dlon,                // OUT: Destination longitude array (degs)
+         const unsigned int n,              // IN:  Number of sets to convert
+         const EarthModel* const em=nullptr // IN:  Pointer to an optional earth model (default: WGS-84)
+      );
+
+   //------------------------------------------------------------------------------
+   // Flat-earth Lat/Lon to Brg/Dist, with Earth model, from a single starting
+   // (ref) point (see fll2bdE())
+   //------------------------------------------------------------------------------
+   bool fll2bdEArray(
+         const double slat,                 // IN:  Starting (reference) latitude (degs)
+         const double slon,                 // IN:  Starting (reference) longitude (degs)
+         const double* const dlat,          // IN:  Destination latitude array (degs)
+         const double* const dlon,          // IN:  Destination longitude array (degs)
+         double* const brng,                // OUT: True bearing array (degs)
+         double* const dist,                // OUT: Distance (ground range) array (nm)
+         const unsigned int n,              // IN:  Number of sets to convert
+         const EarthModel* const em=nullptr // IN:  Pointer to an optional earth model (default: WGS-84)
+      );
+
+   //------------------------------------------------------------------------------
+   // Convert 'n' sets of X, Y, Z values to Azimuth, Elevation and Range (xyz2aerArray)
+   //------------------------------------------------------------------------------
+
+   // Computing NED angles
+   bool xyz2aerArray(
+         Vec3d* const aer,            // OUT: position vector array (aer)   [deg,deg,meters]
+         const Vec3d* const pos,      // IN:  position vector array (NED, player centered)  [meters]
+         const unsigned int n         // IN:  number of sets to convert
+      );
+
+   // Computing body angles
+   bool xyz2aerArray(
+         Vec3d* const aer,            // OUT: position vector array (aer)   [deg,deg,meters]
+         const Matrixd& rm,           // IN:  NED to body rotational matrix (see computeRotationalMatrix())
+         const Vec3d* const pos,      // IN:  position vector array (NED, player centered)  [meters]
+         const unsigned int n         // IN:  number of sets to convert
+      );
+
+   //------------------------------------------------------------------------------
+   // Compute 'n' World transformation Matrices from lat/lon (see computeWorldMatrix())
+   //------------------------------------------------------------------------------
+   bool computeWorldMatrixArray(
+         const double* const latD,    // IN:  Reference latitude array (degs)
+         const double* const lonD,    // IN:  Reference longitude array (degs)
+         Matrixd* const m,            // OUT: Matrix array
+         const unsigned int n         // IN:  Number of matrices
+      );
+
+   //----------------------------------------------------------
+   // 'n' LLAs to NED position vectors from a single reference point using
+   // a flat earth projection with an optional earth model (default: WGS-84)
+   //----------------------------------------------------------
+   bool convertLL2PosVecEArray(
+         const double slat,                 // IN:  Reference latitude (degs)
+         const double slon,                 // IN:  Reference longitude (degs)
+         const double sinSlat,              // IN:  Sine of ref latitude
+         const double cosSlat,              // IN:  Cosine of ref latitude
+         const double* const lat,           // IN:  Latitude array (degs)
+         const double* const lon,           // IN:  Longitude array (degs)
+         const double* const alt,           // IN:  Altitude array (meters)
+         Vec3d* const pos,                  // OUT: NED position vector array from ref point (Meters)
+         const unsigned int n,              // IN:  Number of sets to convert
+         const EarthModel* const em=nullptr // IN:  Pointer to an optional earth model (default: WGS-84)
+      );
+
+   //----------------------------------------------------------
+   // Convert 'n' ECEF (XYZ coordinates) to Geodetic (LLA coordinates)
+   //----------------------------------------------------------
+   bool convertEcef2GeodArray(
+         const Vec3d* const ecef,           // IN:  ECEF [ IX IY IZ ] array
+         Vec3d* const lla,                  // OUT: Geodetic [ ILAT ILON IALT ] array
+         const unsigned int n,              // IN:  Number of sets to convert
+         const EarthModel* const em=nullptr // IN:  Pointer to an optional earth model (default: WGS-84)
+      );
+
+   //----------------------------------------------------------
+   // Convert 'n' Geodetic (LLA coordinates) to ECEF (XYZ coordinates)
+   //----------------------------------------------------------
+   bool convertGeod2EcefArray(
+         const Vec3d* const lla,            // IN:  Geodetic [ ILAT ILON IALT ] array
+         Vec3d* const ecef,                 // OUT: ECEF [ IX IY IZ ] array
+         const unsigned int n,              // IN:  Number of sets to convert
+         const EarthModel* const em=nullptr // IN:  Pointer to an optional earth model (default: WGS-84)
+      );
+
+
 //==============================================================================
 // Euler angle conversion functions
 //    Body/NED <==> Body/ECEF
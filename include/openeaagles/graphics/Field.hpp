@@ -120,6 +120,9 @@ namespace graphics {
 //  advanceSpace(int ns = 1)
 //      Advance one space if in input mode.
 //
+//  onInputKey(int event)
+//      Handles the key events, 'event', while in input mode.
+//
 //  onForwardSpace()
 //      Calls advanceSpace() and returns true.
 //
@@ -233,6 +236,7 @@ public:
 
    virtual void backSpace(const int ns = 1);
    virtual void advanceSpace(const int ns = 1);
+   virtual bool onInputKey(const int event);
    virtual bool onForwardSpace();
    virtual bool onBackSpace();
 
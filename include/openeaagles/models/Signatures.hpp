@@ -4,9 +4,11 @@
 
 #include "openeaagles/base/Component.hpp"
 #include "openeaagles/base/util/constants.hpp"
+#include <memory>
+#include <vector>
 
 namespace oe {
-namespace base { class Number; class Table2; }
+namespace base { class Angle; class Number; class Table2; }
 namespace models {
 class Emission;
 
@@ -16,6 +18,11 @@ class Emission;
 // Public member functions:
 //      double getRCS(Emission* em)
 //          Computes the Radar Cross Section for the emission
+//
+//      void getRCSArray(az[], el[], freq[], rcs[], n)
+//          Computes the Radar Cross Sections for 'n' aspect angles of
+//          arrival, az[] and el[] (radians), and frequencies, freq[] (hz).
+//          The default implementation calls getRCS() for each entry.
 //------------------------------------------------------------------------------
 class RfSignature : public base::Component
 {
@@ -23,6 +30,7 @@ class RfSignature : public base::Component
 public:
     RfSignature();
     virtual double getRCS(const Emission* const em)=0;
+    virtual void getRCSArray(const double az[], const double el[], const double freq[], double rcs[], const unsigned int n);
 };
 
 //------------------------------------------------------------------------------
@@ -219,6 +227,116 @@ protected:
    bool dbFlg {};                   // dependent data in decibels
 };
 
+
+//------------------------------------------------------------------------------
+// Class: SigCompiled
+// Descriptions: Precomputed (compiled) RfSignature.  The 'signature' subtree is
+//               sampled once, on reset(), into an azimuth, elevation and frequency
+//               grid, and getRCS() becomes a trilinear table lookup; no virtual
+//               calls, trig or table searches per emission.
+//
+// Factory name: SigCompiled
+// Slots:
+//    signature       <RfSignature>     ! Signature to compile (default: 0)
+//    azimuthStep     <base::Angle>     ! Azimuth grid step (default: 2 degrees)
+//    elevationStep   <base::Angle>     ! Elevation grid step (default: 2 degrees)
+//    minFrequency    <base::Number>    ! Lowest frequency sampled (hz) (default: 1 GHz)
+//                                      !  base::Number(hz) or base::Frequency()
+//    maxFrequency    <base::Number>    ! Highest frequency sampled (hz) (default: 18 GHz)
+//                                      !  base::Number(hz) or base::Frequency()
+//    numFrequencies  <base::Number>    ! Number of log spaced frequency samples (default: 8)
+//
+// Notes:
+//  1) If 'signature' is a SigSwitch then each of its subcomponents is compiled
+//     into its own table, and the table is selected at lookup time using the
+//     ownship's camouflage type, same as SigSwitch.
+//
+//  2) Azimuth covers [ -pi .. pi ] and elevation covers [ -pi/2 .. pi/2 ].
+//     Frequencies outside of [ minFrequency .. maxFrequency ] are clamped.
+//     Interpolation is bilinear in az/el and geometric in frequency.
+//
+//  3) After compiling, the table is checked against the live signature at the
+//     center of each grid cell; the max and RMS errors (dB) are available
+//     using getMaxErrorDb() and getRmsErrorDb(), and are printed when INFO
+//     messages are enabled.
+//
+//  4) Until the table is compiled, getRCS() passes the emission to the
+//     live signature.
+//
+//  5) The compiled table is immutable, and it's shared by our clones (e.g.,
+//     the players cloned from a single template), so each clone doesn't
+//     recompile it; it's only recompiled after one of our slots changes.
+//------------------------------------------------------------------------------
+class SigCompiled : public RfSignature
+{
+   DECLARE_SUBCLASS(SigCompiled, RfSignature)
+public:
+   SigCompiled();
+
+   RfSignature* getSignature()                     { return signature; }
+   const RfSignature* getSignature() const         { return signature; }
+
+   bool isCompiled() const                         { return (table != nullptr); }
+   virtual bool compile();
+
+   double getMaxErrorDb() const                    { return (table != nullptr ? table->maxErrDb : 0.0); }
+   double getRmsErrorDb() const                    { return (table != nullptr ? table->rmsErrDb : 0.0); }
+
+   // Table lookup for the compiled 'layer' (i.e., SigSwitch subcomponent index)
+   double lookup(const unsigned int layer, const double az, const double el, const double freq) const;
+
+   virtual double getRCS(const Emission* const em) override;
+   virtual void getRCSArray(const double az[], const double el[], const double freq[], double rcs[], const unsigned int n) override;
+
+   virtual void reset() override;
+
+   // Slot functions
+   virtual bool setSlotSignature(RfSignature* const msg);
+   virtual bool setSlotAzimuthStep(const base::Angle* const msg);
+   virtual bool setSlotElevationStep(const base::Angle* const msg);
+   virtual bool setSlotMinFrequency(const base::Number* const msg);
+   virtual bool setSlotMaxFrequency(const base::Number* const msg);
+   virtual bool setSlotNumFrequencies(const base::Number* const msg);
+
+private:
+   // Compiled table; immutable once compiled
+   struct Table {
+      std::vector<float> data;         // Samples: [layer][freq][el][az]  (m^2)
+      unsigned int nLayers {};         // Number of layers (one, or the number of SigSwitch subcomponents)
+      unsigned int nAz {};             // Number of azimuth samples
+      unsigned int nEl {};             // Number of elevation samples
+      unsigned int nFreq {};           // Number of frequency samples
+      double dAz {};                   // Compiled azimuth step (radians)
+      double dEl {};                   // Compiled elevation step (radians)
+      double invAz {};                 // 1 / dAz
+      double invEl {};                 // 1 / dEl
+      double logMinFreq {};            // log10(minFreq)
+      double logFreqStep {};           // log10 frequency step
+      bool isSwitch {};                // Compiled from a SigSwitch
+      double maxErrDb {};              // Max error at the cell centers (dB)
+      double rmsErrDb {};              // RMS error at the cell centers (dB)
+   };
+
+   unsigned int getLayer() const;
+   static double lookup(const Table& t, const unsigned int layer, const double az, const double el, const double freq);
+   static void freqIndex(const Table& t, const double freq, unsigned int* const k, double* const fz);
+   static double interpolate(const Table& t, const unsigned int layer,
+         const unsigned int i0, const double fx,
+         const unsigned int j0, const double fy,
+         const unsigned int k0, const double fz);
+   double sample(RfSignature* const sig, Emission* const em, const double az, const double el, const double freq) const;
+
+   RfSignature* signature {};       // Signature being compiled
+
+   double azStep {};                // Azimuth step (radians)
+   double elStep {};                // Elevation step (radians)
+   double minFreq {1.0e9};          // Lowest frequency (hz)
+   double maxFreq {18.0e9};         // Highest frequency (hz)
+   unsigned int nFreq {8};          // Number of frequency samples
+
+   std::shared_ptr<const Table> table;   // Compiled table (shared with our clones), or zero if not compiled
+};
+
 }
 }
 
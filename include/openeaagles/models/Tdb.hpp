@@ -4,6 +4,9 @@
 
 #include "openeaagles/models/system/System.hpp"
 #include "openeaagles/base/osg/Vec3d"
+#include "openeaagles/base/osg/Matrixd"
+
+#include <vector>
 
 namespace oe {
 namespace models {
@@ -35,13 +38,37 @@ class Player;
 //
 //       If we're using gaming area position vectors (i.e., not usingECEF()) then
 //       all target's with invalid gaming area position vectors are rejected.
-//       
-// 
+//
+//       The players are scanned in three passes: the candidates' LOS vectors
+//       are gathered into component arrays, the range, horizon and FOV tests
+//       are done over the arrays by cullLosArray(), and then the visible
+//       candidates are checked for terrain occulting.
+//
+//       If the gimbal has a max range and a max closure rate to the players
+//       of interest (see Gimbal::getMaxClosureRate2PlayersOfInterest()), then
+//       a player found beyond the max range isn't rechecked until it could
+//       have closed to within the max range; i.e., for
+//          (range - maxRange) / maxClosureRate
+//       seconds of executive time.  These players are kept by their index in
+//       the player list, so they're rechecked as soon as the list changes.
+//       They're also rechecked if their LOS vector has changed by more than
+//       the max closure rate allows since they were checked (e.g., either
+//       player was repositioned), and they're all rechecked if the executive
+//       time goes backward (e.g., a restored checkpoint).
+//
 //       (Background task)
 //
+//    cullLosArray() --- (static)
+//       Range, horizon and field of view (FOV) tests for an array of LOS
+//       vectors.  The mode flags (ECEF, horizon check, no max range or angle)
+//       are folded into the matrix and limit arguments by the caller, so the
+//       loop has no per-candidate mode branches.  Also used by CollisionDetect.
+//
 //    computeBoresightData() --- 
 //       Scan the target list, which was generated by processPlayers(), and 
-//       computes gimbal boresight data for each target player.
+//       computes gimbal boresight data for each target player.  The target
+//       vectors are gathered into component arrays, so the ranges, range
+//       rates and angles are computed by loops over the arrays.
 // 
 //       (Time-critical task -- should be in-sync at the end of the dynamics
 //       phase or at the start of the transmit phase; i.e., all of the dynamics
@@ -53,6 +80,9 @@ class Player;
 //       Y+ is to the right of the gimbal boresight
 //       Z+ is the cross product of X into Y
 //
+// Note: TDBs are pooled and reused by the gimbal (see Gimbal.hpp), so each
+// call to processPlayers() replaces the previous target list.
+//
 //------------------------------------------------------------------------------
 class Tdb : public base::Object
 {
@@ -87,6 +117,39 @@ public:
    // The array of target pointer (const version)
    Player** const getTargets() const                  { return targets; }
 
+   //------------------------------------------------------------------------------
+   // Culling kernel --- range, horizon and FOV tests for 'n' ownship to candidate
+   // LOS vectors, which are packed in the component arrays 'x', 'y' and 'z'.
+   //
+   //    wm         -- LOS vector to local tangent plane (NED) matrix
+   //                  (i.e., the world matrix, or identity if the vectors are NED)
+   //    rm         -- NED to sensor (gimbal or body) matrix
+   //    maxRange   -- Max range (m), or DBL_MAX for all
+   //    hTanAng    -- Tangent of the angle to the horizon (positive down),
+   //                  or DBL_MAX for no horizon check
+   //    hDist      -- Distance to the horizon (m)
+   //    cosMaxFov  -- Cosine of the max angle off the sensor's X axis,
+   //                  or -DBL_MAX for all
+   //
+   // Returns each candidate's range (m), the tangent of the angle from local
+   // level to the candidate (positive down), the in-range flag, and the visible
+   // flag (in range, above the horizon and within the FOV).
+   //------------------------------------------------------------------------------
+   static void cullLosArray(
+      const double* const x, const double* const y, const double* const z,
+      const unsigned int n,
+      const base::Matrixd& wm,
+      const base::Matrixd& rm,
+      const double maxRange,
+      const double hTanAng,
+      const double hDist,
+      const double cosMaxFov,
+      double* const ranges,
+      double* const tanAngs,
+      unsigned char* const inRange,
+      unsigned char* const visible
+   );
+
    //------------------------------------------------------------------------------
    // Compute Boresight Data --- Scan the target list, which as been pre-processed by
    // processPlayers(), and compute gimbal boresight data (e.g., range, range rate,
@@ -134,6 +197,11 @@ protected:
    // -- old data is lost
    virtual bool resizeArrays(const unsigned int newSize);
 
+   // Out of range players (see processPlayers())
+   void setOutOfRange(const unsigned int idx, Player* const target, const base::Vec3d& los, const double recheckTime);
+   void clearOutOfRange(const unsigned int idx);
+   void clearOutOfRangeList();
+
    const Player* ownship {};     // Our ownship player (set using setGimbal())
    const Gimbal* gimbal {};      // Our gimbal (set in setGimbal())
 
@@ -161,6 +229,28 @@ protected:
    double* za {};
    double* ra2 {};
    double* ra {};
+   double* vxa {};           // Relative velocity (target - ownship) components (m/s)
+   double* vya {};
+   double* vza {};
+
+   // Out of range players, by player list index (ref()'d)
+   std::vector<Player*> oorPlayers;
+   std::vector<double> oorTimes;    // Executive time to recheck the player (sec)
+   std::vector<double> oorChecked;  // Executive time the player was checked (sec)
+   std::vector<base::Vec3d> oorLos; // Ownship to player LOS vector when checked (m)
+   double oorExecTime {};           // Executive time of the last check (sec)
+   double oorMaxRange {};           // Max range used to find them (m)
+   double oorClosureRate {};        // Max closure rate used (m/s)
+   bool oorEcef {};                 // Using ECEF when found
+
+   // processPlayers() candidate arrays
+   std::vector<Player*> cTargets;   // Candidate players
+   std::vector<unsigned int> cIdx;  // Their player list indexes
+   std::vector<double> cx, cy, cz;  // Ownship to candidate LOS vectors
+   std::vector<double> cRanges;     // Ranges (m)
+   std::vector<double> cTanAngs;    // Tangents of the angles from local level (positive down)
+   std::vector<unsigned char> cInRange;   // In range flags
+   std::vector<unsigned char> cVisible;   // Visible flags
 };
 
 }
@@ -3,6 +3,7 @@
 #define __oe_models_Track_H__
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/Checkpoint.hpp"
 
 #include "openeaagles/base/List.hpp"
 #include "openeaagles/base/osg/Vec3d"
@@ -18,6 +19,7 @@ namespace models {
 class Emission;
 class IrQueryMsg;
 class Player;
+class WorldModel;
 
 //------------------------------------------------------------------------------
 // Class: Track
@@ -214,6 +216,11 @@ public:
    // Clear track
    virtual void clear();
 
+   // Saves/restores the track's state to/from a checkpoint; the target
+   // player is saved by name and restored from 'sim'
+   void saveState(base::Checkpoint* const cp) const;
+   bool restoreState(base::Checkpoint::Reader* const rd, WorldModel* const sim);
+
 protected:
    // General track ID and status
    int         id {};              // Track id;
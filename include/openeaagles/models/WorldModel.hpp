@@ -4,10 +4,16 @@
 
 #include "openeaagles/simulation/Simulation.hpp"
 
+#include <atomic>
+#include <vector>
+
 namespace oe {
 namespace terrain { class Terrain; }
 namespace models {
 class AbstractAtmosphere;
+class FleetDynamics;
+class BulletHitIndex;
+class Player;
 
 //------------------------------------------------------------------------------
 // Class: WorldModel
@@ -39,6 +45,21 @@ class AbstractAtmosphere;
 //
 //                                            ! or zero to use current year (default: 0)
 //
+//    batchGeodeticUpdate <base::Boolean>     ! If true, the geodetic positions of the local players that are
+//                                            ! updated using world (ECEF) coordinates are computed for all of
+//                                            ! these players at the end of the dynamics phase (default: false)
+//
+//    fleetDynamics  <base::Boolean>          ! If true, the local players that are flown by RacModel and
+//                                            ! LaeroModel dynamics models are updated as a fleet at the start
+//                                            ! of the dynamics phase (default: false)
+//
+//    lodDemoteRange <base::Distance>         ! Local players beyond this range from the station's ownship and
+//                                            ! from every player with an R/F sensor are demoted to low fidelity,
+//                                            ! or zero to disable (default: 0) (see "Level of detail" below)
+//
+//    lodPromoteRange <base::Distance>        ! Low fidelity players within this range are promoted back to full
+//                                            ! fidelity, or zero to use 'lodDemoteRange' (default: 0)
+//
 //
 //    terrain        <terrain:Terrain>        ! Terrain elevation database (default: nullptr)
 //    atmosphere     <Atmosphere>             ! Atmosphere
@@ -73,6 +94,80 @@ class AbstractAtmosphere;
 //    Current simulation environments include terrain elevation posts, getTerrain(),
 //    and atmosphere model, getAtmosphere().
 //
+// Batch geodetic update:
+//
+//    With 'batchGeodeticUpdate' set, local players that are updated using world
+//    coordinates only set their new ECEF positions during the dynamics phase
+//    (phase zero).  At the end of the phase, their geodetic positions, world
+//    matrices and gaming area position vectors are computed together using the
+//    base::nav array functions (e.g., convertEcef2GeodArray()) and passed to the
+//    players (see "Updating Position" in Player.hpp).
+//
+// Fleet dynamics:
+//
+//    With 'fleetDynamics' set, before any player is updated for the dynamics
+//    phase, a FleetDynamics object steps all of the active, local players that
+//    are flown by a RacModel or LaeroModel in one structure-of-arrays loop per
+//    model type, from the main T/C thread, and writes the results back to the
+//    players.  The players then finish their dynamics phase as usual, but their
+//    models skip their own update (see FleetDynamics.hpp).
+//
+// Level of detail:
+//
+//    With a 'lodDemoteRange', at the start of each frame, a quarter of the
+//    active, local players are checked against the update rate reference
+//    positions (see below).  Players farther than 'lodDemoteRange' from the
+//    ownship and from every player with an R/F sensor are demoted to low
+//    fidelity, kinematic proxies, and low fidelity players that come within
+//    'lodPromoteRange' are promoted back to full fidelity (see "Level of
+//    detail" in Player.hpp).  Players with no ownship or sensor players to see
+//    them are demoted.  A 'lodPromoteRange' that's less than 'lodDemoteRange'
+//    gives the switching some hysteresis.
+//
+//    A proxy only moves in a straight line, so only players that nothing
+//    would steer, and that don't communicate, are demoted.  These are never
+//    demoted (and are promoted, if they were): the station's ownship, weapons,
+//    players with a pilot (e.g., an autopilot) or a navigation system (route
+//    following), and players with a radio or datalink that isn't powered off.
+//    A demoted player's sensors and antennas keep scanning and transmitting,
+//    but they don't receive or process, and its track managers are suspended
+//    (see "Level of detail" in Player.hpp).  Low fidelity players aren't used
+//    as sensor reference positions, and a sensor player isn't its own.
+//
+// Bullet hit candidates:
+//
+//    Once a Bullet has asked for them, getBulletHitIndex(), the active life
+//    forms are collected into a shared BulletHitIndex at the start of each
+//    dynamics phase, and all of the bullets test their bursts against it
+//    (see BulletHitIndex.hpp).
+//
+// Update rate reference ranges:
+//
+//    getRateRefRange() returns the range from a player to the station's
+//    ownship, or to the nearest other active, full fidelity player with an
+//    R/F sensor, using the players' positions at the start of the frame.  It's
+//    used by the systems' "ownship" and "sensor" update rate policies (see
+//    System.hpp), and is safe to call from any T/C thread.  The reference
+//    positions are only collected, at the start of the dynamics phase, once
+//    they've been used.
+//
+// RF channel:
+//
+//    After each phase of the time-critical frame, the RF emissions transmitted
+//    by the players during the phase are moved, in player list order, from the
+//    transmitters' RF outboxes to the targets' RF inboxes, and each target
+//    receives them at the start of its next time-critical frame, in its own
+//    thread (see "RF emissions and the RF channel" in Player.hpp).
+//
+// Checkpoints:
+//
+//    Released (flyout) weapons that aren't in the simulation that a checkpoint
+//    is restored into are recreated from the initial weapon on their launch
+//    vehicle (see Simulation's "Checkpoint and restore" and AbstractWeapon's
+//    saveOrigin()).  References to other players are saved by name using
+//    savePlayerName() and restored with restorePlayerName().  The weapons'
+//    target tracks are found once all of the players have been restored.
+//
 // Shutdown:
 //
 //    At shutdown, the parent object must send a SHUTDOWN_EVENT event to
@@ -104,6 +199,28 @@ public:
                                                    // (default: if zero we're using base::EarthModel::wgs84)
 
     bool isGamingAreaUsingEarthModel() const;      // Gaming area using the earth model?
+    bool isBatchGeodeticUpdate() const;            // Geodetic positions updated in a batch at the end of the dynamics phase?
+    bool isFleetDynamics() const;                  // RacModel and LaeroModel players updated as a fleet?
+
+    // Level of detail
+    double getLodDemoteRange() const;              // Range (meters) beyond which players are demoted, or zero if disabled
+    double getLodPromoteRange() const;             // Range (meters) within which players are promoted
+    unsigned int getLodDemotions() const;          // Number of players demoted since reset
+    unsigned int getLodPromotions() const;         // Number of players promoted since reset
+    unsigned int getNumLowFidelityPlayers() const; // Number of low fidelity players
+
+    // Range (meters) from player 'p' to the station's ownship, or if 'sensors' is true, to the
+    // nearest other active player with an R/F sensor, at the start of the frame; zero until known
+    double getRateRefRange(const Player* const p, const bool sensors);
+
+    // Shared bullet hit candidates, collected at the start of the dynamics phase;
+    // zero until the first frame after the first call
+    const BulletHitIndex* getBulletHitIndex();
+
+    // Checkpoint references to players, by name (an empty name for none);
+    // restorePlayerName() fails if the named player isn't found
+    static void savePlayerName(base::Checkpoint* const cp, const Player* const p);
+    bool restorePlayerName(base::Checkpoint::Reader* const rd, Player** const p);
 
 
 
@@ -113,11 +230,16 @@ public:
     const AbstractAtmosphere* getAtmosphere() const;       // returns the atmosphere model (const version)
 
     virtual void reset() override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
 
     virtual bool setEarthModel(const base::EarthModel* const msg); // Sets our earth model
     virtual bool setGamingAreaUseEarthModel(const bool flg);
+    virtual bool setBatchGeodeticUpdate(const bool flg);
+    virtual bool setFleetDynamics(const bool flg);
+    virtual bool setLodDemoteRange(const double m);
+    virtual bool setLodPromoteRange(const double m);
 
     virtual bool setRefLatitude(const double v);      // Sets Ref latitude
     virtual bool setRefLongitude(const double v);     // Sets Ref longitude
@@ -127,8 +249,17 @@ protected:
     terrain::Terrain* getTerrain();                        // returns the terrain elevation database
     virtual bool shutdownNotification() override;
 
+    virtual void tcPhaseStarting(base::PairStream* const playerList, const unsigned int phase, const double dt) override;
+    virtual void tcPhaseCompleted(base::PairStream* const playerList, const unsigned int phase) override;
+
+    virtual void saveOrigin(const simulation::AbstractPlayer* const ip, base::Checkpoint* const cp) const override;
+    virtual simulation::AbstractPlayer* recreatePlayer(base::Checkpoint::Reader* const rd) override;
+
 private:
    void initData();
+   void batchGeodeticUpdate();
+   void updateRateRefPositions(base::PairStream* const playerList);
+   void updateLevelOfDetail(base::PairStream* const playerList);
 
    bool setSlotRefLatitude(const base::LatLon* const msg);
    bool setSlotRefLatitude(const base::Number* const msg);
@@ -139,6 +270,10 @@ private:
    bool setSlotEarthModel(const base::EarthModel* const msg);
    bool setSlotEarthModel(const base::String* const msg);
    bool setSlotGamingAreaEarthModel(const base::Number* const msg);
+   bool setSlotBatchGeodeticUpdate(const base::Number* const msg);
+   bool setSlotFleetDynamics(const base::Number* const msg);
+   bool setSlotLodDemoteRange(const base::Distance* const msg);
+   bool setSlotLodPromoteRange(const base::Distance* const msg);
 
    // environmental interface
    bool setSlotTerrain(terrain::Terrain* const msg);
@@ -153,6 +288,7 @@ private:
    double cosRlat {1.0};      // Cosine of ref latitude
    double maxRefRange {};     // Max valid range (meters) of the gaming area or zero if there's no limit.
    bool gaUseEmFlg {};        // Gaming area using earth model projections
+   bool batchGeodFlg {};      // Batch geodetic update of the local players
    base::Matrixd wm;          // World transformation matrix:
                               //    Local tangent plane (NED) <==> Earth Centered, Earth Fixed (ECEF)
                               //    Usage:
@@ -161,7 +297,37 @@ private:
 
    AbstractAtmosphere* atmosphere {};
    terrain::Terrain* terrain {};
+   FleetDynamics* fleet {};   // Fleet dynamics, or zero if not enabled
+
+   // Bullet hit candidates (see getBulletHitIndex())
+   std::atomic<bool> hitIndexUsed {};         // getBulletHitIndex() has been called
+   BulletHitIndex* hitIndex {};               // Shared hit candidates, or zero if not used
+
+   // Level of detail (see updateLevelOfDetail())
+   double lodDemoteRng {};                    // Demote range (meters) or zero if disabled
+   double lodPromoteRng {};                   // Promote range (meters) or zero to use 'lodDemoteRng'
+   unsigned int lodDemotions {};              // Players demoted since reset
+   unsigned int lodPromotions {};             // Players promoted since reset
+   unsigned int lodLowCount {};               // Low fidelity players
+   unsigned int lodFrame {};                  // Frame counter for checking a quarter of the players each frame
+
+   // Update rate reference positions (see updateRateRefPositions())
+   std::atomic<bool> rateRefUsed {};          // getRateRefRange() has been called
+   bool rateRefValid {};                      // Reference positions have been collected
+   const Player* rateOwnship {};              // Station's ownship player (or zero)
+   base::Vec3d rateOwnshipPos;                // Station's ownship position
+   std::vector<const Player*> rateSensors;    // Active players with R/F sensors
+   std::vector<base::Vec3d> rateSensorPos;    // Their positions
 
+   // Batch geodetic update work arrays (see batchGeodeticUpdate())
+   std::vector<Player*> geodPlayers;
+   std::vector<base::Vec3d> geodEcef;
+   std::vector<base::Vec3d> geodLla;
+   std::vector<base::Vec3d> geodNed;
+   std::vector<base::Matrixd> geodWm;
+   std::vector<double> geodLat;
+   std::vector<double> geodLon;
+   std::vector<double> geodAlt;
 };
 
 }
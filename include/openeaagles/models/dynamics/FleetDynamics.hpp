@@ -0,0 +1,128 @@
+
+#ifndef __oe_models_FleetDynamics_H__
+#define __oe_models_FleetDynamics_H__
+
+#include <vector>
+
+namespace oe {
+namespace base { class PairStream; }
+namespace models {
+class Player;
+class RacModel;
+class LaeroModel;
+
+//------------------------------------------------------------------------------
+// Class: FleetDynamics
+//
+// Description: Group-level (fleet) update of the players that are flown by the
+//              simple RacModel and LaeroModel dynamics models
+//
+//    At the start of the dynamics phase (phase zero), update() collects the
+//    active, local, full fidelity players whose dynamics model is exactly a
+//    RacModel or a LaeroModel, copies their state into structure-of-arrays groups (one array
+//    per state variable), steps each group in a single loop over the arrays,
+//    and then writes the new states back to the players and their models.
+//    The models' dynamics() functions, called later in the phase by
+//    Player::dynamics(), see that they've been updated and only do their
+//    own bookkeeping; the players' position updates are unchanged.
+//
+//    The equations are the same as RacModel::updateRAC() and
+//    LaeroModel::update4DofModel(), so a fleet update gives the same results
+//    as updating each player's model on its own.
+//
+// Notes:
+//    1) Used by the WorldModel when its 'fleetDynamics' slot is true.
+//    2) Runs in the main T/C thread, before any player is updated for the
+//       phase, so the players' states are read at the start of the phase.
+//    3) Models derived from RacModel or LaeroModel are not grouped; they're
+//       still updated by their own dynamics() functions.
+//------------------------------------------------------------------------------
+class FleetDynamics
+{
+public:
+   FleetDynamics() = default;
+   FleetDynamics(const FleetDynamics&) = delete;
+   FleetDynamics& operator=(const FleetDynamics&) = delete;
+
+   // Updates the fleet's players; 'dt' is the phase's delta time
+   void update(base::PairStream* const playerList, const double dt);
+
+   unsigned int getNumRacPlayers() const    { return static_cast<unsigned int>(rac.plr.size()); }
+   unsigned int getNumLaeroPlayers() const  { return static_cast<unsigned int>(laero.plr.size()); }
+
+private:
+   void collect(base::PairStream* const playerList, const double dt);
+   void updateRacGroup();
+   void updateLaeroGroup();
+
+   // RacModel group
+   struct RacGroup {
+      std::vector<Player*> plr;
+      std::vector<RacModel*> mdl;
+      std::vector<double> dt;          // Delta time (zero if frozen)  (sec)
+
+      // Player state
+      std::vector<double> alt;         // Altitude                     (m)
+      std::vector<double> vt;          // Total velocity               (m/s)
+      std::vector<double> phi;         // Roll                         (rad)
+      std::vector<double> tht;         // Pitch                        (rad)
+      std::vector<double> psi;         // Heading                      (rad)
+      std::vector<double> qa1;         // Previous pitch rate          (rad/sec)
+      std::vector<double> ra1;         // Previous yaw rate            (rad/sec)
+      std::vector<double> dmg;         // Damage                       (0 to 1)
+
+      // Model parameters and commands
+      std::vector<double> vpMin;       // Minimum velocity             (m/s)
+      std::vector<double> vpMaxG;      // Velocity for max G's         (m/s)
+      std::vector<double> gMax;        // Max G's                      (g's)
+      std::vector<double> maxAccel;    // Max longitudinal accel       (m/s/s)
+      std::vector<double> cmdAlt;      // Commanded altitude           (m)
+      std::vector<double> cmdHdg;      // Commanded heading            (rad)
+      std::vector<double> cmdVel;      // Commanded velocity           (m/s)
+
+      // Results
+      std::vector<double> newPhi;      // New roll                     (rad)
+      std::vector<double> newTht;      // New pitch                    (rad)
+      std::vector<double> newPsi;      // New heading                  (rad)
+      std::vector<double> qa;          // New pitch rate               (rad/sec)
+      std::vector<double> ra;          // New yaw rate                 (rad/sec)
+      std::vector<double> vp;          // New velocity                 (m/s)
+      std::vector<double> vpdot;       // Acceleration                 (m/s/s)
+
+      void clear();
+      void resize(const unsigned int n);
+   };
+
+   // LaeroModel group
+   struct LaeroGroup {
+      std::vector<Player*> plr;
+      std::vector<LaeroModel*> mdl;
+      std::vector<double> dt;          // Model's previous delta time  (sec)
+
+      // Euler angles, rates and previous rates
+      std::vector<double> phi, tht, psi;
+      std::vector<double> phiDot, thtDot, psiDot;
+      std::vector<double> phiDot1, thtDot1, psiDot1;
+
+      // Body velocities, accelerations and previous accelerations
+      std::vector<double> u, v, w;
+      std::vector<double> uDot, vDot, wDot;
+      std::vector<double> uDot1, vDot1, wDot1;
+
+      // Work arrays and results
+      std::vector<double> sinPhi, cosPhi, sinTht, cosTht, sinPsi, cosPsi;
+      std::vector<double> p, q, r;
+      std::vector<double> velN, velE, velD;
+
+      void clear();
+      void resize(const unsigned int n);
+   };
+
+   RacGroup rac;
+   LaeroGroup laero;
+};
+
+}
+}
+
+#endif
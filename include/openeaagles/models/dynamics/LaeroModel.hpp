@@ -12,10 +12,15 @@ namespace models {
 // Description:
 //    A small, simple, reconfigurable 4 degree of freedom aerodynamic model
 //    written by Larry Buckner
+//
+//    When the world model's 'fleetDynamics' slot is true, our player is
+//    updated with the rest of the fleet by FleetDynamics at the start of the
+//    dynamics phase, and dynamics() only saves the delta time.
 //------------------------------------------------------------------------------
 class LaeroModel : public AerodynamicsModel
 {
    DECLARE_SUBCLASS(LaeroModel, AerodynamicsModel )
+   friend class FleetDynamics;
 
 public:
    LaeroModel();
@@ -26,6 +31,8 @@ public:
    virtual bool setCommandedVelocityKts(const double v, const double vNps = 0) override;
 
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    //-----------------------------------
@@ -47,6 +54,7 @@ private:
    void update4DofModel(const double dt);
 
    double dT {};
+   bool fleetUpdated {};   // Updated by FleetDynamics this frame
 
    // Body angular vel, acc components
    double p {};
@@ -23,10 +23,15 @@ namespace models {
 //    cmdAltitude    <Distance>  ! Command Altitude
 //    cmdHeading     <Angle>     ! Command Heading
 //    cmdSpeed       <Number>    ! Command speed           (kts)
+//
+// Note: when the world model's 'fleetDynamics' slot is true, our player is
+// updated with the rest of the fleet by FleetDynamics at the start of the
+// dynamics phase, and dynamics() only clears the 'fleetUpdated' flag.
 //------------------------------------------------------------------------------
 class RacModel : public AerodynamicsModel
 {
     DECLARE_SUBCLASS(RacModel, AerodynamicsModel)
+    friend class FleetDynamics;
 
 public:
     RacModel();
@@ -53,6 +58,8 @@ public:
     virtual void dynamics(const double dt) override;            // One pass model update; called from Player::dynamics()
 
     virtual void reset() override;
+    virtual void saveState(base::Checkpoint* const cp) const override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
     // Slot methods
     virtual bool setSlotMinSpeed(const base::Number* const msg);
@@ -73,6 +80,7 @@ private:
     double cmdAltitude {-9999.0};  // Commanded Altitude            (meters)
     double cmdHeading {-9999.0};   // Commanded Heading             (degs)
     double cmdVelocity {-9999.0};  // Commanded speed               (kts)
+    bool fleetUpdated {};          // Updated by FleetDynamics this frame
 };
 
 }
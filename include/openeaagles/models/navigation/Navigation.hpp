@@ -133,6 +133,8 @@ public:
 
    virtual void updateData(const double dt = 0.0) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    // Set positional data
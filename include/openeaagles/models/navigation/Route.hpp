@@ -27,6 +27,10 @@ class Steerpoint;
 //    3) If an action is not ready (i.e., Action::isReadyToStart() is
 //       false) then the action will be skipped.
 //
+//    4) The route's distance, time and fuel to go (i.e., from the navigation
+//       position, through the 'to' steerpoint, to the end of the route) are
+//       computed in the same pass as the steerpoints' nav steering data.
+//
 //
 // Factory name: Route
 // Slots:
@@ -67,6 +71,11 @@ public:
    virtual bool isWrapEnabled() const;
    virtual bool setWrapEnable(const bool flg);
 
+   // Route totals: from the nav position to the end of the route
+   virtual double getDistToGoNM() const;     // Distance to go (NM)
+   virtual double getTimeToGo() const;       // Time to go (sec); zero without a valid ground speed
+   virtual double getFuelToGo() const;       // Fuel to go at the current fuel flow (lbs); zero if unknown
+
    // Manual increment/decrement current steerpoint index
    virtual bool incStpt();
    virtual bool decStpt();
@@ -111,6 +120,8 @@ public:
    virtual void updateData(const double dt = 0.0) override;
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
     // Compute nav steering data for each steerpoint.
@@ -147,6 +158,10 @@ private:
    double       autoSeqDistNM {2.0};                    // Distance to auto sequence (NM)
    bool         autoSeq {true};                         // Auto sequence of steerpoint
    bool         wrap {true};                            // Wrap around route when inc or dec 'to' steerpoint
+
+   double       distToGo {};                            // Distance to go (NM)
+   double       timeToGo {};                            // Time to go (sec)
+   double       fuelToGo {};                            // Fuel to go (lbs)
 };
 
 inline Steerpoint* Route::getSteerpoint()
@@ -179,6 +194,21 @@ inline double Route::getAutoSeqDistance() const
    return autoSeqDistNM;
 }
 
+inline double Route::getDistToGoNM() const
+{
+   return distToGo;
+}
+
+inline double Route::getTimeToGo() const
+{
+   return timeToGo;
+}
+
+inline double Route::getFuelToGo() const
+{
+   return fuelToGo;
+}
+
 inline base::Pair* Route::findSteerpoint(const Steerpoint* const sp)
 {
    return const_cast<base::Pair*>(static_cast<const base::Pair*>(findSteerpointImp(sp)));
@@ -59,6 +59,20 @@ class Action;
 //                                    !  Note: the "to" steerpoint will have sequenced to the
 //                                    !  next steerpoint when action is triggered. (default: 0)
 //
+// Nav steering computations:
+//
+//    The 'leg' course and distance from the 'from' steerpoint (great circle,
+//    base::nav::gll2bd()) are cached, and are only recomputed when either
+//    steerpoint has moved.
+//
+//    The 'direct-to' bearing and distance are computed using gll2bd() at a
+//    reference (correction) position, along with their rates of change with
+//    the navigation lat/lon.  Until the navigation position has moved more
+//    than 2% of the reference distance, they're projected from the reference
+//    data using these rates (typical errors are less than 0.002 degrees and
+//    0.002% of the distance); then the reference is recomputed.  Within
+//    2 NM of the steerpoint, they're always computed using gll2bd().
+//
 //------------------------------------------------------------------------------
 class Steerpoint : public base::Component
 {
@@ -197,6 +211,9 @@ protected:
        ) override;
 
 private:
+    void computeDirectTo(const double lat, const double lon, double* const brg, double* const dist);
+    void computeLeg(const Steerpoint* const from, double* const crs, double* const dist);
+
     // Steerpoint parameters
     double      latitude {};          // latitude
     double      longitude {};         // Longitude
@@ -254,6 +271,29 @@ private:
     double elt {};            // Early/Late time          (sec)
     bool   scaWarn {};        // Safe clearance Alt warning flag
     bool   navDataValid {};   // Nav data is valid
+
+    // Cached leg geometry (see computeLeg())
+    double legFromLat {};     // 'from' steerpoint's latitude  (degs)
+    double legFromLon {};     // 'from' steerpoint's longitude (degs)
+    double legLat {};         // Our latitude                  (degs)
+    double legLon {};         // Our longitude                 (degs)
+    double legCrs {};         // Leg TRUE course               (degs)
+    double legDist {};        // Leg distance                  (nm)
+    bool   legValid {};       // Cached leg geometry is valid
+
+    // Direct-to reference data (see computeDirectTo())
+    double refLat {};         // Nav latitude at the reference              (degs)
+    double refLon {};         // Nav longitude at the reference             (degs)
+    double refStptLat {};     // Our latitude at the reference              (degs)
+    double refStptLon {};     // Our longitude at the reference             (degs)
+    double refDist {};        // Direct-to distance at the reference        (nm)
+    double refN {};           // Direct-to north component at the reference (nm)
+    double refE {};           // Direct-to east component at the reference  (nm)
+    double refDnDlat {};      // Rates of change of the north and east components
+    double refDnDlon {};      //    with the nav latitude and longitude     (nm/deg)
+    double refDeDlat {};
+    double refDeDlon {};
+    bool   refValid {};       // Direct-to reference data is valid
 };
 
 }
@@ -114,6 +114,19 @@ class Track;
 //       getFlyoutWeapon() -- After prerelease() and/or release(), returns the flyout weapon;
 //                            Before prerelease() or release(), returns zero.
 //
+// Checkpoints:
+//
+//    saveState() saves our release and target state, with the launch vehicle,
+//    target player and flyout weapon by name, and the target track by its ID
+//    and its track manager, on our launch vehicle or on us.  The target track
+//    is found after all of the players have been restored, when the WorldModel
+//    calls restoreTargetTrack().
+//
+//    A flyout weapon's origin, saveOrigin(), is its launch vehicle's name and
+//    the index of its initial weapon within the launch vehicle's stores, so
+//    recreateFlyout() can clone it, like prerelease(), when the checkpoint is
+//    restored into a simulation that doesn't have it.
+//
 // Notes:
 //
 // 1) On reset(), the flyout weapon is set to the DELETE_REQUEST mode, which
@@ -213,6 +226,15 @@ public:
 
    unsigned short getReleaseEventID() const;         // Release event ID (to help match weapon launch and detonation events)
    bool isReleaseHold() const;                       // Is weapon is holding in PRE_RELEASE mode?
+   bool isFlyoutWeapon() const;                      // True if we're a flyout weapon (cloned from an initial weapon)
+
+   // Checkpoint support (see "Checkpoints" above)
+   void saveOrigin(base::Checkpoint* const cp) const;
+   static AbstractWeapon* recreateFlyout(WorldModel* const sim, base::Checkpoint::Reader* const rd);
+   bool restoreTargetTrack();
+
+   // All of the weapons in player 'p's stores, including its guns' bullets, in order
+   static void getStoresWeapons(const Player* const p, std::vector<const AbstractWeapon*>* const list);
 
 
    // Sets a pointer to the launcher and our station number
@@ -303,6 +325,8 @@ public:
    virtual void updateTC(const double dt = 0.0) override;
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual void weaponGuidance(const double dt);
@@ -359,6 +383,9 @@ private:
     bool       tgtPosValid {};                 // If true, target position is valid
     base::safe_ptr<Player> tgtPlayer;      // Target Player
     base::safe_ptr<Track>  tgtTrack;       // Target Track
+    int          rstTrkOwner {};           // Target track to find after a restore: 0 -- none, 1 -- our launch vehicle, 2 -- us
+    unsigned int rstTrkMgr {};             //    and the index of its track manager
+    int          rstTrkId {};              //    and its track ID
     base::Vec3d    tgtVel {};                  // Target/Track Velocity (m/s) relative to ownship velocity
     base::safe_ptr<Player> launchVehicle;  // Launching/Releasing Player
     bool       posTrkEnb {};                   // If true, update tgtPos from the target/track
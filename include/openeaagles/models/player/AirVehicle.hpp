@@ -143,6 +143,8 @@ public:
     virtual unsigned int getMajorType() const override;
 
     virtual void reset() override;
+    virtual void saveState(base::Checkpoint* const cp) const override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    AerodynamicsModel* getAerodynamicsModel();
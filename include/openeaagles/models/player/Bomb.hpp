@@ -77,6 +77,9 @@ public:
    virtual const char* getNickname() const override;
    virtual int getCategory() const override;
 
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
+
 protected:
    virtual bool setNoseFuze(const bool f);
    virtual bool setMidFuze(const bool f);
@@ -16,6 +16,20 @@ namespace models {
 //    Provides a description of the bullet.  It is used to create the "flyout"
 //    weapon player.  During flyout, the bullets are grouped into bursts.
 //
+//    Hit testing is continuous: each frame, every active burst is treated as
+//    the line segment swept from its previous position to its current position,
+//    relative to each candidate player's motion over the same frame, and the
+//    relative segment is tested against the candidate's bounding sphere.  This
+//    keeps high closure rate rounds from tunneling through a (crossing) target
+//    between frames.
+//
+//    With a target player, only the target is tested (hit radius: 10 meters).
+//    Without one, all active, non-destroyed life forms other than the launch
+//    vehicle are tested (hit radius: 1 meter); these candidates are collected
+//    once per frame, for all bullets, into the world model's BulletHitIndex,
+//    which is sorted along the north axis, so each burst only tests the players
+//    whose north extent overlaps its segment.
+//
 // Factory name: Bullet
 //------------------------------------------------------------------------------
 class Bullet : public AbstractWeapon
@@ -25,6 +39,8 @@ class Bullet : public AbstractWeapon
 public:
    static const double DEFAULT_MUZZLE_VEL;         // Meters / second
    static const double DEFAULT_MAX_TOF;            // Seconds
+   static const double DEFAULT_TGT_HIT_RANGE;      // Meters
+   static const double DEFAULT_LF_HIT_RANGE;       // Meters
 
 public:
    Bullet();
@@ -45,6 +61,8 @@ public:
    virtual int getCategory() const override;
 
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual void resetBurstTrajectories();
@@ -62,7 +80,8 @@ protected:
 
    struct Burst {
       enum Status { ACTIVE, HIT, MISS };
-      Burst() : bPos(0,0,0), bVel(0,0,0) {}
+      Burst() : bPos0(0,0,0), bPos(0,0,0), bVel(0,0,0) {}
+      base::Vec3d bPos0;        // Burst positions at the start of the frame -- world (m)
       base::Vec3d bPos;         // Burst positions -- world  (m)
       base::Vec3d bVel;         // Burst velocities -- world (m)
       double bTof {};           // Burst time of flight      (sec)
@@ -75,12 +94,15 @@ protected:
 private:
    enum { MBT = 100 };         // Max number of burst trajectories
 
+   static double sweptHitRange(const base::Vec3d& p0, const base::Vec3d& p1, const base::Vec3d& c, double* const t);
+
    double muzzleVel {DEFAULT_MUZZLE_VEL}; // Muzzle velocity (m/s)
    base::safe_ptr<Player> hitPlayer;      // Player we hit (if any)
 
    // Bullet trajectories
    int nbt {};                     // Number of burst trajectories
    std::array<Burst, MBT> bursts;  // Bursts
+   double burstDt {};              // Delta time of the bursts' swept segments (sec)
 };
 
 }
@@ -0,0 +1,69 @@
+
+#ifndef __oe_models_BulletHitIndex_H__
+#define __oe_models_BulletHitIndex_H__
+
+#include "openeaagles/base/osg/Vec3d"
+
+#include <vector>
+
+namespace oe {
+namespace base { class PairStream; }
+namespace models {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: BulletHitIndex
+//
+// Description: Shared per-frame index of the players that can be hit by the
+//              Bullet players' bursts
+//
+//    At the start of the dynamics phase (phase zero), update() collects the
+//    active, non-destroyed life forms, with their positions and velocities,
+//    into a flat array that is sorted along the north axis.  All of the
+//    bullets that are flown during the phase test their bursts against this
+//    one index; each burst only tests the candidates whose north extent, over
+//    the frame, overlaps its swept segment (see Bullet::checkForTargetHit()).
+//
+// Notes:
+//    1) Used by the WorldModel once any bullet has asked for it
+//       (see WorldModel::getBulletHitIndex()).
+//    2) Runs in the main T/C thread, before any player is updated for the
+//       phase, so the positions are the players' positions at the start of
+//       the frame; the index is read-only while the players are updated.
+//    3) The candidate players are not ref()'d; they're valid only during the
+//       frame that the index was built.
+//------------------------------------------------------------------------------
+class BulletHitIndex
+{
+public:
+   struct Candidate {
+      Player* player {};      // Candidate player
+      base::Vec3d pos;        // Position at the start of the frame -- world (m)
+      base::Vec3d vel;        // Velocity -- world (m/s)
+   };
+
+public:
+   BulletHitIndex() = default;
+   BulletHitIndex(const BulletHitIndex&) = delete;
+   BulletHitIndex& operator=(const BulletHitIndex&) = delete;
+
+   // Rebuilds the index from the player list
+   void update(base::PairStream* const playerList);
+   void clear();
+
+   const Candidate* getCandidates() const       { return candidates.data(); }
+   unsigned int getNumCandidates() const        { return static_cast<unsigned int>(candidates.size()); }
+   double getMaxNorthSpeed() const              { return maxNorthSpeed; }   // Largest north speed of the candidates (m/s)
+
+   // Index of the first candidate with a north position of at least 'north' (m)
+   unsigned int lowerBound(const double north) const;
+
+private:
+   std::vector<Candidate> candidates;   // Sorted by north position
+   double maxNorthSpeed {};
+};
+
+}
+}
+
+#endif
@@ -61,6 +61,8 @@ public:
 
     virtual bool event(const int event, base::Object* const obj = nullptr) override;
     virtual void reset() override;
+    virtual void saveState(base::Checkpoint* const cp) const override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual bool setSlotVpMin(const base::Number* const msg);
@@ -15,6 +15,7 @@
 #include "openeaagles/base/units/distance_utils.hpp"
 
 #include <array>
+#include <vector>
 
 namespace oe {
 namespace base { class Vec2d;    class Vec3d;  class Angle; class Boolean;
@@ -170,6 +171,32 @@ class Track;
 //    IR_QUERY_MSG            <IrQueryMsg>         ! IR seeker requests signature
 //
 //
+// RF emissions and the RF channel:
+//
+//    RF emissions that are transmitted (see Antenna::rfTransmit()) during the
+//    player's time-critical frame are not sent to the target players with an
+//    RF_EMISSION event.  Instead,
+//
+//       1) in the transmitter's thread, the target reflects the emission (see
+//          rfReflectEmission()), which computes the angles of incidence and the
+//          RCS, and returns the reflected emission to the transmitting antenna;
+//
+//       2) the emission is put on the transmitter's RF outbox (rfSendEmission());
+//
+//       3) between phases, the world model moves the outboxes, in player list
+//          order, to the targets' RF inboxes (rfPartitionEmissions()); and
+//
+//       4) at the start of its next time-critical frame, and in its own thread,
+//          each target passes the emissions on its inbox, in order, to its own
+//          antennas (rfReceiveEmission()).
+//
+//    Emissions transmitted during phase 1 (transmit) are received before the
+//    phase 2 (receive) updates, as before.  Each player's receivers are only
+//    updated by the player's own thread, and always in player list order, so
+//    runs are the same with any number of T/C threads.  Emissions transmitted
+//    outside of a time-critical frame are still sent as RF_EMISSION events.
+//
+//
 //
 // Coordinate systems
 //
@@ -307,6 +334,33 @@ class Track;
 //       Geodetic          lat and lon          altitude
 //       World             X, Y and Z
 //
+//    If the world model's 'batchGeodeticUpdate' slot is true, a local player
+//    that's updated using world coordinates, and that isn't ground clamped,
+//    only sets its new ECEF position in positionUpdate().  Its geodetic position
+//    (lat/lon/alt), world matrix and gaming area position vector are computed
+//    for all of these players at the end of the dynamics phase using the base::nav
+//    array functions (see batchGeodeticUpdate() and isGeodeticUpdatePending()),
+//    and the ground collision check is made at that time.
+//
+//
+// Level of detail (fidelity):
+//
+//    The world model can demote a local player, that's beyond its interest
+//    ranges and that has no pilot, navigation or powered radios or datalinks
+//    (see "Level of detail" in WorldModel.hpp), to low fidelity using
+//    setLowFidelity().  A low fidelity player is a kinematic proxy: its
+//    dynamics model isn't updated, so positionUpdate() moves it with its
+//    current velocity and attitude, and its systems and subcomponents (e.g.,
+//    IR system, stores management, onboard computer and its track managers)
+//    are suspended.  Its R/F emitters, its top level sensor and antenna
+//    models, stay live: they scan and transmit, so other players still see
+//    its emissions, but they don't receive or process (see System::updateTC()),
+//    and their returned emissions are dropped.  Emissions hitting it are still
+//    reflected, but they're not passed to its antennas.  When it's
+//    promoted back to full fidelity, its dynamics model continues from the
+//    player's current state, and the first time-critical and background
+//    updates of its subcomponents include the time that they were suspended.
+//
 //
 //
 // Player systems and subcomponents:
@@ -652,6 +706,9 @@ public:
    IrSystem* getIrSystemByName(const char* const name);        // Returns a IR sensor model by its name
    base::Pair* getIrSystemByType(const std::type_info& type);  // Returns a IR sensor model by its type
 
+   RfSignature* getSignature();                                // Player's RCS signature
+   const RfSignature* getSignature() const;                    // Player's RCS signature (const version)
+
    // ---
    // Set functions
    // ---
@@ -727,6 +784,16 @@ public:
    // Geocentric (ECEF) position vector (meters)
    virtual bool setGeocPosition(const base::Vec3d& gcPos, const bool slaved = false);
 
+   // Level of detail (see "Level of detail" above)
+   bool isLowFidelity() const;                    // True if we're a low fidelity, kinematic proxy
+   virtual bool setLowFidelity(const bool flg);   // Demotes (true) or promotes (false) the player
+
+   // Completes a batched geodetic update (see "Updating Position" above) using
+   // the geodetic position, world matrix and gaming area position vector that
+   // were computed from our ECEF position
+   virtual void batchGeodeticUpdate(const base::Vec3d& lla, const base::Matrixd& wm, const base::Vec3d& posNED);
+   bool isGeodeticUpdatePending() const;  // True if waiting for batchGeodeticUpdate()
+
    // ---
    // Set the player's orientation angles (roll, pitch and yaw)
    //
@@ -878,12 +945,23 @@ public:
    virtual bool onDatalinkMessageEventPlayer(base::Object* const msg);        // Handles the DATALINK_MESSAGE event
    virtual bool onDeEmissionEvent(base::Object* const msg);                   // Handles the DE_EMISSION event
 
+   // ---
+   // RF channel (see "RF emissions and the RF channel" above)
+   // ---
+   bool isInTcFrame() const;                                    // True if called from our running time-critical frame
+   virtual bool rfReflectEmission(Emission* const em);          // Reflects an emission hitting us (AOI, RCS and return); false if we're not active
+   virtual bool rfReceiveEmission(Emission* const em);          // Passes an emission hitting us to our antennas and reflection requests
+   void rfSendEmission(Emission* const em);                     // Puts an emission, transmitted by us, on our RF outbox
+   void rfPartitionEmissions();                                 // Moves our RF outbox to the target players' RF inboxes
+
    // Component methods
    virtual bool isFrozen() const override;
    virtual void reset() override;
    virtual void updateTC(const double dt = 0.0) override;
    virtual void updateData(const double dt = 0.0) override;
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 public:
 
@@ -989,6 +1067,8 @@ protected:
 private:
    void initData();
    WorldModel* getSimulationImp();
+   void updateSubcomponentsTC(const double dt, const double dtOthers);    // Level of detail (see updateTC())
+   void updateSubcomponentsData(const double dt, const double dtOthers);  // Level of detail (see updateData())
 
    // ---
    // Player identity
@@ -1052,6 +1132,10 @@ private:
    bool   interpTrrn {};    // interpolate between terrain elevation posts (local terrain database only)
    double tOffset {};       // Offset from the terrain to the player's CG for ground clamping
    bool   posVecValid {};   // Local position vector valid
+   bool   geodPending {};   // ECEF position is set; waiting for batchGeodeticUpdate()
+   bool   lowFidelity {};   // Low fidelity, kinematic proxy (see setLowFidelity())
+   double lodDt {};         // Phase delta time while our subcomponents were suspended
+   double lodDataDt {};     // Background delta time while our subcomponents were suspended
    bool   altSlaved {};     // Player's altitude is slaved to the dynamics software (default: false)
    bool   posSlaved {};     // Player's position is slaved to the dynamics software (default: false)
    bool   posFrz {};        // Player's position is frozen
@@ -1123,6 +1207,14 @@ private:
    std::array<base::Component*, MAX_RF_REFLECTIONS> rfReflect {};  // Objects that are interested in the emissions hitting us
    std::array<double, MAX_RF_REFLECTIONS> rfReflectTimer {};       // Request for reflected emissions will timeout
 
+   // ---
+   // RF channel
+   // ---
+   void processRfInbox();                                          // Receives the emissions on our RF inbox
+   void clearRfEmissions();                                        // Clears our RF outbox and inbox
+   std::vector<Emission*> rfOutbox;                                // Emissions transmitted by us (ref()'d; only used by our T/C thread)
+   std::vector<Emission*> rfInbox;                                 // Emissions hitting us (ref()'d; filled between phases)
+
    // ---
    // sync state changes
    // ---
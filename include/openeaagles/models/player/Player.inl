@@ -516,6 +516,18 @@ inline bool Player::isPositionSlaved() const
    return posSlaved;
 }
 
+// True if waiting for batchGeodeticUpdate()
+inline bool Player::isGeodeticUpdatePending() const
+{
+   return geodPending;
+}
+
+// True if we're a low fidelity, kinematic proxy
+inline bool Player::isLowFidelity() const
+{
+   return lowFidelity;
+}
+
 // Terrain elevation is valid (or at least was where it was set)
 inline bool Player::isTerrainElevationValid() const
 {
@@ -6,6 +6,8 @@
 #include "openeaagles/config.hpp"
 #include "openeaagles/base/units/distance_utils.hpp"
 
+#include <vector>
+
 namespace oe {
 namespace base { class Angle; class Distance; class Number; class PairStream; }
 namespace models {
@@ -24,6 +26,7 @@ class Player;
 //    Using the 'maxPlayers', 'playerTypes', 'maxRange2Players', 'maxAngle2Players'
 //    and 'localOnly' slot parameters, this function filters the players list
 //    to create a sublist of players that are checked by the process() function.
+//    The range and angle checks use the Tdb::cullLosArray() culling kernel.
 //
 // 2) process() -- time critical thread --
 //    Checks the distance from own ownship to the players in the sublist, which
@@ -130,6 +133,14 @@ private:
 
    PlayerOfInterest* players {};       // Player of interest (POI) list
    unsigned int maxPlayers {};         // Max number of players of interest
+
+   // updateData() candidate arrays (see Tdb::cullLosArray())
+   std::vector<Player*> cTargets;
+   std::vector<double> cx, cy, cz;
+   std::vector<double> cRanges;
+   std::vector<double> cTanAngs;
+   std::vector<unsigned char> cInRange;
+   std::vector<unsigned char> cVisible;
 };
 
 inline double CollisionDetect::getCollisionRange() const       { return collisionRange; }
@@ -48,6 +48,8 @@ public:
 
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    bool setJettisonable(const bool f);    // Sets the jettison enable flag
@@ -36,6 +36,8 @@ public:
    virtual bool isFuelWtValid() const;
 
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual bool setSlotFuelWt(const base::Number* const msg);
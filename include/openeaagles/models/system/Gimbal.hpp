@@ -99,6 +99,9 @@ class Tdb;
 //    maxRange2PlayersOfInterest (Distance)  ! Max range to players of interest, or zero for all (default: 0)
 //    maxAngle2PlayersOfInterest (Angle)     ! Max angle off the gimbal boresight to players of interest, or zero for all (default: 0)
 //    localPlayersOfInterestOnly (Number)    ! Sets the local only players of interest flag (default: false)
+//    maxClosureRate2PlayersOfInterest (Number) ! Max closure rate (m/s) between ownship and any player of interest,
+//                                           ! used to skip rechecking players that are clearly out of range,
+//                                           ! or zero to recheck every player on every scan (default: 0)
 //
 //    useWorldCoordinates  (Number)          ! Using player of interest's world (ECEF) coordinate system (default: true)
 //    useOwnHeadingOnly    (Number)          ! Whether only the ownship heading is used by the target data block (default: true)
@@ -108,6 +111,14 @@ class Tdb;
 //    RF_EMISSION       (Emission)           ! Default handler: Pass emissions to subcomponents.
 //
 //
+// Target data blocks:
+//    The target data blocks (TDBs) built by processPlayersOfInterest() are
+//    pooled, so each scan reuses a TDB that's no longer referenced by our
+//    systems (see getCurrentTDB()) instead of allocating a new one.  The
+//    pool, and with it the TDBs' out of range players (see Tdb.hpp), is
+//    cleared by reset() and restoreState().
+//
+//
 //  Handy support functions
 //      limitVec(base::Vec2d& vec, base::Vec2d& lim)
 //      limitVec(base::Vec2d& vec, base::Vec2d& ll, base::Vec2d& ul)
@@ -214,6 +225,7 @@ public:  // Public section
    unsigned int getPlayerOfInterestTypes() const { return playerTypes; }    // Player of interest types (Player::MajorType bit-wise or'd)
    unsigned int getMaxPlayersOfInterest() const  { return maxPlayers; }     // Max number of players of interest (i.e., size of the arrays)
    bool isLocalPlayersOfInterestOnly() const { return localOnly; }          // Local only players of interest flag
+   double getMaxClosureRate2PlayersOfInterest() const { return maxClosureRate; } // Max closure rate to players of interest or zero (m/s)
    bool isTerrainOccultingEnabled() const  { return terrainOcculting; }     // Terrain occulting enabled flag
    bool isHorizonCheckEnabled() const      { return checkHorizon; }         // Horizon masking enable flag
    bool isUsingWorldCoordinates() const    { return useWorld; }             // Returns true if using player of interest's world coordinates
@@ -226,6 +238,7 @@ public:  // Public section
    virtual bool setPlayerOfInterestTypes(const unsigned int typeMask);     // Player of interest types (Player::MajorType bit-wise or'd)
    virtual bool setMaxPlayersOfInterest(const unsigned int n);             // Max number of players of interest (i.e., size of the arrays)
    virtual bool setLocalPlayersOfInterestOnly(const bool flg);             // Sets the local only players of interest flag
+   virtual bool setMaxClosureRate2PlayersOfInterest(const double mps);     // Max closure rate to players of interest or zero (m/s)
    virtual bool setTerrainOccultingEnabled(const bool flg);                // Sets the terrain occulting enabled flag
    virtual bool setHorizonCheckEnabled(const bool flg);                    // Sets the horizon check enabled flag
    virtual bool setUseWorld(const bool flg);                               // Sets the using world coordinates flag
@@ -316,6 +329,9 @@ public:  // Public section
    // Sets the local only players of interest flag
    virtual bool setSlotLocalPlayersOfInterestOnly(const base::Number* const msg);
 
+   // Max closure rate to players of interest or zero (m/s)
+   virtual bool setSlotMaxClosureRate2PlayersOfInterest(const base::Number* const msg);
+
    // Using player of interest's world (ECEF) coordinate system
    virtual bool setSlotUseWorldCoordinates(const base::Number* const msg);
 
@@ -329,6 +345,8 @@ public:  // Public section
 
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual void servoController(const double dt = 0.0);
@@ -349,8 +367,10 @@ protected:
 
 private:
    void initData();
+   void clearTdbPool();
 
    static const double defaultTolerance;
+   static const unsigned int TDB_POOL_SIZE = 3;
 
    Type        type {ELECTRONIC};          // Mechanical or Electronic gimbal (affects maxRates)
    ServoMode   servoMode {FREEZE_SERVO};   // Gimbal's servo mode
@@ -377,12 +397,14 @@ private:
    unsigned int playerTypes {0xFFFF};  // Player of interest type mask (default: all players)
    unsigned int maxPlayers {200};      // Max number of players of interest (i.e., size of the arrays)
    bool     localOnly {};              // Local players of interest only
+   double   maxClosureRate {};         // Max closure rate to players of interest or zero (m/s)
    bool     terrainOcculting {};       // Target terrain occulting enabled flag
    bool     checkHorizon {true};       // Horizon masking check enabled flag
    bool     useWorld {true};           // Using player of interest's world coordinates
    bool     ownHeadingOnly {true};     // Whether only the ownship heading is used by the target data block
 
    base::safe_ptr<Tdb> tdb;  // Current Target Data Block
+   Tdb* tdbPool[TDB_POOL_SIZE] {};   // Pool of Target Data Blocks (ref()'d)
 };
 
 }
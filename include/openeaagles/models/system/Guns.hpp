@@ -95,6 +95,8 @@ public:
    virtual bool setSlotYaw(const base::Number* const num);        // Gun heading angle to ownship
 
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual double computeBulletRatePerSecond();
@@ -58,6 +58,7 @@ public:
    virtual int getShootList(base::safe_ptr<const Track>* const tlist, const int max) const;
 
    virtual void reset() override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
    virtual void updateData(const double dt = 0.0) override;
 
 protected:
@@ -10,6 +10,7 @@
 
 namespace oe {
 namespace models {
+class RadarClutter;
 
 //------------------------------------------------------------------------------
 // Class: Radar
@@ -21,6 +22,16 @@ namespace models {
 // Slots:
 //    igain    <base::Number>     ! Integrator gain (no units; default: 1.0f)
 //             <base::Decibel>    ! Integrator gain (dB)
+//    clutter  <RadarClutter>     ! Terrain clutter model (default: none)
+//
+// Notes:
+//    1) With a clutter model, the clutter power of the target's range cell,
+//       within the current sweep, is added to the interference (noise plus
+//       jamming) of each return, and cells with a clutter-to-noise ratio
+//       above the receiver threshold are painted on the real-beam display.
+//       Only the sweep under the beam is updated by the clutter model, and
+//       each cell's power uses the antenna's two-way gain toward the cell
+//       (see RadarClutter::computeGains()).
 //
 //------------------------------------------------------------------------------
 class Radar : public RfSensor
@@ -57,6 +68,9 @@ public:
    // Returns integration gain
    double getIGain() const                         { return rfIGain; }
 
+   // Returns the terrain clutter model, or zero if none
+   const RadarClutter* getClutter() const          { return clutter; }
+
    // return the current number of emissions that have been jammed.
    int getNumberOfJammedEmissions() const          { return numberOfJammedEmissions; }
 
@@ -65,11 +79,14 @@ public:
 
    // Slot functions
    virtual bool setSlotIGain(base::Number* const msg);
+   virtual bool setSlotClutter(RadarClutter* const msg);
 
    virtual bool killedNotification(Player* const killedBy = 0) override;
 
    virtual void updateData(const double dt = 0.0) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual bool onEndScanEvent(const base::Integer* const bar) override;
@@ -111,6 +128,7 @@ private:
    int    numberOfJammedEmissions {};
 
    double rfIGain {1.0};              // Integrator gain (default: 1.0) (no units)
+   RadarClutter* clutter {};          // Terrain clutter model
 };
 
 }
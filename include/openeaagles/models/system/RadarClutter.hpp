@@ -0,0 +1,157 @@
+
+#ifndef __oe_models_RadarClutter_H__
+#define __oe_models_RadarClutter_H__
+
+#include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/osg/Vec3d"
+
+#include <memory>
+#include <vector>
+
+namespace oe {
+namespace base { class Distance; class Number; }
+namespace models {
+class Radar;
+
+//------------------------------------------------------------------------------
+// Class: RadarClutter
+//
+// Description: Terrain clutter model for the Radar; computes the ground clutter
+//              cross section of each range/azimuth cell of the radar's real-beam
+//              'sweeps' grid.
+//
+//    Each sweep (azimuth) is a column of range cells that is computed on its
+//    own, using the radar's current range scale, so the radar only updates the
+//    column under its beam (see Radar::receive()):
+//       1) terrain elevations along the sweep (Terrain::getElevations()), with
+//          no terrain, or missing elevations, treated as flat land at sea level,
+//       2) shadowing by a running max of the cells' look angles (4/3 earth),
+//       3) the local grazing angle: the flat (4/3 earth) grazing angle plus the
+//          terrain slope toward the radar,
+//       4) constant-gamma reflectivity, land or sea (elevation at or below zero),
+//          times the area of the cell's resolution patch (beam width by the
+//          pulse-limited or beam-limited range extent).
+//
+//    The cells' cross sections, grazing angles and depression angles are
+//    cached; a column is only recomputed after the ownship has moved more than
+//    'updateDistance', or has turned, or after the range scale has changed.
+//
+//    The antenna's two-way gain toward each cell (see computeGains()) is the
+//    antenna's gain times its gain pattern (Antenna::gainPatternTable()) at the
+//    cell's azimuth and depression angle off the beam's boresight, squared.
+//    The cells' two-way gains times their cross section / range^4 are cached
+//    with each sweep (see getG2R4()), and are only recomputed after the sweep
+//    has been recomputed, or after the antenna's gimbal or the ownship's
+//    attitude has moved more than a tenth of the antenna's beam width.
+//
+// Factory name: RadarClutter
+// Slots:
+//    landGamma          <base::Number>    ! Land reflectivity, gamma (no units; default: -15 dB)
+//                       <base::Decibel>   ! Land reflectivity, gamma (dB; e.g., ( Decibel -15 ))
+//    seaGamma           <base::Number>    ! Sea reflectivity, gamma (no units; default: -40 dB)
+//                       <base::Decibel>   ! Sea reflectivity, gamma (dB; e.g., ( Decibel -40 ))
+//    improvementFactor  <base::Number>    ! Clutter improvement factor for returns with
+//                       <base::Decibel>   !   a range rate of at least 'minVelocity' (default: 1.0)
+//    minVelocity        <base::Number>    ! Minimum detectable velocity (m/s) (default: 0 -- no improvement)
+//    updateDistance     <base::Distance>  ! Ownship movement before a column is recomputed (default: 100 meters)
+//
+// Notes:
+//    1) Land cover isn't available from the terrain databases, so the
+//       reflectivity is either land or sea, by elevation.
+//    2) Multipath isn't modeled.
+//    3) A plain number is a ratio (no units), so it can't be negative; give
+//       values in dB as a base::Decibel (e.g., landGamma: ( Decibel -15 )).
+//------------------------------------------------------------------------------
+class RadarClutter : public base::Object
+{
+   DECLARE_SUBCLASS(RadarClutter, base::Object)
+
+public:
+   RadarClutter();
+
+   double getLandGamma() const              { return landGamma; }
+   double getSeaGamma() const               { return seaGamma; }
+   double getImprovementFactor() const      { return improvementFactor; }
+   double getMinVelocity() const            { return minVelocity; }          // (m/s)
+   double getUpdateDistance() const         { return updateDistance; }       // (m)
+
+   // Clutter cross section (m^2) and grazing angle (radians) of cell 'j' of sweep 'n';
+   // zero if the cell is shadowed, or the sweep hasn't been computed.
+   double getRcs(const unsigned int n, const unsigned int j) const;
+   double getGrazingAngle(const unsigned int n, const unsigned int j) const;
+
+   // Clutter cross sections (m^2) divided by range^4 (m^4) of the cells of sweep 'n'
+   const double* getRcsR4(const unsigned int n) const;
+
+   // Two-way antenna gains (no units) toward the Radar::PTRS_PER_SWEEP cells of
+   // sweep 'n', for the radar antenna's current position
+   void computeGains(const Radar* const radar, const unsigned int n, double* const gains) const;
+
+   // Two-way antenna gains times the clutter cross sections divided by range^4
+   // (m^-2) of the cells of sweep 'n'; cached, and recomputed if needed for the
+   // radar antenna's current position (call after update())
+   const double* getG2R4(const Radar* const radar, const unsigned int n);
+
+   // Number of cells computed since the last reset()
+   unsigned int getNumCellsComputed() const { return numCells; }
+
+   // Updates sweep 'n', if needed, for the radar's current position and range;
+   // returns true if the sweep was recomputed.
+   bool update(const Radar* const radar, const unsigned int n);
+
+   // Invalidates all sweeps
+   void reset();
+
+   virtual bool setLandGamma(const double);
+   virtual bool setSeaGamma(const double);
+   virtual bool setImprovementFactor(const double);
+   virtual bool setMinVelocity(const double);
+   virtual bool setUpdateDistance(const double);
+
+protected:
+   bool setSlotLandGamma(const base::Number* const);
+   bool setSlotSeaGamma(const base::Number* const);
+   bool setSlotImprovementFactor(const base::Number* const);
+   bool setSlotMinVelocity(const base::Number* const);
+   bool setSlotUpdateDistance(const base::Distance* const);
+
+private:
+   void computeSweep(const Radar* const radar, const unsigned int n, const double hdg, const double maxRng);
+   static double sweepAzimuth(const unsigned int n);
+
+   double landGamma;                // Land reflectivity (no units)
+   double seaGamma;                 // Sea reflectivity (no units)
+   double improvementFactor {1.0};  // Clutter improvement factor (no units)
+   double minVelocity {};           // Minimum detectable velocity (m/s)
+   double updateDistance {100.0};   // Update distance (m)
+
+   // Cells [sweep * cells per sweep + range index]
+   std::vector<double> rcs;         // Clutter cross section (m^2)
+   std::vector<double> rcsR4;       // Cross section / range^4 (m^-2)
+   std::vector<double> sinGraze;    // Sine of the grazing angle
+   std::vector<double> tanDep;      // Tangent of the depression angle (positive down)
+
+   // Sweep stamps: ownship position, heading and range when computed
+   std::vector<base::Vec3d> swPos;  // Ownship ECEF position (m)
+   std::vector<double> swHdg;       // Ownship true heading (degs)
+   std::vector<double> swRng;       // Max range (m)
+   std::vector<bool> swValid;       // Sweep has been computed
+
+   // Cached two-way gains: cells' gain^2 * rcsR4 (m^-2), and the gimbal position
+   // and ownship attitude (roll, pitch, heading) they were computed for (rad)
+   std::vector<double> g2R4;
+   std::vector<base::Vec3d> gnGimbal;
+   std::vector<base::Vec3d> gnOwnship;
+   std::vector<bool> gnValid;       // Sweep's gains have been computed
+
+   // Work arrays
+   std::vector<double> elev;
+   std::unique_ptr<bool[]> elevValid;
+
+   unsigned int numCells {};        // Cells computed
+};
+
+}
+}
+
+#endif
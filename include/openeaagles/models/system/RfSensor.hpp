@@ -117,6 +117,8 @@ public:
     virtual bool event(const int event, base::Object* const obj = nullptr) override;
     virtual void updateData(const double dt = 0.0) override;
     virtual void reset() override;
+    virtual void saveState(base::Checkpoint* const cp) const override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
     virtual base::PairStream* getModes();                              // Returns the list of submodes
@@ -27,6 +27,13 @@ class Emission;
 //    various R/F systems to use or not use this gimbal function -- our default
 //    member function processPlayersOfInterest() does use the gimbal function.
 //
+//    2) Received emissions are queued by rfReceivedEmission() into an input
+//    buffer.  Our derived classes' receive() takes all of them at once with
+//    takeReceivedEmissions(), which swaps the input buffer with a second
+//    buffer while holding the packet semaphore just once, processes the
+//    taken buffer, without the semaphore, as a batch, and then returns the
+//    buffer with releaseReceivedEmissions().
+//
 // Factory name: RfSystem
 // Slots:
 //    antennaName        <base::String>        ! Name of the requested Antenna
@@ -136,6 +143,8 @@ public:
 
    virtual void updateData(const double dt = 0.0) override;
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    // Max size of emission queues (per frame)
@@ -144,12 +153,22 @@ protected:
    // Compute receiver thermal noise
    virtual bool computeReceiverNoise();
 
+   // Buffer of emission packets being passed from rfReceivedEmission() to receive()
+   struct EmissionBuffer {
+      unsigned int n {};                                // Number of emission packets
+      std::array<double, MAX_EMISSIONS> signals {};     // Signal values
+      std::array<Emission*, MAX_EMISSIONS> packets {};  // Emission packets (ref()'d)
+   };
+
+   // Takes all of the received emission packets, in the order that they were
+   // received, by swapping the input buffer; return the buffer, when finished
+   // with it, using releaseReceivedEmissions().
+   EmissionBuffer* takeReceivedEmissions();
+   void releaseReceivedEmissions(EmissionBuffer* const buff);   // unref()s the packets and empties the buffer
+
    // The following are filled by rfReceivedEmission() and consumed (emptied) by receive()
    double jamSignal {};                              // Interference signal (from Jammer)
-   unsigned int np {};                               // Number of emission packets being passed from rfReceivedEmission() to receive()
-   std::array<double, MAX_EMISSIONS> signals {};     // signals values being passed from rfReceivedEmission() to receive()
-   std::array<Emission*, MAX_EMISSIONS> packets {};  // emission packets being passed from rfReceivedEmission() to receive()
-   mutable long packetLock {};                       // Semaphore to protect 'signals' and 'xxpackets
+   mutable long packetLock {};                       // Semaphore to protect the input buffer
 
    // Process players of interest -- Called by our updateData() -- the background thread --
    // This function will create a filtered list of players that R/F systems will interact with.
@@ -181,6 +200,9 @@ private:
    double rfLossXmit {1.0};          // Transmit loss (default: 1.0)             (no units)
    double rfLossRecv {1.0};          // Receive loss (default: 1.0)              (no units)
    double rfLossSignalProcess {1.0}; // Signal Processing loss (default: 1.0)    (no units)
+
+   std::array<EmissionBuffer, 2> rcvBuffers;  // Received emission buffers
+   unsigned int inBuffer {};                  // Index of the input buffer (filled by rfReceivedEmission())
 };
 
 }
@@ -6,9 +6,10 @@
 #include "openeaagles/base/osg/Vec3d"
 
 namespace oe {
-namespace base { class Pair; class PairStream; }
+namespace base { class Pair; class PairStream; class ThreadPool; }
 namespace models {
 class Image;
+class SarChip;
 
 //------------------------------------------------------------------------------
 // Class: Sar
@@ -16,7 +17,23 @@ class Image;
 // Description: Generic SAR
 // Factory name: Sar
 // Slots:
-//    chipSize      <base::Number>      ! Chip size (pixels) (default: 0)
+//    chipSize          <base::Number>  ! Chip size (pixels) (default: 0)
+//    numImageThreads   <base::Number>  ! Number of image rendering threads (default: 0)
+//
+//    At the end of the imaging time, a SarChip job -- a snapshot of the look
+//    geometry, the stare point, the terrain database and the RCS of the players
+//    within the chip -- is created and rendered into an Image off of the T/C
+//    thread.  The images are square (chipSize x chipSize) when 'chipSize' is set,
+//    otherwise they are the size requested by requestImage().
+//
+//    The T/C thread never waits on the renderers: the chip is posted to a single
+//    entry mailbox, which our background thread (updateData()) empties.  With
+//    'numImageThreads' set to zero, the background thread renders the chip
+//    itself, otherwise it's handed to a pool of that many threads, which is
+//    created by the background thread on its first update.  A chip is only handed
+//    to the pool once the pool's previous chip is idle; starting a new image
+//    cancels the previous chip, and replaces it in the mailbox if it hasn't been
+//    handed off yet.
 //
 //------------------------------------------------------------------------------
 class Sar : public Radar
@@ -58,8 +75,13 @@ public:
    unsigned int getChipSize() const        { return chipSize; }
    virtual bool setChipSize(const unsigned int pixels);
 
+   // Number of image rendering threads
+   unsigned int getNumImageThreads() const { return numImageThreads; }
+   virtual bool setNumImageThreads(const unsigned int n);
+
    // Slot functions
    virtual bool setSlotChipSize(const base::Number* const msg);
+   virtual bool setSlotNumImageThreads(const base::Number* const msg);
 
    // Request a new image
    virtual bool  requestImage(
@@ -77,14 +99,23 @@ public:
    static void xyz2AzEl(const double x, const double y, const double z, double* const az, double* const el);
    static void xyz2AzEl(const base::Vec3d& vec, double* const az, double* const el);
 
+   virtual void updateData(const double dt = 0.0) override;
+   virtual void reset() override;
+
 protected:
    virtual bool setResolution(const double res);   // SAR resolution (meters)
 
    virtual void process(const double dt) override;
 
+   virtual void startImage();       // Creates and starts rendering the image chip
+   virtual void finishImage();      // Adds the rendered image chip to our list of images
+
    double timer {};                 // SAR timer
 
 private:
+   void clearChips();
+   void destroyPool();
+
    base::PairStream* imgList {};    // List of SAR images
 
    int          nextId {1};         // Next image ID
@@ -98,6 +129,13 @@ private:
 
    unsigned int width {};           // Image width (pixels)
    unsigned int height {};          // Image height (pixels)
+
+   SarChip* chip {};                // Image chip being rendered (T/C thread)
+   SarChip* pendingChip {};         // Mailbox: image chip waiting to be rendered
+   mutable long chipLock {};        // Semaphore to protect 'pendingChip'
+   SarChip* poolChip {};            // Image chip handed to the thread pool (background thread)
+   base::ThreadPool* pool {};       // Image rendering thread pool (background thread)
+   unsigned int numImageThreads {}; // Number of image rendering threads
 };
 
 }
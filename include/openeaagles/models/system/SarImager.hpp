@@ -0,0 +1,155 @@
+#ifndef __oe_models_SarImager_H__
+#define __oe_models_SarImager_H__
+
+#include "openeaagles/base/concurrent/ThreadPoolManager.hpp"
+#include "openeaagles/base/osg/Vec3d"
+
+#include <vector>
+
+namespace oe {
+namespace terrain { class Terrain; }
+namespace models {
+class RfSignature;
+
+//------------------------------------------------------------------------------
+// Class: SarChip
+//
+// Description: A single SAR image chip job; a snapshot of the imaging geometry
+//              taken by the Sar at the end of its imaging time, and the chip's
+//              image buffer, which is filled in by one or more SarImager threads.
+//
+//    The chip is a square (width x height) grid centered on the stare point with
+//    'resolution' meters per pixel.  Rows are range, with row zero at far range,
+//    and columns are cross-range, left to right as seen from the sensor.  The
+//    image orientation is the true bearing of the look direction.
+//
+//    Each column is a range line that is rendered independently:
+//       1) terrain elevations along the range line (Terrain::getElevations()),
+//       2) shadowing by a running max of the terrain's look angle from the sensor,
+//       3) constant-gamma backscatter using the local grazing angle,
+//       4) layover; returns are binned by slant range, projected onto the flat
+//          plane at the stare point elevation, so returns from tall terrain
+//          fall into nearer range bins,
+//       5) point returns from the chip's target players.
+//
+//    The targets are snapshots of the players' positions, signatures and angles
+//    of incidence; their RCS is sampled by the thread that renders the target's
+//    column, so the signatures aren't queried on the T/C thread.
+//
+//    Columns are handed out in bands, so any number of threads can render the
+//    same chip.  The last band to finish marks the chip done.  A canceled chip
+//    hands out no more bands, and is never done; it's idle once the bands that
+//    were already claimed have been rendered.
+//------------------------------------------------------------------------------
+class SarChip : public base::Object
+{
+   DECLARE_SUBCLASS(SarChip, base::Object)
+
+public:
+   // Point target (e.g., player) within the chip
+   struct Target {
+      base::Vec3d pos;        // Position; NED from the gaming area ref point (m)
+      RfSignature* sig {};    // Signature (ref()'d)
+      double az {};           // Angles of incidence; the LOS back to the sensor in
+      double el {};           //    the target's body coordinates (radians)
+   };
+
+   static const unsigned int BAND_SIZE = 16;   // Columns per band
+
+public:
+   SarChip();
+
+   // Sets up the chip; clears targets and the image
+   void setup(
+      const unsigned int width,              // Image width (pixels)
+      const unsigned int height,             // Image height (pixels)
+      const double resolution,               // Resolution (meters/pixel)
+      const base::Vec3d& sensorPos,          // Sensor position; NED (m)
+      const base::Vec3d& starePos,           // Stare point; NED (m)
+      const double refLat,                   // Gaming area ref latitude (degs)
+      const double refLon,                   // Gaming area ref longitude (degs)
+      const double freq,                     // Sensor frequency (Hz)
+      const terrain::Terrain* const terrain  // Terrain database (or zero for flat earth)
+   );
+
+   void addTarget(const base::Vec3d& pos, RfSignature* const sig, const double az, const double el);
+
+   unsigned int getWidth() const                  { return width; }
+   unsigned int getHeight() const                 { return height; }
+   double getResolution() const                   { return resolution; }
+   double getLookBearing() const                  { return lookBrg; }    // True bearing of the look direction (radians)
+   const unsigned char* getImageData() const      { return image.data(); }
+
+   // True when all columns have been rendered
+   bool isDone() const;
+
+   // True when no thread is rendering a band of the chip
+   bool isIdle() const;
+
+   // Cancels the chip; no more bands are handed out
+   void cancel();
+
+   // Renders bands of columns until there are none left; can be called
+   // from any number of threads.
+   void render();
+
+private:
+   void clearTargets();
+   bool claimBand(unsigned int* const c0, unsigned int* const c1);
+   void bandDone(const unsigned int n);
+   void renderColumn(
+      const unsigned int c,
+      double* const elev,
+      bool* const valid,
+      double* const maxSlope,
+      double* const acc
+   );
+
+   // Imaging geometry
+   unsigned int width {};              // Image width: cross-range (pixels)
+   unsigned int height {};             // Image height: range (pixels)
+   double resolution {1.0};            // Meters per pixel
+   base::Vec3d sensorPos;              // Sensor position; NED (m)
+   base::Vec3d starePos;               // Stare point; NED (m)
+   double refLat {};                   // Gaming area ref latitude (degs)
+   double refLon {};                   // Gaming area ref longitude (degs)
+   double freq {};                     // Sensor frequency (Hz)
+   double lookBrg {};                  // Look direction; true bearing (radians)
+   double cosBrg {1.0};                // cos(lookBrg)
+   double sinBrg {};                   // sin(lookBrg)
+   const terrain::Terrain* terrain {}; // Terrain database (ref()'d)
+   std::vector<Target> targets;        // Point targets
+
+   // Image
+   std::vector<unsigned char> image;   // Gray scale image (width * height)
+
+   // Band management
+   unsigned int nextColumn {};         // Next column to render
+   unsigned int columnsDone {};        // Number of columns rendered
+   unsigned int columnsClaimed {};     // Number of columns handed out
+   mutable long bandLock {};           // Semaphore for the band counters
+};
+
+//------------------------------------------------------------------------------
+// Class: SarImager
+//
+// Description: Thread pool manager used by Sar to render SarChips on a
+//              base::ThreadPool.  The SarChip is passed as the pool's "current"
+//              callback object, and it must be ref()'d once for each execute();
+//              the chip is unref()'d when the thread is done with it.
+//------------------------------------------------------------------------------
+class SarImager : public base::ThreadPoolManager
+{
+   DECLARE_SUBCLASS(SarImager, base::ThreadPoolManager)
+
+public:
+   SarImager();
+
+protected:
+   virtual void execute(base::Object* const obj, base::Object* cur) override;
+};
+
+}
+}
+
+#endif
@@ -205,6 +205,8 @@ public:
     // Component Interface
     virtual bool event(const int event, base::Object* const obj = nullptr) override;
     virtual void reset() override;
+    virtual void saveState(base::Checkpoint* const cp) const override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual void scanController(const double dt);
@@ -122,6 +122,8 @@ public:
    virtual bool onWpnReload();
 
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual bool setSlotStores(const base::PairStream* const msg) override;
@@ -207,6 +209,8 @@ public:
    virtual Decoy* releaseOneDecoy() override;
 
    virtual void updateData(const double dt = 0.0) override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual void process(const double dt) override;
@@ -4,8 +4,10 @@
 
 #include "openeaagles/base/Component.hpp"
 
+#include <atomic>
+
 namespace oe {
-namespace base { class String; }
+namespace base { class Distance; class Number; class String; }
 namespace models {
 class WorldModel;
 class Player;
@@ -20,6 +22,14 @@ class Player;
 // Slots:
 //    powerSwitch    <base::String>   ! Power switch position ("OFF", "STBY", "ON") (default: "ON")
 //
+//    ratePolicy     <base::String>   ! Update rate policy ("full", "fixed", "ownship", "sensor", "demand")
+//                                    ! (default: "full") (see note 4)
+//
+//    rateDivisor    <base::Number>   ! Frames per update at the reduced rate (default: 1)
+//
+//    rateRange      <base::Distance> ! Range beyond which the "ownship" and "sensor" policies use the
+//                                    ! reduced rate (default: 0)
+//
 //
 // Events:
 //    KILL_EVENT        ()       Process a (we were just) killed events
@@ -52,6 +62,29 @@ class Player;
 //       have created, and to unref() objects that can't wait until deleteData()
 //       (e.g., circular references).  (see Component::shutdownNotification())
 //
+//    4) Update rate policies -- A system, and its subcomponents, can be updated
+//       at less than the full frame rate.  Its frames are skipped as a whole
+//       (all four phases), and when it does run, the delta times passed to its
+//       updateTC() and phase callbacks cover all of the frames since it last
+//       ran; updateData() is only called after a time-critical update, with
+//       the delta time since its last call.
+//
+//          "full"    -- every frame (default)
+//          "fixed"   -- every 'rateDivisor' frames
+//          "ownship" -- every frame if our player is within 'rateRange' of the
+//                       station's ownship player, else every 'rateDivisor' frames
+//          "sensor"  -- every frame if our player is within 'rateRange' of
+//                       another active player with an R/F sensor, else every
+//                       'rateDivisor' frames
+//          "demand"  -- only the frame after requestUpdate() has been called,
+//                       or at least every 'rateDivisor' frames if it's greater
+//                       than one
+//
+//       The ranges are from the players' positions at the start of the frame
+//       (see WorldModel::getRateRefRange()), and are checked when the system
+//       runs, so a system that's using the reduced rate may take up to
+//       'rateDivisor' frames to return to the full rate.
+//
 //------------------------------------------------------------------------------
 class System : public base::Component
 {
@@ -69,9 +102,20 @@ public:
 public:
    System();
 
+   // Update rate policies (see note 4)
+   enum { RATE_FULL, RATE_FIXED, RATE_OWNSHIP, RATE_SENSOR, RATE_DEMAND };
+
    virtual unsigned int getPowerSwitch() const;          // Returns the system's master power switch setting (see power enumeration)
    virtual bool setPowerSwitch(const unsigned int p);    // Sets the system's master power switch setting (see power enumeration)
 
+   unsigned int getRatePolicy() const;                   // Update rate policy (see rate enumeration)
+   unsigned int getRateDivisor() const;                  // Frames per update at the reduced rate
+   double getRateRange() const;                          // Range for the reduced rate (meters)
+   virtual bool setRatePolicy(const unsigned int p);
+   virtual bool setRateDivisor(const unsigned int n);
+   virtual bool setRateRange(const double m);
+   void requestUpdate();                                 // Requests an update next frame ("demand" policy); from any thread
+
    // Event handler(s)
    virtual bool killedNotification(Player* const killedBy = 0); // Killed (KILL_EVENT) event handler
 
@@ -83,6 +127,8 @@ public:
    virtual bool event(const int event, base::Object* const obj = nullptr) override;
    virtual void reset() override;
    virtual bool isFrozen() const override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    virtual WorldModel* getWorldModel();
@@ -90,6 +136,13 @@ protected:
 
    // Slot function(s)
    virtual bool setSlotPowerSwitch(const base::String* const msg);
+   virtual bool setSlotRatePolicy(const base::String* const msg);
+   virtual bool setSlotRateDivisor(const base::Number* const msg);
+   virtual bool setSlotRateRange(const base::Distance* const msg);
+
+   // Update rate control
+   virtual bool isTcFrameDue(double* const dt) override;
+   virtual bool isDataFrameDue(double* const dt) override;
 
    // Time critical phase callbacks --
    // --- to be used by the derived classes, as needed
@@ -100,9 +153,22 @@ protected:
 
 private:
    bool findOwnship();
+   unsigned int computeRateDivisor();
 
    Player* ownship {};           // Our player (not ref()'d because the own player owns us).
    unsigned int pwrSw {PWR_ON};  // System's master power switch
+
+   // Update rate
+   unsigned int ratePolicy {RATE_FULL}; // Update rate policy
+   unsigned int rateDiv {1};            // Frames per update at the reduced rate
+   double rateRng {};                   // Range for the reduced rate (meters)
+   unsigned int rateCurDiv {1};         // Current frames per update
+   unsigned int rateFrames {};          // Frames since our last update
+   double rateDt {};                    // Time since our last update (phase delta time)
+   double rateDataDt {};                // Time since our last background update
+   bool rateRun {true};                 // Running this frame
+   std::atomic<bool> rateDataDue {};    // Time-critical update since our last background update
+   std::atomic<bool> rateDemand {};     // Update requested ("demand" policy)
 };
 
 }
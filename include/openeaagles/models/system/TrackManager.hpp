@@ -72,9 +72,15 @@ public:
    // Add a new emission report (RF track managers only)
    virtual void newReport(Emission* em, double snDbl);
 
+   // Add a batch of 'n' new emission reports (RF track managers only); derived
+   // classes that override newReport() should also override newReports()
+   virtual void newReports(Emission* const* const ems, const double* const snDbl, const unsigned int n);
+
    virtual bool killedNotification(Player* const killedBy = 0) override;
 
    virtual void reset() override;
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
 
 protected:
    static const unsigned int MAX_TRKS = OE_CONFIG_MAX_TRACKS;         // Max tracks
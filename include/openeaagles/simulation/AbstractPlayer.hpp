@@ -95,6 +95,9 @@ public:
 
    virtual void reset() override;
 
+   virtual void saveState(base::Checkpoint* const cp) const override;
+   virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
+
 protected:
 
    virtual bool shutdownNotification() override;
@@ -0,0 +1,171 @@
+
+#ifndef __oe_simulation_BatchRunner_H__
+#define __oe_simulation_BatchRunner_H__
+
+#include "openeaagles/base/Component.hpp"
+
+#include <atomic>
+#include <iosfwd>
+#include <vector>
+
+namespace oe {
+namespace base { class List; class Number; class String; class Time; }
+namespace simulation {
+class Station;
+
+//------------------------------------------------------------------------------
+// Class: BatchRunner
+//
+// Description: Headless, faster-than-real-time batch executive for Monte Carlo
+//              studies; runs a number of independent replications of one
+//              station configuration, several at a time, in a single process.
+//
+//    Each replication runs a clone() of the 'station' prototype.  The clone is
+//    reset and then its frames are run back to back, without wall clock pacing
+//    and without the station's T/C, network or background threads: each frame
+//    calls the station's tcFrame() and processBackgroundTasks() functions, and
+//    processes the data recorder's records.  The station's networks are not
+//    used.  A replication runs for 'runTime' simulated seconds, or until
+//    isReplicationDone() returns true.
+//
+//    Replications are run by 'threads' threads (the calling thread is one of
+//    them), each taking the next replication index until all have been run.
+//    Replication 'i' seeds its thread's random number stream (see base::Rng)
+//    with 'seed + i' before the station is cloned and reset, and then seeds
+//    the streams of its simulation's T/C and background pool threads with
+//    'seed + i' and their indexes (see Simulation::seedRngStreams()), so a
+//    replication's results do not depend on the number of threads or the
+//    order in which the replications are run.
+//
+//    If a checkpoint has been set (see setCheckpoint() and slot 'checkpoint'),
+//    each replication restores it into its simulation after the reset (see
+//    Simulation::restore()), and then seeds its random number streams, so all
+//    of the replications branch from the checkpoint.  The replications share
+//    the one checkpoint, which isn't changed by restoring it, and each has its
+//    own objects.  The replication's 'runTime' starts at the checkpoint.
+//
+//    The statistics of the last run, including its throughput in simulated
+//    seconds per wall clock second per core, are available from the get
+//    functions and printStats().
+//
+//    Derived classes can override replicationStarted(), isReplicationDone()
+//    and replicationCompleted() to set up each replication and to collect its
+//    results; these are called from the replication's thread.
+//
+//    Notes:
+//       1) Configure the prototype's simulation with one T/C and one
+//          background thread (the default); the replications are already
+//          running in parallel.
+//       2) Process wide state, such as base::Timer's timer list (station slot
+//          'enableUpdateTimers'), is shared by all replications.
+//
+// Factory name: BatchRunner
+// Slots:
+//    station        <Station>         ! Station prototype; each replication runs a clone (default: nullptr)
+//    replications   <base::Number>    ! Number of replications (default: 1)
+//    threads        <base::Number>    ! Number of replications to run at a time (default: 0 -- one per processor)
+//    seed           <base::Number>    ! Random number seed of the first replication (default: 5489)
+//    runTime        <base::Time>      ! Simulated run time of each replication (default: 60 seconds)
+//    rate           <base::Number>    ! Frame rate (Hz) (default: 0 -- the station's 'tcRate')
+//    cpus           <base::List>      ! Processor set of the batch threads (default: [ ] -- any processor)
+//    checkpoint     <base::String>    ! Checkpoint file to branch each replication from (default: none)
+//
+// Example:
+//
+//    ( BatchRunner
+//       replications: 500
+//       seed: 1234
+//       runTime: ( Minutes 20 )
+//       station: ( Station ... )
+//    )
+//------------------------------------------------------------------------------
+class BatchRunner : public base::Component
+{
+   DECLARE_SUBCLASS(BatchRunner, base::Component)
+
+public:
+   static const unsigned int DEFAULT_SEED = 5489;
+
+public:
+   BatchRunner();
+
+   const Station* getStation() const;                          // Station prototype
+   unsigned int getNumReplications() const;                    // Number of replications
+   unsigned int getNumThreads() const;                         // Number of threads (zero for one per processor)
+   unsigned int getSeed() const;                               // Random number seed of the first replication
+   double getRunTime() const;                                  // Simulated run time of each replication (sec)
+   double getRate() const;                                     // Frame rate (Hz) (zero for the station's rate)
+   const std::vector<unsigned int>& getCpus() const;           // Processor set (empty for any)
+   const base::Checkpoint* getCheckpoint() const;              // Checkpoint to branch from (or zero)
+
+   virtual bool setStation(Station* const s);
+   virtual bool setNumReplications(const unsigned int n);
+   virtual bool setNumThreads(const unsigned int n);
+   virtual bool setSeed(const unsigned int s);
+   virtual bool setRunTime(const double sec);
+   virtual bool setRate(const double hz);
+   virtual bool setCpus(const std::vector<unsigned int>& cpus);
+   virtual bool setCheckpoint(const base::Checkpoint* const cp);
+
+   // Runs all of the replications; returns when they've all completed.
+   // Returns true if all of the replications were run.
+   virtual bool run();
+
+   // Statistics of the last run
+   unsigned int getNumCompleted() const;                       // Number of replications completed
+   unsigned int getNumThreadsUsed() const;                     // Number of threads used
+   double getSimulatedTime() const;                            // Total simulated time of all replications (sec)
+   double getWallTime() const;                                 // Wall clock time of the run (sec)
+   double getThroughput() const;                               // Simulated seconds per wall clock second per core
+   void printStats(std::ostream& sout) const;
+
+   // Runs the next replications until there are none left (called by our batch threads)
+   void runReplications();
+
+   // Slot functions
+   virtual bool setSlotStation(Station* const s);
+   virtual bool setSlotReplications(const base::Number* const num);
+   virtual bool setSlotThreads(const base::Number* const num);
+   virtual bool setSlotSeed(const base::Number* const num);
+   virtual bool setSlotRunTime(const base::Time* const msg);
+   virtual bool setSlotRate(const base::Number* const num);
+   virtual bool setSlotCpus(const base::List* const msg);
+   virtual bool setSlotCheckpoint(const base::String* const msg);
+
+protected:
+   // Replication 'idx' has been reset and is about to run its first frame
+   virtual void replicationStarted(const unsigned int idx, Station* const s);
+
+   // Has replication 'idx' completed early?  (checked after each frame)
+   virtual bool isReplicationDone(const unsigned int idx, const Station* const s) const;
+
+   // Replication 'idx' has completed; called before its station is shutdown
+   virtual void replicationCompleted(const unsigned int idx, Station* const s);
+
+   // Runs replication 'idx'; returns the simulated time (sec)
+   virtual double runReplication(const unsigned int idx);
+
+private:
+   Station* station {};                       // Station prototype
+   unsigned int numReps {1};                  // Number of replications
+   unsigned int numThreads {};                // Number of threads (zero for one per processor)
+   unsigned int seed0 {DEFAULT_SEED};         // Random number seed of the first replication
+   double runTime {60.0};                     // Simulated run time of each replication (sec)
+   double rate {};                            // Frame rate (Hz) (zero for the station's rate)
+   std::vector<unsigned int> cpus;            // Processor set (empty for any)
+   const base::Checkpoint* checkpoint {};     // Checkpoint to branch from (ref()'d)
+
+   // Run data
+   std::atomic<unsigned int> nextRep {};      // Next replication to run
+   std::atomic<unsigned int> numCompleted {}; // Number of replications completed
+   std::atomic<unsigned int> threadsDone {};  // Number of batch threads that are done
+   long simTimeLock {};                       // Semaphore for 'simTime'
+   double simTime {};                         // Total simulated time (sec)
+   double wallTime {};                        // Wall clock time of the last run (sec)
+   unsigned int threadsUsed {};               // Number of threads used by the last run
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,24 @@
+
+#ifndef __oe_simulation_BatchThread_H__
+#define __oe_simulation_BatchThread_H__
+
+#include "openeaagles/base/concurrent/SingleTask.hpp"
+
+namespace oe {
+namespace simulation {
+class BatchRunner;
+
+// ---
+// Batch thread; runs BatchRunner replications until there are none left
+// ---
+class BatchThread : public base::SingleTask
+{
+   DECLARE_SUBCLASS(BatchThread, base::SingleTask)
+   public: BatchThread(BatchRunner* const parent, const double priority);
+   private: virtual unsigned long userFunc() override;
+};
+
+}
+}
+
+#endif
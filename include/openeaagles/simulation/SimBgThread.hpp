@@ -19,6 +19,15 @@ class SimBgThread : public base::SyncTask
 public:
    SimBgThread(base::Component* const parent, const double priority);
 
+   // Sets the parameters for the next start; used with a shared
+   // PhaseBarrier (see base::SyncTask), which then signals the start.
+   void setup(
+      base::PairStream* const pl0,
+      const double dt0,
+      const unsigned int idx0,
+      const unsigned int n0
+   );
+
    // Parent thread signals start to this child thread with these parameters.
    void start(
       base::PairStream* const pl0,
@@ -3,12 +3,15 @@
 #define __oe_simulation_Simulation_H__
 
 #include "openeaagles/base/Component.hpp"
-#include "openeaagles/base/safe_queue.hpp"
+#include "openeaagles/base/mpsc_queue.hpp"
+#include "openeaagles/base/concurrent/PhaseBarrier.hpp"
 #include "openeaagles/base/osg/Matrixd"
 #include <array>
+#include <atomic>
+#include <vector>
 
 namespace oe {
-namespace base { class Distance; class EarthModel; class LatLon; class Pair; class Time; }
+namespace base { class Distance; class EarthModel; class LatLon; class List; class Pair; class Time; }
 namespace simulation {
 class AbstractDataRecorder;
 class SimBgThread;
@@ -50,6 +53,11 @@ class AbstractPlayer;
 //                                            !   default: 1 -- no additional threads)
 //                                            !   range: [ 1 .. (#CPUs-1) ]; minimum of one
 //
+//    tcThreadCpus   <base::List>             ! Processors for the T/C thread pool; each pool thread is
+//                                            !   pinned to one of these processors (default: [ ] -- any)
+//
+//    bgThreadCpus   <base::List>             ! Processors for the background thread pool (default: [ ] -- any)
+//
 //
 // The player list
 //
@@ -57,7 +65,10 @@ class AbstractPlayer;
 //
 //    b) You can request a new player to be added to the player list by
 //       using addNewPlayer(), however the player will not be added until
-//       updatePlayerList() is run in the background thread.
+//       updatePlayerList() is run in the background thread.  New players are
+//       put on a lock-free queue, so addNewPlayer() can be called from any
+//       thread (e.g., T/C threads releasing weapons, network threads) without
+//       blocking; up to MAX_NEW_PLAYERS can be waiting at a time.
 //
 //    c) You can request a player to be removed from the list by setting
 //       the player's mode to DELETE_REQUEST.  Again, the player will not
@@ -74,7 +85,13 @@ class AbstractPlayer;
 //
 //    f) To ensure a stable player list throughout the time-critical and background
 //       frames, the player list is ref() before and unref() after the player list
-//       is traversed in both the updateTC() and updateData() functions.
+//       is traversed in both the updateTC() and updateData() functions.  A list
+//       is never changed once it's been swapped in: updatePlayerList() builds a
+//       new list, with one sorted merge of the current list and the new players,
+//       and then swaps it, so the list returned by getPlayers() is a consistent
+//       snapshot for as long as it's held.  getPlayerListVersion() changes each
+//       time the list is swapped, so users can tell when their snapshot, or
+//       anything they've derived from it, is out of date.
 //
 //    g) You can find players on the list by Player ID [plus Net ID], findPlayer(),
 //       or by name using findPlayerByName().
@@ -96,12 +113,21 @@ class AbstractPlayer;
 //    Use cycle(), frame() and phase() to get the current values, and use getExecCounter()
 //    to get the total number of phases since the start of the exec.
 //
+//    After all of the players have been updated for a phase, and before the next
+//    phase is started, tcPhaseCompleted() is called from the main T/C thread, so
+//    derived classes can exchange data between players (e.g., the models world
+//    model's RF channel) while no player is being updated.  Likewise,
+//    tcPhaseStarting() is called before any player is updated for a phase
+//    (e.g., the models world model's fleet dynamics).
+//
 //
 // Multiple time critical and background threads:
 //
 //    Use the 'numTcThreads' and 'numBgThreads' slots, you can request the number of
 //    threads to traverse the player list.  These threads will each process a subset
 //    of players.  The T/C threads rejoin at the end of each phase (see phases above).
+//    Each pool shares a single base::PhaseBarrier, so a phase is one start and one
+//    wait for the whole pool, rather than a start and wait for each thread.
 //
 //    There is overhead with managing threads, so this is effective only with
 //    a larger number of players.  The trade off point is dependent on the
@@ -115,6 +141,19 @@ class AbstractPlayer;
 //             This leaves a CPU for the operating system, other applications
 //             and our other threads.
 //
+//    The 'tcThreadCpus' and 'bgThreadCpus' slots pin each pool thread to a single
+//    processor.  The processors are ordered by NUMA node, starting with the node
+//    of the first processor in the list, so that a pool fills one node before it
+//    spills onto the next.  If there are more pool threads than processors, then
+//    the processors are reused in the same order.  Use the Station's 'tcCpus' and
+//    'bgCpus' slots to place the Station's T/C and background threads, which
+//    process their own share of the player list, on the same node as their pools.
+//
+//    Each pool thread draws from its own random number stream (see base::Rng),
+//    which is seeded, as the thread is created, with the creating thread's seed
+//    and the thread's index in its pool.  Use seedRngStreams() to reseed them
+//    (e.g., for each run of a BatchRunner).
+//
 //
 // Time and Date:
 //
@@ -153,6 +192,30 @@ class AbstractPlayer;
 //       c) To uniquely set player IDs for newly released weapons, use getNewReleasedWeaponID()
 //
 //
+// Checkpoint and restore:
+//
+//    checkpoint() saves the dynamic state of the simulation (cycle, frame and
+//    phase counters, times and event IDs), the random number streams of the
+//    calling thread and of each pool thread (see base::Rng), and the state of
+//    each local player, by name, into
+//    a base::Checkpoint.  restore() restores a checkpoint into a simulation
+//    that was reset() from the same configuration (e.g., a clone of the
+//    original), which is much faster than re-running the scenario up to the
+//    checkpoint.  Local players that are not in the checkpoint (e.g., they
+//    were removed before the checkpoint) are removed.  Players in the
+//    checkpoint that we don't have (e.g., weapons released before the
+//    checkpoint) are recreated from their origins, which are saved ahead of
+//    their state (see saveOrigin() and recreatePlayer()).  Networked players
+//    are owned by the networks and are not saved.
+//
+//    restore() fails, leaving the simulation in an unknown state, if any of the
+//    checkpoint's players can't be found or recreated, or if any part of the
+//    checkpoint doesn't match our objects.
+//
+//    A checkpoint isn't changed by restoring it, so one checkpoint can be used
+//    to branch any number of runs, at the same time (see BatchRunner).
+//
+//
 // Shutdown:
 //
 //    At shutdown, the parent object must send a SHUTDOWN_EVENT event to
@@ -176,6 +239,7 @@ public:
 
     base::PairStream* getPlayers();                // Returns the player list; pre-ref()'d
     const base::PairStream* getPlayers() const;    // Returns the player list; pre-ref()'d (const version)
+    unsigned int getPlayerListVersion() const;     // Player list version; changes each time the list is changed
 
     unsigned int cycle() const;                    // Cycle counter; each cycle represents 16 frames.
     unsigned int frame() const;                    // Frame counter [0 .. 15]; each frame represents a call to our updateTC()
@@ -217,6 +281,19 @@ public:
     virtual void updateData(const double dt = 0.0) override;
     virtual void reset() override;
 
+    // Checkpoint and restore (see above)
+    base::Checkpoint* checkpoint() const;           // Pre-ref()'d checkpoint of our state
+    bool restore(const base::Checkpoint* const cp); // Restores a checkpoint; returns false if it's invalid or doesn't match
+
+    virtual void saveState(base::Checkpoint* const cp) const override;
+    virtual bool restoreState(base::Checkpoint::Reader* const rd) override;
+
+    // Seeds the random number streams of our T/C and background pool threads (see above)
+    void seedRngStreams(const unsigned int seed);
+
+    // Also finds our players' names
+    virtual const base::Identifier* findNameOfComponent(const base::Component* const p) const override;
+
 public:
     void updateTcPlayerList(
        base::PairStream* const playerList,
@@ -234,6 +311,8 @@ public:
 
 protected:
     virtual void updatePlayerList();                  // Updates the current player list
+    virtual void tcPhaseStarting(base::PairStream* const playerList, const unsigned int phase, const double dt); // No player has been updated for this phase
+    virtual void tcPhaseCompleted(base::PairStream* const playerList, const unsigned int phase); // All players have been updated for this phase
     bool setSlotPlayers(base::PairStream* const msg);
 
     virtual void incCycle();                          // Increments the cycle counter
@@ -244,6 +323,11 @@ protected:
     virtual void setEventID(unsigned short id);       // Sets the simulation event ID counter
     virtual void setWeaponEventID(unsigned short id); // Sets the weapon ID event counter
 
+    // Checkpoint support: saves what's needed to recreate player 'ip', and
+    // recreates a player from it (pre-ref()'d, or zero if it can't)
+    virtual void saveOrigin(const AbstractPlayer* const ip, base::Checkpoint* const cp) const;
+    virtual AbstractPlayer* recreatePlayer(base::Checkpoint::Reader* const rd);
+
     virtual void printTimingStats() override;
     virtual bool shutdownNotification() override;
 
@@ -251,6 +335,8 @@ private:
    Station* getStationImp();
 
    bool insertPlayerSort(base::Pair* const newPlayer, base::PairStream* const newList);
+   static bool isPlayerBefore(const AbstractPlayer* const p1, const AbstractPlayer* const p2);
+   static std::vector<unsigned int> numaOrder(const std::vector<unsigned int>& cpus);
    AbstractPlayer* findPlayerPrivate(const short id, const int netID) const;
    AbstractPlayer* findPlayerByNamePrivate(const char* const playerName) const;
 
@@ -263,6 +349,8 @@ private:
 
    bool setSlotNumTcThreads(const base::Number* const msg);
    bool setSlotNumBgThreads(const base::Number* const msg);
+   bool setSlotTcThreadCpus(const base::List* const msg);
+   bool setSlotBgThreadCpus(const base::List* const msg);
 
    base::safe_ptr<base::PairStream> players;     // Main player list (sorted by network and player IDs)
    base::safe_ptr<base::PairStream> origPlayers; // Original player list
@@ -291,7 +379,8 @@ private:
    unsigned short eventWpnID {};           // Weapon event ID
    unsigned short relWpnId {MIN_WPN_ID};   // Current released weapon ID
 
-   base::safe_queue<base::Pair*> newPlayerQueue;   // Queue of new players
+   base::mpsc_queue<base::Pair*> newPlayerQueue;   // Queue of new players (lock-free; put from any thread)
+   std::atomic<unsigned int> playerListVersion {}; // Player list version; changes each time the list is swapped
 
    Station* station {};          // The Station that owns us (not ref()'d)
 
@@ -301,13 +390,19 @@ private:
    unsigned int reqTcThreads {1};                          // Requested number of threads
    unsigned int numTcThreads {};                           // Number of threads in pool; should be (reqTcThreads - 1)
    bool tcThreadsFailed {};                                // Failed to create threads.
+   base::PhaseBarrier tcBarrier;                           // Start/completed barrier for the pool
+   std::vector<unsigned int> tcThreadCpus;                 // Pool processors (empty for any)
 
    // Background thread pool
    static const unsigned short MAX_BG_THREADS = 32;
+   static const unsigned int RNG_TC_INDEX = 0x100;        // Random number stream index of the first T/C pool thread
+   static const unsigned int RNG_BG_INDEX = 0x200;        // Random number stream index of the first background pool thread
    std::array<SimBgThread*, MAX_BG_THREADS> bgThreads {};  // Thread pool; 'reqBgThreads' threads
    unsigned int reqBgThreads {1};                          // Requested number of threads
    unsigned int numBgThreads {};                           // Number of threads in pool; should be (reqBgThreads - 1)
    bool bgThreadsFailed {};                                // Failed to create threads.
+   base::PhaseBarrier bgBarrier;                           // Start/completed barrier for the pool
+   std::vector<unsigned int> bgThreadCpus;                 // Pool processors (empty for any)
 };
 
 }
@@ -3,9 +3,12 @@
 #define __oe_simulation_Station_H__
 
 #include "openeaagles/base/Component.hpp"
+#include "openeaagles/base/concurrent/PeriodicTask.hpp"
+
+#include <vector>
 
 namespace oe {
-namespace base { class IoHandler; class Number; class Thread; class Time; }
+namespace base { class Identifier; class IoHandler; class List; class Number; class Thread; class Time; }
 namespace simulation {
 class AbstractDataRecorder;
 class Simulation;
@@ -37,6 +40,12 @@ class AbstractOtw;
 //    tcRate             <base::Number>         ! Time-critical thread rate (Hz) (default: 50hz)
 //    tcPriority         <base::Number>         ! Time-critical thread priority  (default: DEFAULT_TC_THREAD_PRI)
 //    tcStackSize        <base::Number>         ! Time-critical thread stack size (default: <system default size>)
+//    tcOverrunPolicy    <base::Identifier>     ! Time-critical thread frame overrun policy: catchUp, skip or stretch
+//                                              ! (default: catchUp) (see base::PeriodicTask)
+//    tcSpinTime         <base::Time>           ! Time-critical thread spin time before each frame's deadline
+//                                              ! (default: 0 -- sleep only) (see base::PeriodicTask)
+//    tcCpus             <base::List>           ! Time-critical thread processor set; list of processor
+//                                              ! numbers (default: [ ] -- any processor)
 //
 //    fastForwardRate    <base::Number>         ! Fast forward rate for time critical functions
 //                                              ! (i.e., the number of times updateTC() is called per frame).
@@ -45,10 +54,12 @@ class AbstractOtw;
 //    netRate            <base::Number>         ! Network thread rate (Hz) (default: 0hz)
 //    netPriority        <base::Number>         ! Network thread priority (default: DEFAULT_NET_THREAD_PRI )
 //    netStackSize       <base::Number>         ! Network thread stack size (default: <system default size>)
+//    netCpus            <base::List>           ! Network thread processor set (default: [ ] -- any processor)
 //
 //    bgRate             <base::Number>         ! Background thread rate (Hz) (default: 0 -- no thread)
 //    bgPriority         <base::Number>         ! Background thread priority (default: DEFAULT_BG_THREAD_PRI )
 //    bgStackSize        <base::Number>         ! Background thread stack size (default: <system default size>)
+//    bgCpus             <base::List>           ! Background thread processor set (default: [ ] -- any processor)
 //
 //    startupResetTime   <base::Time>           ! Startup (initial) RESET event timer value (default: no reset event)
 //                                              !  (some simulations may need this -- let it run a few initial frames then reset)
@@ -84,6 +95,14 @@ class AbstractOtw;
 //    2) Thread priorities are from zero (lowest) to one (highest).
 //       (see base/Thread.hpp)
 //
+//       The threads' frame statistics (frame times, start lateness and
+//       overruns) are available using getTimeCriticalFrameStats(),
+//       getNetworkFrameStats() and getBackgroundFrameStats().
+//
+//       Each thread draws from its own random number stream, which is seeded
+//       with the creating thread's seed and the thread's own index
+//       (see base::Rng and base::Thread).
+//
 //    3) updateTC() -- The main application can use createTimeCriticalProcess()
 //       to create a thread, which will run at 'tcRate' Hz and 'tcPriority'
 //       priority, that will call our updateTC(); or the application can call
@@ -200,6 +219,19 @@ public:
    unsigned int getTimeCriticalStackSize() const;            // Time-critical thread stack size
    bool setTimeCriticalStackSize(const unsigned int bytes);  // Set Time-critical thread stack size  (bytes or zero for default)
 
+   // Time-critical thread frame overrun policy and spin time (seconds)
+   base::PeriodicTask::OverrunPolicy getTimeCriticalOverrunPolicy() const;
+   bool setTimeCriticalOverrunPolicy(const base::PeriodicTask::OverrunPolicy policy);
+   double getTimeCriticalSpinTime() const;
+   bool setTimeCriticalSpinTime(const double seconds);
+
+   // Time-critical thread processor set (empty for any processor); set before creating the thread
+   const std::vector<unsigned int>& getTimeCriticalCpus() const;
+   bool setTimeCriticalCpus(const std::vector<unsigned int>& cpus);
+
+   // Time-critical thread frame statistics; returns false if there's no thread
+   bool getTimeCriticalFrameStats(base::PeriodicTask::FrameStats* const stats) const;
+
    // Optionally called by the main application  to create a thread
    // that will call 'updateTC()' at 'getTimeCriticalRate()' Hz
    virtual void createTimeCriticalProcess();
@@ -217,7 +249,10 @@ public:
    double getNetworkPriority() const;                        // Network thread priority
    unsigned int getNetworkStackSize() const;                 // Network thread stack size
    bool setNetworkStackSize(const unsigned int bytes);       // Network thread stack size (bytes or zero for default)
+   const std::vector<unsigned int>& getNetworkCpus() const;  // Network thread processor set
+   bool setNetworkCpus(const std::vector<unsigned int>& cpus);  // Network thread processor set (empty for any)
    bool doWeHaveTheNetThread() const;                        // Do we have a network thread?
+   bool getNetworkFrameStats(base::PeriodicTask::FrameStats* const stats) const;  // Network thread frame statistics
 
    // ---
    // Background thread support.
@@ -226,7 +261,10 @@ public:
    double getBackgroundPriority() const;                     // Background thread priority
    unsigned int getBackgroundStackSize() const;              // Background thread stack size
    bool setBackgroundStackSize(const unsigned int bytes);    // Background thread stack size (bytes or zero for default)
+   const std::vector<unsigned int>& getBackgroundCpus() const;  // Background thread processor set
+   bool setBackgroundCpus(const std::vector<unsigned int>& cpus);  // Background thread processor set (empty for any)
    bool doWeHaveTheBgThread() const;                         // Do we have a background thread?
+   bool getBackgroundFrameStats(base::PeriodicTask::FrameStats* const stats) const;  // Background thread frame statistics
 
    // ---
    // Slot functions
@@ -240,12 +278,17 @@ public:
    virtual bool setSlotTimeCriticalRate(const base::Number* const hz);
    virtual bool setSlotTimeCriticalPri(const base::Number* const);
    virtual bool setSlotTimeCriticalStackSize(const base::Number* const);
+   virtual bool setSlotTimeCriticalOverrunPolicy(const base::Identifier* const);
+   virtual bool setSlotTimeCriticalSpinTime(const base::Time* const);
+   virtual bool setSlotTimeCriticalCpus(const base::List* const);
    virtual bool setSlotNetworkRate(const base::Number* const hz);
    virtual bool setSlotNetworkPri(const base::Number* const);
    virtual bool setSlotNetworkStackSize(const base::Number* const);
+   virtual bool setSlotNetworkCpus(const base::List* const);
    virtual bool setSlotBackgroundRate(const base::Number* const hz);
    virtual bool setSlotBackgroundPri(const base::Number* const);
    virtual bool setSlotBackgroundStackSize(const base::Number* const);
+   virtual bool setSlotBackgroundCpus(const base::List* const);
    virtual bool setSlotStartupResetTime(const base::Time* const);
    virtual bool setSlotOwnshipName(const base::String* const);
    virtual bool setSlotFastForwardRate(const base::Number* const);
@@ -272,6 +315,11 @@ protected:
    virtual bool shutdownNotification() override;
 
 private:
+   // Random number stream indexes of our threads (see base::Rng)
+   static const unsigned int RNG_TC_INDEX = 1;
+   static const unsigned int RNG_NET_INDEX = 2;
+   static const unsigned int RNG_BG_INDEX = 3;
+
    virtual void createNetworkProcess();           // Creates a network thread
    virtual void createBackgroundProcess();        // Creates a B/G thread
 
@@ -288,16 +336,21 @@ private:
    double tcPri {DEFAULT_TC_THREAD_PRI};                     // Priority of the time-critical thread (0->lowest, 1->highest)
    unsigned int tcStackSize {};                              // Time-critical thread stack size (bytes or zero for system default size)
    base::safe_ptr<base::Thread> tcThread;                    // The Time-critical thread
+   base::PeriodicTask::OverrunPolicy tcOverrunPolicy {base::PeriodicTask::OVERRUN_CATCH_UP};  // Time-critical frame overrun policy
+   double tcSpinTime {};                                     // Time-critical thread spin time (sec)
+   std::vector<unsigned int> tcCpus;                         // Time-critical thread processor set (empty for any)
    unsigned int fastForwardRate {DEFAULT_FAST_FORWARD_RATE}; // Time-critical thread fast forward rate
 
    double netRate {};                                // Network thread Rate (hz)
    double netPri {DEFAULT_NET_THREAD_PRI};           // Priority of the Network thread (0->lowest, 1->highest)
    unsigned int netStackSize {};                     // Network thread stack size (bytes or zero for system default size)
+   std::vector<unsigned int> netCpus;                // Network thread processor set (empty for any)
    base::safe_ptr<base::Thread> netThread;           // The optional network thread
 
    double bgRate {};                                 // Background thread Rate (hz)
    double bgPri {DEFAULT_BG_THREAD_PRI};             // Priority of the Background thread (0->lowest, 1->highest)
    unsigned int bgStackSize {};                      // Background thread stack size (bytes or zero for system default size)
+   std::vector<unsigned int> bgCpus;                 // Background thread processor set (empty for any)
    base::safe_ptr<base::Thread> bgThread;            // The optional background thread
 
    double startupResetTimer {-1.0};             // Startup RESET timer (sends a RESET_EVENT after timeout)
@@ -0,0 +1,191 @@
+
+#include "openeaagles/base/Checkpoint.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace oe {
+namespace base {
+
+IMPLEMENT_SUBCLASS(Checkpoint, "Checkpoint")
+EMPTY_SLOTTABLE(Checkpoint)
+EMPTY_SERIALIZER(Checkpoint)
+EMPTY_DELETEDATA(Checkpoint)
+
+// Stream header
+static const char MAGIC[4] = { 'O', 'E', 'C', 'P' };
+
+Checkpoint::Checkpoint()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void Checkpoint::copyData(const Checkpoint& org, const bool)
+{
+   BaseClass::copyData(org);
+   buff = org.buff;
+   starts = org.starts;
+}
+
+void Checkpoint::clear()
+{
+   buff.clear();
+   starts.clear();
+}
+
+//------------------------------------------------------------------------------
+// Put functions
+//------------------------------------------------------------------------------
+void Checkpoint::put(const void* const data, const std::size_t n)
+{
+   const auto p = static_cast<const unsigned char*>(data);
+   buff.insert(buff.end(), p, p + n);
+}
+
+void Checkpoint::putDoubles(const double* const data, const std::size_t n)
+{
+   put(static_cast<const void*>(data), n * sizeof(double));
+}
+
+void Checkpoint::putString(const char* const s)
+{
+   const auto n = static_cast<std::uint32_t>(s != nullptr ? std::strlen(s) : 0);
+   put(n);
+   if (n > 0) put(static_cast<const void*>(s), n);
+}
+
+// Sections are prefixed with their length, which is filled in by endSection()
+void Checkpoint::beginSection()
+{
+   const std::uint32_t len = 0;
+   put(len);
+   starts.push_back(buff.size());
+}
+
+void Checkpoint::endSection()
+{
+   if (!starts.empty()) {
+      const std::size_t start = starts.back();
+      starts.pop_back();
+      const auto len = static_cast<std::uint32_t>(buff.size() - start);
+      std::memcpy(&buff[start - sizeof(len)], &len, sizeof(len));
+   }
+}
+
+//------------------------------------------------------------------------------
+// Stream functions
+//------------------------------------------------------------------------------
+bool Checkpoint::write(std::ostream& sout) const
+{
+   const std::uint32_t version = FORMAT_VERSION;
+   const auto size = static_cast<std::uint64_t>(buff.size());
+   sout.write(MAGIC, sizeof(MAGIC));
+   sout.write(reinterpret_cast<const char*>(&version), sizeof(version));
+   sout.write(reinterpret_cast<const char*>(&size), sizeof(size));
+   if (size > 0) sout.write(reinterpret_cast<const char*>(buff.data()), static_cast<std::streamsize>(size));
+   return sout.good();
+}
+
+bool Checkpoint::read(std::istream& sin)
+{
+   char magic[sizeof(MAGIC)] = {};
+   std::uint32_t version = 0;
+   std::uint64_t size = 0;
+   sin.read(magic, sizeof(magic));
+   sin.read(reinterpret_cast<char*>(&version), sizeof(version));
+   sin.read(reinterpret_cast<char*>(&size), sizeof(size));
+
+   bool ok = sin.good() && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0 && version == FORMAT_VERSION;
+   if (ok) {
+      clear();
+      buff.resize(static_cast<std::size_t>(size));
+      if (size > 0) sin.read(reinterpret_cast<char*>(buff.data()), static_cast<std::streamsize>(size));
+      ok = !sin.fail();
+      if (!ok) clear();
+   }
+   if (!ok && isMessageEnabled(MSG_ERROR)) {
+      std::cerr << "Checkpoint::read(): ERROR, invalid or incompatible checkpoint" << std::endl;
+   }
+   return ok;
+}
+
+//==============================================================================
+// Checkpoint::Reader
+//==============================================================================
+Checkpoint::Reader::Reader(const Checkpoint* const cp) : buff(cp->buff)
+{
+}
+
+bool Checkpoint::Reader::isEnd() const
+{
+   const std::size_t end = (ends.empty() ? buff.size() : ends.back());
+   return (pos >= end);
+}
+
+bool Checkpoint::Reader::get(void* const data, const std::size_t n)
+{
+   const std::size_t end = (ends.empty() ? buff.size() : ends.back());
+   if (ok && n <= end - pos) {
+      if (n > 0) std::memcpy(data, &buff[pos], n);
+      pos += n;
+   }
+   else {
+      ok = false;
+   }
+   return ok;
+}
+
+bool Checkpoint::Reader::getDoubles(double* const data, const std::size_t n)
+{
+   return get(static_cast<void*>(data), n * sizeof(double));
+}
+
+bool Checkpoint::Reader::getString(std::string* const s)
+{
+   std::uint32_t n = 0;
+   if (get(&n)) {
+      const std::size_t end = (ends.empty() ? buff.size() : ends.back());
+      if (n <= end - pos) {
+         s->assign(reinterpret_cast<const char*>(buff.data() + pos), n);
+         pos += n;
+      }
+      else {
+         ok = false;
+      }
+   }
+   return ok;
+}
+
+bool Checkpoint::Reader::beginSection()
+{
+   std::uint32_t len = 0;
+   if (get(&len)) {
+      const std::size_t end = (ends.empty() ? buff.size() : ends.back());
+      if (len <= end - pos) ends.push_back(pos + len);
+      else ok = false;
+   }
+   return ok;
+}
+
+bool Checkpoint::Reader::endSection()
+{
+   if (!ends.empty()) {
+      if (pos != ends.back()) ok = false;
+      pos = ends.back();
+      ends.pop_back();
+   }
+   return ok;
+}
+
+bool Checkpoint::Reader::skipSection()
+{
+   if (!ends.empty()) {
+      pos = ends.back();
+      ends.pop_back();
+   }
+   return ok;
+}
+
+}
+}
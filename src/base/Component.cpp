@@ -9,12 +9,80 @@
 #include "openeaagles/base/PairStream.hpp"
 #include "openeaagles/base/Statistic.hpp"
 #include "openeaagles/base/String.hpp"
+#include "openeaagles/base/util/atomics.hpp"
 #include "openeaagles/base/util/system_utils.hpp"
 #include "openeaagles/base/util/platform_api.hpp"
 
+#include <array>
+#include <string>
+
 namespace oe {
 namespace base {
 
+//==============================================================================
+// Class: Component::FindCache
+// Description: A component's cache of recent findByName(), findByType() and
+//              findContainerByType() results, which are only valid for the
+//              component tree 'generation' that they were found in.
+//==============================================================================
+class Component::FindCache
+{
+public:
+   enum { BY_NAME, BY_TYPE, CONTAINER_BY_TYPE };
+
+   bool get(const int kind, const char* const name, const std::type_info* const type, const void** const result) const
+   {
+      for (unsigned int i = 0; i < n; i++) {
+         const Entry& e = entries[i];
+         if (e.kind == kind) {
+            const bool match = (name != nullptr) ? (e.name == name) : (e.type == type || *e.type == *type);
+            if (match) {
+               *result = e.result;
+               return true;
+            }
+         }
+      }
+      return false;
+   }
+
+   void put(const int kind, const char* const name, const std::type_info* const type, const void* const result)
+   {
+      Entry& e = entries[next];
+      e.kind = kind;
+      if (name != nullptr) e.name = name;
+      else e.name.clear();
+      e.type = type;
+      e.result = result;
+      next = (next + 1) % MAX_ENTRIES;
+      if (n < MAX_ENTRIES) n++;
+   }
+
+   void clear(const unsigned int gen)
+   {
+      generation = gen;
+      n = 0;
+      next = 0;
+   }
+
+   unsigned int generation {};         // Tree generation of these results
+
+private:
+   static const unsigned int MAX_ENTRIES = 8;
+
+   struct Entry {
+      int kind {};                     // BY_NAME, BY_TYPE or CONTAINER_BY_TYPE
+      std::string name;                // Name (BY_NAME)
+      const std::type_info* type {};   // Type (BY_TYPE, CONTAINER_BY_TYPE)
+      const void* result {};           // Pair or Component found (or zero if not found)
+   };
+
+   std::array<Entry, MAX_ENTRIES> entries;
+   unsigned int n {};                  // Number of valid entries
+   unsigned int next {};               // Next entry to replace
+};
+
+std::atomic<unsigned int> Component::treeVersion {1};
+
 IMPLEMENT_SUBCLASS(Component, "Component")
 
 BEGIN_SLOTTABLE(Component)
@@ -24,7 +92,8 @@ BEGIN_SLOTTABLE(Component)
     "printTimingStats",    // 4) Enable/disable the printing of the timing statistics (Number) (default: false)
     "freeze",              // 5) Freeze flag: true(1), false(0); default: false       (Number) (default: false)
     "enableMessageType",   // 6) Enable message type { WARNING INFO DEBUG USER DATA }
-    "disableMessageType"   // 7) Disable message type { WARNING INFO DEBUG USER DATA }
+    "disableMessageType",  // 7) Disable message type { WARNING INFO DEBUG USER DATA }
+    "profile"              // 8) Frame profiling of this component and its subtree    (Number) (default: inherited)
 END_SLOTTABLE(Component)
 
 BEGIN_SLOT_MAP(Component)
@@ -39,11 +108,15 @@ BEGIN_SLOT_MAP(Component)
     ON_SLOT( 6, setSlotEnableMsgType, Number)
     ON_SLOT( 7, setSlotDisableMsgType, Identifier)
     ON_SLOT( 7, setSlotDisableMsgType, Number)
+    ON_SLOT( 8, setSlotProfile, Number)
 END_SLOT_MAP()
 
 bool Component::event(const int _event, ::oe::base::Object* const _obj)
 {
-    bool _used {};
+    // Same as BEGIN_EVENT_HANDLER(), but without a base class
+    using _EvtThis = Component;
+    static const EventTable _evtTable(
+        [](EventTable* const _tbl) {
 
     ON_EVENT_OBJ(SELECT,       select, Number)
     ON_EVENT_OBJ(SELECT,       select, String)
@@ -53,6 +126,9 @@ bool Component::event(const int _event, ::oe::base::Object* const _obj)
 
     ON_EVENT_OBJ(FREEZE_EVENT, setSlotFreeze, Number )
 
+        } );
+    bool _used = _evtTable.dispatch(this, _event, _obj);
+
     // *** Special handling of the end of the EVENT table ***
     // Pass only key events up to our container
     if (_event <= MAX_KEY_EVENT && container() != nullptr) {
@@ -82,8 +158,10 @@ void Component::copyData(const Component& org, const bool)
       processComponents(tmp, typeid(Component));
       tmp->unref();
    }
-   else
+   else {
       components = nullptr;
+      componentTreeChanged();
+   }
 
    // Timing statistics
    if (timingStats != nullptr) timingStats->unref();
@@ -92,6 +170,7 @@ void Component::copyData(const Component& org, const bool)
       timingStats = static_cast<Statistic*>(org.timingStats->clone());
    }
    pts = org.pts;
+   setProfileMode(org.getProfileMode());
 
    // Our container
    containerPtr = nullptr;             // Copied doesn't mean contained in the same container!
@@ -115,6 +194,14 @@ void Component::deleteData()
        timingStats->unref();
        timingStats = nullptr;
     }
+    setProfileMode(FrameProfiler::INHERIT);
+
+    // We may be cached by others
+    componentTreeChanged();
+    if (findCache != nullptr) {
+       delete findCache;
+       findCache = nullptr;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -157,6 +244,8 @@ void Component::freeze(const bool fflag)
 //------------------------------------------------------------------------------
 void Component::reset()
 {
+   componentTreeChanged();
+
    PairStream* subcomponents = getComponents();
    if (subcomponents != nullptr) {
         if (selection != nullptr) {
@@ -183,6 +272,14 @@ void Component::reset()
 //------------------------------------------------------------------------------
 void Component::tcFrame(const double dt)
 {
+   // ---
+   // Are we running this frame, and with what delta time?
+   // ---
+   double fdt = dt;
+   if (!isTcFrameDue(&fdt)) return;
+
+   FrameProfiler::Scope scope(this);
+
    // ---
    // Collect start time
    // ---
@@ -200,7 +297,7 @@ void Component::tcFrame(const double dt)
    // ---
    // Execute one time-critical frame
    // ---
-   this->updateTC(dt);
+   this->updateTC(fdt);
 
    // ---
    // Process timing data
@@ -229,6 +326,32 @@ void Component::tcFrame(const double dt)
    }
 }
 
+//------------------------------------------------------------------------------
+// dataFrame() -- Main background frame
+//------------------------------------------------------------------------------
+void Component::dataFrame(const double dt)
+{
+   double fdt = dt;
+   if (isDataFrameDue(&fdt)) {
+      FrameProfiler::Scope scope(this);
+      this->updateData(fdt);
+   }
+}
+
+//------------------------------------------------------------------------------
+// isTcFrameDue(), isDataFrameDue() -- update rate control; by default, we run
+// every frame with our container's delta time
+//------------------------------------------------------------------------------
+bool Component::isTcFrameDue(double* const)
+{
+   return true;
+}
+
+bool Component::isDataFrameDue(double* const)
+{
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // printTimingStats() -- Update time critical stuff here
 //------------------------------------------------------------------------------
@@ -274,7 +397,7 @@ void Component::updateData(const double dt)
     if (subcomponents != nullptr) {
         if (selection != nullptr) {
             // When we've selected only one
-            if (selected != nullptr) selected->updateData(dt);
+            if (selected != nullptr) selected->dataFrame(dt);
         }
         else {
             // When we should update them all
@@ -282,7 +405,7 @@ void Component::updateData(const double dt)
             while (item != nullptr) {
                 const auto pair = static_cast<Pair*>(item->getValue());
                 const auto obj = static_cast<Component*>(pair->object());
-                obj->updateData(dt);
+                obj->dataFrame(dt);
                 item = item->getNext();
             }
         }
@@ -353,36 +476,72 @@ bool Component::shutdownNotification()
 }
 
 
+//------------------------------------------------------------------------------
+// container() -- sets our container pointer
+//------------------------------------------------------------------------------
+Component* Component::container(Component* const p)
+{
+   if (p != containerPtr) {
+      containerPtr = p;
+      componentTreeChanged();
+   }
+   return containerPtr;
+}
+
 //------------------------------------------------------------------------------
 // findContainerByType() -- find a container of ours by type
 //------------------------------------------------------------------------------
 Component* Component::findContainerByType(const std::type_info& type)
 {
-   Component* p {};
-   if (container() != nullptr) {
-      if ( container()->isClassType(type) )
-        p = container();
-      else
-        p = container()->findContainerByType(type);
-   }
-   return p;
+   const Component* cThis {this};
+   const Component* p = cThis->findContainerByType(type);
+   return const_cast<Component*>(p);
 }
 
 const Component* Component::findContainerByType(const std::type_info& type) const
 {
-   const Component* p {};
-   if (container() != nullptr) {
-      if ( container()->isClassType(type) )
-        p = container();
-      else
-        p = container()->findContainerByType(type);
+   const unsigned int gen = treeVersion.load(std::memory_order_acquire);
+   const void* result {};
+   if (getCachedFind(FindCache::CONTAINER_BY_TYPE, nullptr, &type, gen, &result)) {
+      return static_cast<const Component*>(result);
+   }
+
+   const Component* p = container();
+   while (p != nullptr && !p->isClassType(type)) {
+      p = p->container();
    }
+
+   putCachedFind(FindCache::CONTAINER_BY_TYPE, nullptr, &type, gen, p);
    return p;
 }
 
 
 //------------------------------------------------------------------------------
-// findByName() -- find one of our components by slotname
+// findByName() -- find one of our components by slotname (see lookupByName())
+//------------------------------------------------------------------------------
+const Pair* Component::findByName(const char* const slotname) const
+{
+   const unsigned int gen = treeVersion.load(std::memory_order_acquire);
+   const void* result {};
+   if (getCachedFind(FindCache::BY_NAME, slotname, nullptr, gen, &result)) {
+      return static_cast<const Pair*>(result);
+   }
+
+   const Pair* q = lookupByName(slotname);
+
+   putCachedFind(FindCache::BY_NAME, slotname, nullptr, gen, q);
+   return q;
+}
+
+Pair* Component::findByName(const char* const slotname)
+{
+   const Component* cThis {this};
+   const Pair* p = cThis->findByName(slotname);
+   return const_cast<Pair*>(p);
+}
+
+//------------------------------------------------------------------------------
+// lookupByName() -- search the component tree for one of our components by slotname
 //
 //  Forms of slotname:
 //      xxx     -- simple name, look for 'xxx' as one of our components
@@ -392,8 +551,11 @@ const Component* Component::findContainerByType(const std::type_info& type) cons
 //                 components.
 //      .yyy    -- hard name, look for 'yyy' only as one of our
 //                 components.
+//
+//  Our components are searched using their findByName(), so that their
+//  overrides (and their own caches) are used.
 //------------------------------------------------------------------------------
-const Pair* Component::findByName(const char* const slotname) const
+const Pair* Component::lookupByName(const char* const slotname) const
 {
     const Pair* q {};
     const PairStream* subcomponents = getComponents();
@@ -449,13 +611,6 @@ const Pair* Component::findByName(const char* const slotname) const
     return q;
 }
 
-Pair* Component::findByName(const char* const slotname)
-{
-   const Component* cThis {this};
-   const Pair* p = cThis->findByName(slotname);
-   return const_cast<Pair*>(p);
-}
-
 //------------------------------------------------------------------------------
 // findByIndex() -- find component one of our components by slot index
 //------------------------------------------------------------------------------
@@ -488,10 +643,35 @@ Pair* Component::findByIndex(const int slotindex)
 }
 
 //------------------------------------------------------------------------------
-// findByType() -- find one of our components by type (our children first
-//                 then grandchildren).
+// findByType() -- find one of our components by type (see lookupByType())
 //------------------------------------------------------------------------------
 const Pair* Component::findByType(const std::type_info& type) const
+{
+   const unsigned int gen = treeVersion.load(std::memory_order_acquire);
+   const void* result {};
+   if (getCachedFind(FindCache::BY_TYPE, nullptr, &type, gen, &result)) {
+      return static_cast<const Pair*>(result);
+   }
+
+   const Pair* q = lookupByType(type);
+
+   putCachedFind(FindCache::BY_TYPE, nullptr, &type, gen, q);
+   return q;
+}
+
+Pair* Component::findByType(const std::type_info& type)
+{
+   const Component* cThis {this};
+   const Pair* p = cThis->findByType(type);
+   return const_cast<Pair*>(p);
+}
+
+//------------------------------------------------------------------------------
+// lookupByType() -- search the component tree for one of our components by
+//                   type (our children first then grandchildren, using
+//                   their findByType()).
+//------------------------------------------------------------------------------
+const Pair* Component::lookupByType(const std::type_info& type) const
 {
     const Pair* q {};
     const PairStream* subcomponents = getComponents();
@@ -510,13 +690,52 @@ const Pair* Component::findByType(const std::type_info& type) const
     return q;
 }
 
-Pair* Component::findByType(const std::type_info& type)
+//------------------------------------------------------------------------------
+// Find cache functions -- cached results are only used if they were found
+// in the current generation of the component tree, 'gen'.
+//------------------------------------------------------------------------------
+void Component::componentTreeChanged()
 {
-   const Component* cThis {this};
-   const Pair* p = cThis->findByType(type);
-   return const_cast<Pair*>(p);
+   treeVersion.fetch_add(1, std::memory_order_acq_rel);
 }
 
+bool Component::getCachedFind(
+      const int kind,
+      const char* const name,
+      const std::type_info* const type,
+      const unsigned int gen,
+      const void** const result
+   ) const
+{
+   bool found {};
+   lock(findCacheLock);
+   if (findCache != nullptr && findCache->generation == gen) {
+      found = findCache->get(kind, name, type, result);
+   }
+   unlock(findCacheLock);
+   return found;
+}
+
+void Component::putCachedFind(
+      const int kind,
+      const char* const name,
+      const std::type_info* const type,
+      const unsigned int gen,
+      const void* const result
+   ) const
+{
+   // The tree changed while we were looking
+   if (gen != treeVersion.load(std::memory_order_acquire)) return;
+
+   lock(findCacheLock);
+   if (findCache == nullptr) {
+      findCache = new FindCache();
+      findCache->clear(gen);
+   }
+   if (findCache->generation != gen) findCache->clear(gen);
+   findCache->put(kind, name, type, result);
+   unlock(findCacheLock);
+}
 
 //------------------------------------------------------------------------------
 // findNameOfComponent() --
@@ -639,6 +858,7 @@ void Component::processComponents(
    // ---
    components = newList;
    newList->unref();
+   componentTreeChanged();
 
    // ---
    // Anything selected?
@@ -739,6 +959,101 @@ bool Component::setTimingStatsEnabled(const bool b)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// saveState() -- save our freeze flag and our children's state
+//------------------------------------------------------------------------------
+void Component::saveState(Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(frz);
+
+   const PairStream* subcomponents = getComponents();
+   const auto n = static_cast<unsigned int>(subcomponents != nullptr ? subcomponents->entries() : 0);
+   cp->put(n);
+   if (subcomponents != nullptr) {
+      const List::Item* item = subcomponents->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<const Pair*>(item->getValue());
+         static_cast<const Component*>(pair->object())->saveState(cp);
+         item = item->getNext();
+      }
+      subcomponents->unref();
+   }
+   cp->endSection();
+}
+
+//------------------------------------------------------------------------------
+// restoreState() -- restore our freeze flag and our children's state
+//------------------------------------------------------------------------------
+bool Component::restoreState(Checkpoint::Reader* const rd)
+{
+   bool f {};
+   unsigned int n {};
+   bool ok = rd->beginSection() && rd->get(&f) && rd->get(&n);
+   if (ok) {
+      frz = f;
+
+      PairStream* subcomponents = getComponents();
+      const auto entries = static_cast<unsigned int>(subcomponents != nullptr ? subcomponents->entries() : 0);
+      ok = (n == entries);
+      if (ok && subcomponents != nullptr) {
+         List::Item* item = subcomponents->getFirstItem();
+         while (item != nullptr && ok) {
+            const auto pair = static_cast<Pair*>(item->getValue());
+            ok = static_cast<Component*>(pair->object())->restoreState(rd);
+            item = item->getNext();
+         }
+      }
+      if (subcomponents != nullptr) subcomponents->unref();
+
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Component::restoreState(): ERROR, checkpoint doesn't match our components" << std::endl;
+      }
+   }
+   ok = rd->endSection() && ok;
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// Frame profiling
+//------------------------------------------------------------------------------
+FrameProfiler::Mode Component::getProfileMode() const
+{
+   return static_cast<FrameProfiler::Mode>(profileMode.load(std::memory_order_relaxed));
+}
+
+bool Component::setProfileMode(const FrameProfiler::Mode mode)
+{
+   const int old = profileMode.exchange(mode);
+   if (old != mode) {
+      if (old == FrameProfiler::ON) FrameProfiler::addProfiledComponents(-1);
+      if (mode == FrameProfiler::ON) FrameProfiler::addProfiledComponents(1);
+
+      // Our subtree needs to check again
+      componentTreeChanged();
+   }
+   return true;
+}
+
+// True if our mode, or the first mode that's not INHERIT up our container chain, is ON
+bool Component::isProfiled() const
+{
+   const unsigned int gen = (treeVersion.load(std::memory_order_relaxed) & 0x7fffffff);
+   const unsigned int cached = profileCache.load(std::memory_order_relaxed);
+   if ((cached >> 1) == gen) return ((cached & 1) != 0);
+
+   bool on = false;
+   for (const Component* p = this; p != nullptr; p = p->container()) {
+      const int mode = p->profileMode.load(std::memory_order_relaxed);
+      if (mode != FrameProfiler::INHERIT) {
+         on = (mode == FrameProfiler::ON);
+         break;
+      }
+   }
+   profileCache.store((gen << 1) | (on ? 1 : 0), std::memory_order_relaxed);
+   return on;
+}
+
 //------------------------------------------------------------------------------
 // setPrintTimingStats() -- enable/disable print the timing statistics
 //------------------------------------------------------------------------------
@@ -772,6 +1087,16 @@ bool Component::setSlotPrintTimingStats(const Number* const num)
    return ok;
 }
 
+// setSlotProfile() -- slot to turn profiling of this subtree on or off
+bool Component::setSlotProfile(const Number* const num)
+{
+   bool ok {};
+   if (num != nullptr) {
+      ok = setProfileMode(num->getBoolean() ? FrameProfiler::ON : FrameProfiler::OFF);
+   }
+   return ok;
+}
+
 // setSlotFreeze() -- slot to set/clear the freeze flag
 bool Component::setSlotFreeze(const Number* const num)
 {
@@ -1108,6 +1433,12 @@ std::ostream& Component::serialize(std::ostream& sout, const int i, const bool s
         sout << "printTimingStats: " << isTimingStatsPrintEnabled() << std::endl;
     }
 
+    // profile
+    if (getProfileMode() != FrameProfiler::INHERIT) {
+        indent(sout,i+j);
+        sout << "profile: " << (getProfileMode() == FrameProfiler::ON) << std::endl;
+    }
+
     // Freeze
     if (isFrozen()) {
         indent(sout,i+j);
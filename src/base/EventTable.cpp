@@ -0,0 +1,127 @@
+#include "openeaagles/base/EventTable.hpp"
+#include "openeaagles/base/Component.hpp"
+
+namespace oe {
+namespace base {
+
+EventTable::EventTable(Builder builder) : maxKeyEvent(Component::MAX_KEY_EVENT)
+{
+   if (builder != nullptr) builder(this);
+   compile();
+}
+
+//------------------------------------------------------------------------------
+// add functions -- the handlers are added in dispatch order
+//------------------------------------------------------------------------------
+void EventTable::add(const int token, Handler handler, TypeCheck check)
+{
+   Entry e;
+   e.kind = TOKEN;
+   e.token = token;
+   e.handler = handler;
+   e.check = check;
+   entries.push_back(e);
+}
+
+void EventTable::addAnyKey(Handler handler, TypeCheck check)
+{
+   Entry e;
+   e.kind = ANY_KEY;
+   e.handler = handler;
+   e.check = check;
+   entries.push_back(e);
+}
+
+void EventTable::addAnyEvent(Handler handler, TypeCheck check)
+{
+   Entry e;
+   e.kind = ANY_EVENT;
+   e.handler = handler;
+   e.check = check;
+   entries.push_back(e);
+}
+
+//------------------------------------------------------------------------------
+// dispatch() -- dispatches the event to the handlers in range 'r'
+//------------------------------------------------------------------------------
+bool EventTable::dispatch(const Range& r, Component* const p, const int event, Object* const obj) const
+{
+   const Call* const c = &calls[r.first];
+   for (unsigned int i = 0; i < r.n; i++) {
+      if (c[i].check == nullptr || (obj != nullptr && c[i].check(obj))) {
+         if (c[i].handler(p, event, obj)) return true;
+      }
+   }
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// compile() -- builds the handler lists and the token index
+//------------------------------------------------------------------------------
+void EventTable::compile()
+{
+   calls.clear();
+   index.clear();
+
+   // Handlers for the tokens that are not mapped
+   otherKeys = makeRange(0, true);
+   otherEvents = makeRange(Component::MAX_KEY_EVENT + 1, true);
+
+   // Token range
+   bool first = true;
+   for (const Entry& e : entries) {
+      if (e.kind == TOKEN) {
+         if (first || e.token < minToken) minToken = e.token;
+         if (first || e.token > maxToken) maxToken = e.token;
+         first = false;
+      }
+   }
+   if (first) {
+      minToken = 0;
+      maxToken = -1;
+      return;
+   }
+
+   // Default every token in the range to the unmapped lists, then give
+   // each mapped token its own list.
+   index.resize(static_cast<std::size_t>(maxToken - minToken + 1));
+   std::vector<bool> mapped(index.size(), false);
+   for (int t = minToken; t <= maxToken; t++) {
+      index[t - minToken] = (t <= Component::MAX_KEY_EVENT ? otherKeys : otherEvents);
+   }
+   for (const Entry& e : entries) {
+      if (e.kind == TOKEN && !mapped[e.token - minToken]) {
+         index[e.token - minToken] = makeRange(e.token, false);
+         mapped[e.token - minToken] = true;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// makeRange() -- adds the list of handlers that receive the token, 'token';
+// if 'anyToken' is true, then only the ANY_KEY and ANY_EVENT handlers are used.
+//------------------------------------------------------------------------------
+EventTable::Range EventTable::makeRange(const int token, const bool anyToken)
+{
+   Range r;
+   r.first = static_cast<unsigned int>(calls.size());
+   for (const Entry& e : entries) {
+      bool match = false;
+      switch (e.kind) {
+         case TOKEN:     match = (!anyToken && e.token == token); break;
+         case ANY_KEY:   match = (token <= Component::MAX_KEY_EVENT); break;
+         case ANY_EVENT: match = true; break;
+      }
+      if (match) {
+         Call c;
+         c.handler = e.handler;
+         c.check = e.check;
+         calls.push_back(c);
+      }
+   }
+   r.n = static_cast<unsigned int>(calls.size()) - r.first;
+   return r;
+}
+
+}
+}
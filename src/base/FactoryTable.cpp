@@ -0,0 +1,63 @@
+#include "openeaagles/base/FactoryTable.hpp"
+#include <cstring>
+
+namespace oe {
+namespace base {
+
+FactoryTable::FactoryTable(std::initializer_list<Entry> entries)
+{
+   // Table size: a power of two with at most 50% load
+   std::size_t n = 8;
+   while (n < entries.size() * 2) n *= 2;
+   slots.resize(n);
+   mask = n - 1;
+
+   for (const Entry& e : entries) {
+      if (e.name == nullptr || e.create == nullptr) continue;
+      const std::size_t len = std::strlen(e.name);
+      std::size_t i = hash(e.name, len) & mask;
+      bool found = false;
+      while (slots[i].name != nullptr && !found) {
+         found = (slots[i].len == len && std::memcmp(slots[i].name, e.name, len) == 0);
+         if (!found) i = (i + 1) & mask;
+      }
+      // the first entry with this name is used
+      if (!found) {
+         slots[i].name = e.name;
+         slots[i].len = len;
+         slots[i].create = e.create;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// create() -- returns a new object with factory name 'name', or zero
+//------------------------------------------------------------------------------
+Object* FactoryTable::create(const std::string& name) const
+{
+   const std::size_t len = name.size();
+   std::size_t i = hash(name.data(), len) & mask;
+   while (slots[i].name != nullptr) {
+      if (slots[i].len == len && std::memcmp(slots[i].name, name.data(), len) == 0) {
+         return slots[i].create();
+      }
+      i = (i + 1) & mask;
+   }
+   return nullptr;
+}
+
+//------------------------------------------------------------------------------
+// hash() -- FNV-1a hash of the name
+//------------------------------------------------------------------------------
+std::size_t FactoryTable::hash(const char* const s, const std::size_t len)
+{
+   std::size_t h = 2166136261u;
+   for (std::size_t i = 0; i < len; i++) {
+      h ^= static_cast<unsigned char>(s[i]);
+      h *= 16777619u;
+   }
+   return h;
+}
+
+}
+}
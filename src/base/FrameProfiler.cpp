@@ -0,0 +1,437 @@
+
+#include "openeaagles/base/FrameProfiler.hpp"
+
+#include "openeaagles/base/Component.hpp"
+#include "openeaagles/base/Identifier.hpp"
+#include "openeaagles/base/util/atomics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <ostream>
+#include <thread>
+#include <typeinfo>
+#include <unordered_map>
+
+#if defined(__GNUC__)
+   #include <cxxabi.h>
+   #include <cstdlib>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__)
+   #include <x86intrin.h>
+   #define OE_PROFILER_TSC
+#elif defined(_M_IX86) || defined(_M_X64)
+   #include <intrin.h>
+   #define OE_PROFILER_TSC
+#endif
+
+namespace oe {
+namespace base {
+
+std::atomic<bool> FrameProfiler::enabled {true};
+std::atomic<int> FrameProfiler::numOn {};
+std::atomic<unsigned long long> FrameProfiler::nextId {1};
+long FrameProfiler::threadsLock {};
+std::vector<std::shared_ptr<FrameProfiler::ThreadData>> FrameProfiler::threads;
+unsigned int FrameProfiler::nextThreadIndex {};
+
+//------------------------------------------------------------------------------
+// Time stamp counter
+//------------------------------------------------------------------------------
+static unsigned long long getTicks()
+{
+#if defined(OE_PROFILER_TSC)
+   return __rdtsc();
+#else
+   return static_cast<unsigned long long>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() );
+#endif
+}
+
+// Reference points for the tick rate and the trace time line
+static const unsigned long long epochTicks = getTicks();
+static const std::chrono::steady_clock::time_point epochTime = std::chrono::steady_clock::now();
+
+double FrameProfiler::getTicksPerSecond()
+{
+#if defined(OE_PROFILER_TSC)
+   // Measured against the steady clock over (at least) the first 50 ms
+   const double minTime = 0.05;
+   double dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - epochTime).count();
+   if (dt < minTime) {
+      std::this_thread::sleep_for(std::chrono::duration<double>(minTime - dt));
+   }
+   const unsigned long long ticks = getTicks();
+   dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - epochTime).count();
+   return static_cast<double>(ticks - epochTicks) / dt;
+#else
+   return 1.0e9;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Per thread call tree and ring buffer
+//------------------------------------------------------------------------------
+struct FrameProfiler::ThreadData
+{
+   struct TNode {
+      unsigned long long key {};                // Component's profile ID
+      unsigned int parent {};                   // Parent node
+      std::string label;                        // Component name
+      unsigned long long count {};              // Number of calls
+      unsigned long long ticks {};              // Total ticks
+      unsigned long long childTicks {};         // Ticks of the child scopes
+      unsigned long long maxTicks {};           // Max ticks of a single call
+      unsigned long long phaseTicks[MAX_PHASES] {};
+   };
+
+   struct Event {
+      unsigned long long t0 {};                 // Start (ticks)
+      unsigned long long t1 {};                 // End (ticks)
+      unsigned int node {};                     // Call tree node
+      unsigned int phase {};                    // Phase
+   };
+
+   struct Key {
+      unsigned int parent;
+      unsigned long long key;
+      bool operator==(const Key& k) const       { return (parent == k.parent && key == k.key); }
+   };
+   struct KeyHash {
+      std::size_t operator()(const Key& k) const {
+         return std::hash<unsigned long long>()(k.key) ^ (static_cast<std::size_t>(k.parent) * 2654435761u);
+      }
+   };
+
+   ThreadData() : nodes(1) {}
+
+   unsigned int child(const unsigned int parent, const Component* const c);
+   void purgeNodes();
+
+   long lock {};                                // Semaphore for 'nodes' and 'ring'
+   unsigned int index {};                       // Thread index
+   unsigned int cur {};                         // Current node
+   unsigned int phase {};                       // Current phase
+   std::vector<TNode> nodes;                    // Call tree; node zero is the root
+   std::unordered_map<Key, unsigned int, KeyHash> nodeMap;   // Child nodes by parent and component (our thread only)
+   std::vector<Event> ring;                     // Ring buffer of the last RING_SIZE scopes
+   unsigned long long numEvents {};             // Total number of scopes recorded
+   std::atomic<bool> purge {};                  // Drop the call tree at the start of our next frame
+   std::atomic<bool> exited {};                 // Our thread has exited; freed by clear()
+
+   // Thread's reference; marks the data as exited, as the thread exits
+   struct Owner {
+      std::shared_ptr<ThreadData> td;
+      ~Owner()                                  { if (td != nullptr) td->exited.store(true, std::memory_order_relaxed); }
+   };
+};
+
+//------------------------------------------------------------------------------
+// makeLabel() -- component's name (from its container) and type
+//------------------------------------------------------------------------------
+static std::string makeLabel(const Component* const c)
+{
+   // Type name, without namespaces
+   std::string type = typeid(*c).name();
+#if defined(__GNUC__)
+   int status = 0;
+   char* const dname = abi::__cxa_demangle(type.c_str(), nullptr, nullptr, &status);
+   if (dname != nullptr) {
+      if (status == 0) type = dname;
+      std::free(dname);
+   }
+#endif
+   const std::size_t sep = type.rfind("::");
+   if (sep != std::string::npos) type = type.substr(sep + 2);
+
+   std::string label;
+   const Component* const p = c->container();
+   if (p != nullptr) {
+      const Identifier* const id = p->findNameOfComponent(c);
+      if (id != nullptr) {
+         label = id->getString();
+         id->unref();
+      }
+   }
+   if (label.empty()) label = type;
+   else label += " (" + type + ")";
+   return label;
+}
+
+// Returns the child node of 'parent' for component 'c'; creates it, if needed.
+unsigned int FrameProfiler::ThreadData::child(const unsigned int parent, const Component* const c)
+{
+   const Key key { parent, c->getProfileId() };
+   const auto it = nodeMap.find(key);
+   if (it != nodeMap.end()) return it->second;
+
+   TNode n;
+   n.key = key.key;
+   n.parent = parent;
+   n.label = makeLabel(c);
+
+   base::lock(lock);
+   const auto idx = static_cast<unsigned int>(nodes.size());
+   nodes.push_back(n);
+   base::unlock(lock);
+
+   nodeMap[key] = idx;
+   return idx;
+}
+
+// Drops all nodes, except the root, and the ring buffer's scopes, which
+// refer to them; only called by our thread, with no scopes in progress.
+void FrameProfiler::ThreadData::purgeNodes()
+{
+   base::lock(lock);
+   nodes.resize(1);
+   nodes[0] = TNode();
+   numEvents = 0;
+   base::unlock(lock);
+
+   nodeMap.clear();
+   purge.store(false, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// Thread data
+//------------------------------------------------------------------------------
+FrameProfiler::ThreadData* FrameProfiler::getThreadData()
+{
+   static thread_local ThreadData* td = nullptr;
+   if (td == nullptr) {
+      static thread_local ThreadData::Owner owner;
+      owner.td = std::make_shared<ThreadData>();
+      td = owner.td.get();
+      td->ring.resize(RING_SIZE);
+      base::lock(threadsLock);
+      td->index = nextThreadIndex++;
+      threads.push_back(owner.td);
+      base::unlock(threadsLock);
+   }
+   return td;
+}
+
+std::vector<std::shared_ptr<FrameProfiler::ThreadData>> FrameProfiler::getAllThreadData()
+{
+   base::lock(threadsLock);
+   std::vector<std::shared_ptr<ThreadData>> list(threads);
+   base::unlock(threadsLock);
+   return list;
+}
+
+void FrameProfiler::setPhase(const unsigned int phase)
+{
+   if (isActive()) getThreadData()->phase = (phase < MAX_PHASES ? phase : (MAX_PHASES - 1));
+}
+
+//------------------------------------------------------------------------------
+// Scope
+//------------------------------------------------------------------------------
+void FrameProfiler::Scope::begin(const Component* const c)
+{
+   if (c == nullptr || !c->isProfiled()) return;
+
+   td = getThreadData();
+   if (td->cur == 0 && td->purge.load(std::memory_order_relaxed)) td->purgeNodes();
+   prevNode = td->cur;
+
+   // If we're starting in the middle of the component tree, then place
+   // this scope under our containers.
+   unsigned int parent = td->cur;
+   if (parent == 0 && c->container() != nullptr) {
+      static const unsigned int MAX_DEPTH = 64;
+      const Component* chain[MAX_DEPTH];
+      unsigned int n = 0;
+      for (const Component* p = c->container(); p != nullptr && n < MAX_DEPTH; p = p->container()) {
+         chain[n++] = p;
+      }
+      while (n > 0) parent = td->child(parent, chain[--n]);
+   }
+
+   node = td->child(parent, c);
+   td->cur = node;
+   t0 = getTicks();
+}
+
+void FrameProfiler::Scope::end()
+{
+   const unsigned long long t1 = getTicks();
+   const unsigned long long dt = t1 - t0;
+
+   base::lock(td->lock);
+
+   ThreadData::TNode& n = td->nodes[node];
+   n.count++;
+   n.ticks += dt;
+   if (dt > n.maxTicks) n.maxTicks = dt;
+   n.phaseTicks[td->phase] += dt;
+   if (node != 0) td->nodes[n.parent].childTicks += dt;
+
+   ThreadData::Event& e = td->ring[td->numEvents % RING_SIZE];
+   e.t0 = t0;
+   e.t1 = t1;
+   e.node = node;
+   e.phase = td->phase;
+   td->numEvents++;
+
+   base::unlock(td->lock);
+
+   td->cur = prevNode;
+}
+
+//------------------------------------------------------------------------------
+// getCallTree() -- merges the threads' call trees by component name
+//------------------------------------------------------------------------------
+unsigned int FrameProfiler::getCallTree(std::vector<Node>* const tree)
+{
+   struct MNode {
+      Node data;
+      std::map<std::string, unsigned int> children;
+   };
+
+   const double tps = getTicksPerSecond();
+   std::vector<MNode> merged(1);
+
+   for (const std::shared_ptr<ThreadData>& td : getAllThreadData()) {
+      base::lock(td->lock);
+      std::vector<unsigned int> map(td->nodes.size(), 0);
+      for (unsigned int i = 1; i < td->nodes.size(); i++) {
+         const ThreadData::TNode& tn = td->nodes[i];
+
+         // Parents are always created before their children
+         const unsigned int mp = map[tn.parent];
+         unsigned int mi = 0;
+         const auto it = merged[mp].children.find(tn.label);
+         if (it != merged[mp].children.end()) {
+            mi = it->second;
+         }
+         else {
+            mi = static_cast<unsigned int>(merged.size());
+            merged[mp].children[tn.label] = mi;
+            merged.emplace_back();
+            merged[mi].data.name = tn.label;
+            merged[mi].data.depth = merged[mp].data.depth + (mp != 0 ? 1 : 0);
+         }
+         map[i] = mi;
+
+         Node& m = merged[mi].data;
+         m.count += tn.count;
+         m.totalTime += tn.ticks / tps;
+         if (tn.ticks > tn.childTicks) m.selfTime += (tn.ticks - tn.childTicks) / tps;
+         if (tn.maxTicks / tps > m.maxTime) m.maxTime = tn.maxTicks / tps;
+         for (unsigned int k = 0; k < MAX_PHASES; k++) m.phaseTime[k] += tn.phaseTicks[k] / tps;
+      }
+      base::unlock(td->lock);
+   }
+
+   // Depth first, with the children in decreasing total time
+   tree->clear();
+   std::vector<unsigned int> stack;
+   {
+      std::vector<unsigned int> roots;
+      for (const auto& c : merged[0].children) roots.push_back(c.second);
+      std::sort(roots.begin(), roots.end(), [&merged](unsigned int a, unsigned int b) { return merged[a].data.totalTime < merged[b].data.totalTime; });
+      stack = roots;
+   }
+   while (!stack.empty()) {
+      const unsigned int mi = stack.back();
+      stack.pop_back();
+      tree->push_back(merged[mi].data);
+
+      std::vector<unsigned int> kids;
+      for (const auto& c : merged[mi].children) kids.push_back(c.second);
+      std::sort(kids.begin(), kids.end(), [&merged](unsigned int a, unsigned int b) { return merged[a].data.totalTime < merged[b].data.totalTime; });
+      stack.insert(stack.end(), kids.begin(), kids.end());
+   }
+
+   return static_cast<unsigned int>(tree->size());
+}
+
+//------------------------------------------------------------------------------
+// printCallTree() -- prints the merged call tree (times in ms)
+//------------------------------------------------------------------------------
+void FrameProfiler::printCallTree(std::ostream& sout, const double minTime)
+{
+   std::vector<Node> tree;
+   getCallTree(&tree);
+
+   sout << "        calls     total(ms)      self(ms)       max(ms)  component" << std::endl;
+   char buff[128];
+   for (const Node& n : tree) {
+      if (n.totalTime < minTime) continue;
+      std::snprintf(buff, sizeof(buff), "%13llu %13.3f %13.3f %13.3f  ",
+         n.count, n.totalTime * 1000.0, n.selfTime * 1000.0, n.maxTime * 1000.0);
+      sout << buff << std::string(n.depth * 2, ' ') << n.name << std::endl;
+   }
+}
+
+//------------------------------------------------------------------------------
+// writeChromeTrace() -- writes the ring buffers as Chrome trace "complete" events
+//------------------------------------------------------------------------------
+bool FrameProfiler::writeChromeTrace(std::ostream& sout)
+{
+   const double usPerTick = 1.0e6 / getTicksPerSecond();
+
+   sout << "{\"traceEvents\":[";
+   bool first = true;
+   char buff[160];
+   for (const std::shared_ptr<ThreadData>& td : getAllThreadData()) {
+      base::lock(td->lock);
+      const unsigned long long n = std::min<unsigned long long>(td->numEvents, RING_SIZE);
+      for (unsigned long long k = td->numEvents - n; k < td->numEvents; k++) {
+         const ThreadData::Event& e = td->ring[k % RING_SIZE];
+
+         // JSON string escapes
+         std::string name;
+         for (const char ch : td->nodes[e.node].label) {
+            if (ch == '"' || ch == '\\') name += '\\';
+            if (static_cast<unsigned char>(ch) >= 0x20) name += ch;
+         }
+
+         const double ts = static_cast<double>(static_cast<long long>(e.t0 - epochTicks)) * usPerTick;
+         const double dur = static_cast<double>(e.t1 - e.t0) * usPerTick;
+         std::snprintf(buff, sizeof(buff), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"phase\":%u}}",
+            ts, dur, td->index, e.phase);
+
+         sout << (first ? "\n" : ",\n") << "{\"name\":\"" << name << buff;
+         first = false;
+      }
+      base::unlock(td->lock);
+   }
+   sout << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+
+   return sout.good();
+}
+
+//------------------------------------------------------------------------------
+// clear() -- clears the statistics and ring buffers, and frees the data of the
+// threads that have exited; the call tree nodes may be in use, so each thread
+// drops them at the start of its next frame.
+//------------------------------------------------------------------------------
+void FrameProfiler::clear()
+{
+   base::lock(threadsLock);
+   threads.erase(std::remove_if(threads.begin(), threads.end(),
+      [](const std::shared_ptr<ThreadData>& td) { return td->exited.load(std::memory_order_relaxed); }), threads.end());
+   base::unlock(threadsLock);
+
+   for (const std::shared_ptr<ThreadData>& td : getAllThreadData()) {
+      base::lock(td->lock);
+      for (ThreadData::TNode& n : td->nodes) {
+         n.count = 0;
+         n.ticks = 0;
+         n.childTicks = 0;
+         n.maxTicks = 0;
+         for (unsigned int k = 0; k < MAX_PHASES; k++) n.phaseTicks[k] = 0;
+      }
+      td->numEvents = 0;
+      td->purge.store(true, std::memory_order_relaxed);
+      base::unlock(td->lock);
+   }
+}
+
+}
+}
@@ -24,29 +24,26 @@ END_SLOT_MAP()
 // initialization of static private members
 //==============================================================================
 
-unsigned int Rng::state[n] = {0x0};
-int Rng::p = 0;
-bool Rng::init = false;
+thread_local Rng::Stream Rng::ownStream;
+thread_local Rng::Stream* Rng::curStream = nullptr;
+
+std::atomic<unsigned int> Rng::defaultSeed(5489);
+std::atomic<unsigned int> Rng::nextIndex(0);
 
 Rng::Rng()
 {
    STANDARD_CONSTRUCTOR()
-   if (!init) {
-      seed(5489);
-   }
-   init = true;
+   initStream(&stream());
 }
 
 Rng::Rng(unsigned int s)
 {
    seed(s);
-   init = true;
 }
 
 Rng::Rng(const unsigned int* array, int size)
 {
    seed(array, size);
-   init = true;
 }
 
 //-----
@@ -62,6 +59,10 @@ double Rng::draw()
 //-----
 void Rng::gen_state()
 {
+   Stream& s = stream();
+   if (!s.init) initStream(&s);
+   unsigned int* const state = s.state;
+
    for (int i = 0; i < (n - m); ++i) {
       state[i] = state[i + m] ^ twiddle(state[i], state[i + 1]);
    }
@@ -71,7 +72,7 @@ void Rng::gen_state()
    }
    
    state[n - 1] = state[m - 1] ^ twiddle(state[n - 1], state[0]);
-   p = 0; // reset position
+   s.p = 0; // reset position
 }
 
 //-----
@@ -79,7 +80,31 @@ void Rng::gen_state()
 //-----
 void Rng::seed(unsigned int s)
 {
-   state[0] = s & 0xFFFFFFFF; // for > 32 bit machines
+   seedStream(&stream(), s, 0);
+}
+
+//-----
+// init by array
+//-----
+void Rng::seed(const unsigned int* array, int size)
+{
+   seedArray(&stream(), array, size);
+}
+
+//-----
+// seedStream() -- seeds 's' with 'seed' (index zero) or {seed, index}
+//-----
+void Rng::seedStream(Stream* const s, const unsigned int seed, const unsigned int index)
+{
+   if (index != 0) {
+      const unsigned int array[2] = { seed, index };
+      seedArray(s, array, 2);
+      s->seed = seed;
+      return;
+   }
+
+   unsigned int* const state = s->state;
+   state[0] = seed & 0xFFFFFFFF; // for > 32 bit machines
   
    for (int i = 1; i < n; ++i) {
       state[i] = 1812433253 * (state[i - 1] ^ (state[i - 1] >> 30)) + i;
@@ -89,15 +114,15 @@ void Rng::seed(unsigned int s)
       state[i] &= 0xFFFFFFFF; // for > 32 bit machines
    }
    
-   p = n; // force gen_state() to be called for next random number
+   s->p = n; // force gen_state() to be called for next random number
+   s->init = true;
+   s->seed = seed;
 }
 
-//-----
-// init by array
-//-----
-void Rng::seed(const unsigned int* array, int size)
+void Rng::seedArray(Stream* const s, const unsigned int* array, int size)
 {
-   seed(19650218);
+   seedStream(s, 19650218, 0);
+   unsigned int* const state = s->state;
    int i = 1;
    int j = 0;
    for (int k = ((n > size) ? n : size); k; --k) {
@@ -117,21 +142,106 @@ void Rng::seed(const unsigned int* array, int size)
    }
    
    state[0] = 0x80000000; // MSB is 1; assuring non-zero initial array
-   p = n; // force gen_state() to be called for next random number
+   s->p = n; // force gen_state() to be called for next random number
+   s->seed = (size > 0 ? array[0] : 0);
+}
+
+//-----
+// initStream() -- seeds an unseeded stream on its first use with the
+// default seed and the order of its first use
+//-----
+void Rng::initStream(Stream* const s)
+{
+   if (!s->init) {
+      const unsigned int idx = nextIndex++;
+      seedStream(s, defaultSeed, (idx == 0 ? 0 : (0x80000000 | idx)));
+   }
 }
 
 //-----
-// setSlotSeed()
+// calling thread's stream
+//-----
+Rng::Stream* Rng::getThreadStream()
+{
+   return &stream();
+}
+
+unsigned int Rng::getThreadSeed()
+{
+   Stream& s = stream();
+   initStream(&s);
+   return s.seed;
+}
+
+void Rng::setThreadStream(Stream* const s)
+{
+   curStream = s;
+}
+
+//-----
+// default seed of the unseeded streams
+//-----
+unsigned int Rng::getDefaultSeed()
+{
+   return defaultSeed;
+}
+
+void Rng::setDefaultSeed(const unsigned int s)
+{
+   defaultSeed = s;
+}
+
+//-----
+// setSlotSeed() -- seeds the calling thread's stream and sets the default
+// seed of the streams that haven't been seeded
 //-----
 bool Rng::setSlotSeed(const Number* const x)
 {
    bool ok = false;
    if(x != nullptr) {
+      setDefaultSeed(x->getInt());
       seed(x->getInt());
       ok = true;
    }
    return ok;
 }
 
+//-----
+// saveState(), restoreState() -- a stream's generator state (default: the
+// calling thread's stream)
+//-----
+void Rng::saveState(Checkpoint* const cp, const Stream* const s)
+{
+   const Stream* const ss = (s != nullptr ? s : &stream());
+   cp->beginSection();
+   cp->put(ss->init);
+   cp->put(ss->p);
+   cp->put(ss->seed);
+   cp->put(static_cast<const void*>(ss->state), sizeof(ss->state));
+   cp->endSection();
+}
+
+bool Rng::restoreState(Checkpoint::Reader* const rd, Stream* const s)
+{
+   Stream* const ss = (s != nullptr ? s : &stream());
+   bool init0 {};
+   int p0 {};
+   unsigned int seed0 {};
+   unsigned int state0[n] {};
+   bool ok = rd->beginSection() && rd->get(&init0) && rd->get(&p0) && rd->get(&seed0) &&
+             rd->get(static_cast<void*>(state0), sizeof(state0));
+   if (ok && p0 >= 0 && p0 <= n) {
+      ss->init = init0;
+      ss->p = p0;
+      ss->seed = seed0;
+      for (int i = 0; i < n; i++) ss->state[i] = state0[i];
+   }
+   else {
+      ok = false;
+   }
+   ok = rd->endSection() && ok;
+   return ok;
+}
+
 }
 }
@@ -10,6 +10,7 @@ SlotTable::SlotTable(const char* s[], const unsigned int ns, const SlotTable& ba
    baseTable = const_cast<SlotTable*>(&base);
    slots1 = const_cast<char**>(s);
    nslots1 = ns;
+   buildHash();
 }
 
 SlotTable::SlotTable(const char* s[], const unsigned int ns)
@@ -17,6 +18,7 @@ SlotTable::SlotTable(const char* s[], const unsigned int ns)
    baseTable = nullptr;
    slots1 = const_cast<char**>(s);
    nslots1 = ns;
+   buildHash();
 }
 
 SlotTable::~SlotTable()
@@ -71,15 +73,11 @@ unsigned int SlotTable::index(const char* const slotname) const
    // First, check our slot names
    {
       // search our table
-      unsigned int j;
-      for (j = 0; j < nslots1; j++) {
-         if (std::strcmp(slotname, slots1[j]) == 0) break;
-      }
-      if (j < nslots1) {
+      const unsigned int j = localIndex(slotname);
+      if (j > 0) {
          // if we're here, we found a match
-         i = j;                                    // a) start with j
-         i++;                                      // b) make it one based
-         if (baseTable != nullptr) i += baseTable->n();  // c) add baseTable->n()
+         i = j;                                    // a) start with j (one based)
+         if (baseTable != nullptr) i += baseTable->n();  // b) add baseTable->n()
       }
    }
 
@@ -89,6 +87,57 @@ unsigned int SlotTable::index(const char* const slotname) const
    return i;
 }
 
+//------------------------------------------------------------------------------
+// hashName() -- FNV-1a hash of a slot name
+//------------------------------------------------------------------------------
+static unsigned int hashName(const char* s)
+{
+   unsigned int h = 2166136261u;
+   while (*s != '\0') {
+      h ^= static_cast<unsigned char>(*s++);
+      h *= 16777619u;
+   }
+   return h;
+}
+
+//------------------------------------------------------------------------------
+// buildHash() -- hashes our slot names; open addressing with at most 50% load.
+// When a name is in the table more than once, the first one is used.
+//------------------------------------------------------------------------------
+void SlotTable::buildHash()
+{
+   hash.clear();
+   hashMask = 0;
+   if (slots1 == nullptr || nslots1 == 0) return;
+
+   unsigned int n = 4;
+   while (n < nslots1 * 2) n *= 2;
+   hash.assign(n, 0);
+   hashMask = n - 1;
+
+   for (unsigned int j = 0; j < nslots1; j++) {
+      if (slots1[j] == nullptr) continue;
+      if (localIndex(slots1[j]) > 0) continue;
+      unsigned int k = hashName(slots1[j]) & hashMask;
+      while (hash[k] != 0) k = (k + 1) & hashMask;
+      hash[k] = j + 1;
+   }
 }
+
+//------------------------------------------------------------------------------
+// localIndex() -- returns the index, [ 1 .. nslots1 ], of 'slotname' in our
+// slot names only, or zero if not found
+//------------------------------------------------------------------------------
+unsigned int SlotTable::localIndex(const char* const slotname) const
+{
+   if (hash.empty() || slotname == nullptr) return 0;
+   unsigned int k = hashName(slotname) & hashMask;
+   while (hash[k] != 0) {
+      if (std::strcmp(slotname, slots1[hash[k] - 1]) == 0) return hash[k];
+      k = (k + 1) & hashMask;
+   }
+   return 0;
 }
 
+}
+}
@@ -28,9 +28,9 @@ BEGIN_EVENT_HANDLER(StateMachine)
 
     ON_EVENT(ON_EXIT, onExit)
 
-   // If our current state is controlled by another StateMachine then
-   // see if this StateMachine will handled this event.
-   if (stMach != nullptr && !_used) _used = stMach->event(_event,_obj);
+    // If our current state is controlled by another StateMachine then
+    // see if this StateMachine will handled this event.
+    ON_ANYEVENT(onStMachEvent)
 END_EVENT_HANDLER()
 
 StateMachine::StateMachine()
@@ -338,6 +338,14 @@ bool StateMachine::onExit()
    return true;
 }
 
+// Passes the event to the StateMachine that controls our current state (if any)
+bool StateMachine::onStMachEvent(const int event, Object* const obj)
+{
+   bool used = false;
+   if (stMach != nullptr) used = stMach->event(event, obj);
+   return used;
+}
+
 bool StateMachine::onReturn(Object* const msg)
 {
    // Try to return to our calling state
@@ -83,6 +83,25 @@ bool Timer::setCurrentTime(const double sec) { ctime = sec; return true; }
 bool Timer::setAlarmTime(const double sec)   { alarmTime = sec; return true; }
 bool Timer::setTimerValue(const double sec)  { timerValue = sec; return true; }
 
+void Timer::saveState(Checkpoint* const cp) const
+{
+    cp->beginSection();
+    cp->put(ctime);
+    cp->put(alarmTime);
+    cp->put(timerValue);
+    cp->put(active);
+    cp->put(dir);
+    cp->endSection();
+}
+
+bool Timer::restoreState(Checkpoint::Reader* const rd)
+{
+    bool ok = rd->beginSection() && rd->get(&ctime) && rd->get(&alarmTime) &&
+              rd->get(&timerValue) && rd->get(&active) && rd->get(&dir);
+    ok = rd->endSection() && ok;
+    return ok;
+}
+
 bool Timer::freeze(const bool ff)
 {
     bool f = frz;
@@ -2,12 +2,19 @@
 #include "openeaagles/base/concurrent/PeriodicTask.hpp"
 
 #include "openeaagles/base/Component.hpp"
+#include "openeaagles/base/util/atomics.hpp"
 #include <iostream>
 
 namespace oe {
 namespace base {
 
 IMPLEMENT_ABSTRACT_SUBCLASS(PeriodicTask, "AbstractPeriodicTask")
+
+// Upper limits of the lateness histogram bins (seconds)
+static const double LATENESS_BINS[PeriodicTask::NUM_LATENESS_BINS] = {
+   10.0e-6, 50.0e-6, 100.0e-6, 500.0e-6, 1.0e-3, 5.0e-3, 10.0e-3, 1.0e30
+};
+
 EMPTY_SLOTTABLE(PeriodicTask)
 EMPTY_SERIALIZER(PeriodicTask)
 EMPTY_DELETEDATA(PeriodicTask)
@@ -60,5 +67,108 @@ bool PeriodicTask::setVariableDeltaTimeFlag(const bool enable)
    return true;
 }
 
+PeriodicTask::OverrunPolicy PeriodicTask::getOverrunPolicy() const
+{
+   // Variable delta time without a policy stretches the overrun frame
+   if (!policySet && vdtFlg) return OVERRUN_STRETCH;
+   return policy;
+}
+
+bool PeriodicTask::setOverrunPolicy(const OverrunPolicy p)
+{
+   policy = p;
+   policySet = true;
+   return true;
+}
+
+double PeriodicTask::getSpinTime() const
+{
+   return spinTime;
+}
+
+bool PeriodicTask::setSpinTime(const double seconds)
+{
+   bool ok = false;
+   if (seconds >= 0) {
+      spinTime = seconds;
+      ok = true;
+   }
+   return ok;
+}
+
+double PeriodicTask::getLatenessBinLimit(const unsigned int bin)
+{
+   return (bin < NUM_LATENESS_BINS ? LATENESS_BINS[bin] : 0.0);
+}
+
+//------------------------------------------------------------------------------
+// Frame statistics
+//------------------------------------------------------------------------------
+void PeriodicTask::frameStats(const double frameTime, const double late, const double overrun, const unsigned int skipped)
+{
+   lock(statsLock);
+
+   ftStats.sigma(frameTime);
+   ltStats.sigma(late);
+
+   unsigned int bin = 0;
+   while (bin < (NUM_LATENESS_BINS - 1) && late >= LATENESS_BINS[bin]) bin++;
+   lateness[bin]++;
+
+   if (overrun > 0) {
+      bfStats.sigma(overrun);
+      ocnt++;
+   }
+   scnt += skipped;
+
+   unlock(statsLock);
+}
+
+void PeriodicTask::getFrameStats(FrameStats* const stats) const
+{
+   if (stats == nullptr) return;
+
+   lock(statsLock);
+
+   stats->frames = tcnt;
+   stats->overruns = ocnt;
+   stats->skipped = scnt;
+   if (ftStats.getN() > 0) {
+      stats->lastFrameTime = ftStats.value();
+      stats->avgFrameTime = ftStats.mean();
+      stats->maxFrameTime = ftStats.maxValue();
+      stats->avgLateness = ltStats.mean();
+      stats->maxLateness = ltStats.maxValue();
+   }
+   else {
+      stats->lastFrameTime = 0.0;
+      stats->avgFrameTime = 0.0;
+      stats->maxFrameTime = 0.0;
+      stats->avgLateness = 0.0;
+      stats->maxLateness = 0.0;
+   }
+   for (unsigned int i = 0; i < NUM_LATENESS_BINS; i++) {
+      stats->lateness[i] = lateness[i];
+   }
+
+   unlock(statsLock);
+}
+
+void PeriodicTask::clearFrameStats()
+{
+   lock(statsLock);
+
+   bfStats.clear();
+   ftStats.clear();
+   ltStats.clear();
+   ocnt = 0;
+   scnt = 0;
+   for (unsigned int i = 0; i < NUM_LATENESS_BINS; i++) {
+      lateness[i] = 0;
+   }
+
+   unlock(statsLock);
+}
+
 }
 }
@@ -0,0 +1,88 @@
+
+#include "openeaagles/base/concurrent/PhaseBarrier.hpp"
+
+#include <thread>
+
+namespace oe {
+namespace base {
+
+PhaseBarrier::PhaseBarrier(const unsigned int n) : numWorkers(n)
+{
+   // No reason to spin if there's no one else to run
+   spinCount = (std::thread::hardware_concurrency() > 1 ? DEFAULT_SPIN_COUNT : 0);
+}
+
+void PhaseBarrier::setNumWorkers(const unsigned int n)
+{
+   numWorkers = n;
+}
+
+void PhaseBarrier::setSpinCount(const unsigned int n)
+{
+   spinCount = n;
+}
+
+unsigned int PhaseBarrier::getPhase() const
+{
+   return static_cast<unsigned int>(phase.load(std::memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+// Coordinator functions
+//------------------------------------------------------------------------------
+void PhaseBarrier::start()
+{
+   pending.store(static_cast<int>(numWorkers), std::memory_order_relaxed);
+   phase.fetch_add(1, std::memory_order_seq_cst);
+   if (startWaiters.load(std::memory_order_seq_cst) > 0) wakeAll(&phase);
+}
+
+void PhaseBarrier::waitForCompleted()
+{
+   for (unsigned int i = 0; i < spinCount; i++) {
+      if (pending.load(std::memory_order_acquire) <= 0) return;
+      pause();
+   }
+
+   doneWaiters.fetch_add(1, std::memory_order_seq_cst);
+   int n = pending.load(std::memory_order_seq_cst);
+   while (n > 0) {
+      waitOn(&pending, n);
+      n = pending.load(std::memory_order_seq_cst);
+   }
+   doneWaiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// Worker functions
+//------------------------------------------------------------------------------
+unsigned int PhaseBarrier::waitForStart(const unsigned int ph)
+{
+   const int old = static_cast<int>(ph);
+
+   for (unsigned int i = 0; i < spinCount; i++) {
+      const int cur = phase.load(std::memory_order_acquire);
+      if (cur != old) return static_cast<unsigned int>(cur);
+      pause();
+   }
+
+   startWaiters.fetch_add(1, std::memory_order_seq_cst);
+   int cur = phase.load(std::memory_order_seq_cst);
+   while (cur == old) {
+      waitOn(&phase, old);
+      cur = phase.load(std::memory_order_seq_cst);
+   }
+   startWaiters.fetch_sub(1, std::memory_order_relaxed);
+   return static_cast<unsigned int>(cur);
+}
+
+void PhaseBarrier::completed()
+{
+   // The last worker to complete wakes the coordinator
+   if (pending.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+      if (doneWaiters.load(std::memory_order_seq_cst) > 0) wakeAll(&pending);
+   }
+}
+
+}
+}
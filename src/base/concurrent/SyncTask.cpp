@@ -1,6 +1,7 @@
 
 #include "openeaagles/base/concurrent/SyncTask.hpp"
 
+#include "openeaagles/base/concurrent/PhaseBarrier.hpp"
 #include "openeaagles/base/Component.hpp"
 #include <iostream>
 
@@ -14,6 +15,10 @@ EMPTY_SERIALIZER(SyncTask)
 SyncTask::SyncTask(Component* const p, const double pri) : Thread(p, pri)
 {
    STANDARD_CONSTRUCTOR()
+
+   // Create the signals now, so the parent can signal 'start' before the
+   // thread has been configured
+   createSignals();
 }
 
 SyncTask::SyncTask()
@@ -35,6 +40,19 @@ void SyncTask::deleteData()
    closeSignals();
 }
 
+//-----------------------------------------------------------------------------
+// Set the shared start/completed barrier; we'll start with its next phase
+//-----------------------------------------------------------------------------
+bool SyncTask::setBarrier(PhaseBarrier* const b)
+{
+   bool ok = (getThreadHandle() == nullptr);
+   if (ok) {
+      barrier = b;
+      if (barrier != nullptr) barrierPhase = barrier->getPhase();
+   }
+   return ok;
+}
+
 //-----------------------------------------------------------------------------
 // Configure thread
 //-----------------------------------------------------------------------------
@@ -42,8 +60,8 @@ bool SyncTask::configThread()
 {
    bool ok = BaseClass::configThread();
 
-   // Create the signals
-   if (ok) ok = createSignals();
+   // Make sure we have the signals
+   if (ok) ok = (startSig != nullptr && completedSig != nullptr);
 
    if (!ok) {
       std::cerr << "SyncTask(" << this << ")::configThread() -- ERROR: Did NOT create the signals!" << std::endl;
@@ -70,11 +88,13 @@ unsigned long SyncTask::mainThreadFunc()
    while ( ok && getParent()->isNotShutdown() ) {
 
       // Wait for the start signal
-      waitForStart();
+      if (barrier != nullptr) barrierPhase = barrier->waitForStart(barrierPhase);
+      else waitForStart();
 
       // Just in case we've been shutdown while we were waiting
       if (getParent()->isShutdown()) {
-         signalCompleted();
+         if (barrier != nullptr) barrier->completed();
+         else signalCompleted();
          break;
       }
 
@@ -82,7 +102,8 @@ unsigned long SyncTask::mainThreadFunc()
       this->userFunc();
 
       // Signal that we've completed
-      signalCompleted();
+      if (barrier != nullptr) barrier->completed();
+      else signalCompleted();
    }
 
    return rtn;
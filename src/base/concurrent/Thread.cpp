@@ -98,6 +98,18 @@ size_t Thread::getStackSize() const
    return stackSize;
 }
 
+// Processors that the thread can run on (empty if any processor)
+const std::vector<unsigned int>& Thread::getCpuAffinity() const
+{
+   return cpuAffinity;
+}
+
+// The child thread's random number stream
+Rng::Stream* Thread::getRngStream()
+{
+   return &rngStream;
+}
+
 //-----------------------------------------------------------------------------
 // Set functions
 //-----------------------------------------------------------------------------
@@ -109,6 +121,20 @@ bool Thread::setStackSize(const size_t size)
    return true;
 }
 
+// Set the processors that the thread can run on (or an empty set for any)
+bool Thread::setCpuAffinity(const std::vector<unsigned int>& cpus)
+{
+   cpuAffinity = cpus;
+   return true;
+}
+
+// Seed the child thread's random number stream
+bool Thread::setRngSeed(const unsigned int seed, const unsigned int index)
+{
+   Rng::seedStream(&rngStream, seed, index);
+   return true;
+}
+
 // Set the terminated flag
 void Thread::setTerminated()
 {
@@ -6,6 +6,8 @@
 #include "openeaagles/base/util/system_utils.hpp"
 
 #include <signal.h>
+#include <errno.h>
+#include <time.h>
 #include <iostream>
 
 namespace oe {
@@ -14,6 +16,35 @@ namespace base {
 // max number of processors we'll allow
 static const unsigned int MAX_CPUS = 32;
 
+static const long long NSEC_PER_SEC = 1000000000LL;
+
+//-----------------------------------------------------------------------------
+// Monotonic clock (nanoseconds)
+//-----------------------------------------------------------------------------
+static long long monotonicTime()
+{
+   struct timespec tp;
+   clock_gettime(CLOCK_MONOTONIC, &tp);
+   return static_cast<long long>(tp.tv_sec) * NSEC_PER_SEC + tp.tv_nsec;
+}
+
+//-----------------------------------------------------------------------------
+// Wait until the absolute monotonic time 'deadline'; sleeps until 'spin'
+// nanoseconds before the deadline, then spins until the deadline.
+//-----------------------------------------------------------------------------
+static void waitUntil(const long long deadline, const long long spin)
+{
+   const long long wakeup = deadline - spin;
+   struct timespec tp;
+   tp.tv_sec = static_cast<time_t>(wakeup / NSEC_PER_SEC);
+   tp.tv_nsec = static_cast<long>(wakeup % NSEC_PER_SEC);
+   while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &tp, nullptr) == EINTR) {}
+
+   if (spin > 0) {
+      while (monotonicTime() < deadline) {}
+   }
+}
+
 //-----------------------------------------------------------------------------
 // Our main thread function
 //-----------------------------------------------------------------------------
@@ -24,52 +55,70 @@ unsigned long PeriodicTask::mainThreadFunc()
       std::cout << "Thread(" << this << ")::mainLoopFunc(): Starting main loop ..." << std::endl;
    }
 
-   // Delta time
-   const double dt = 1.0/static_cast<double>(getRate());
-   int sec0 = static_cast<int>(dt);
-   int nsec0 = static_cast<int>((dt - static_cast<double>(sec0)) * 1000000000.0);
-
-   // Reference time
-   struct timespec tp;
-   clock_gettime(CLOCK_REALTIME, &tp);
-
-   // Mutex
-   pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
-   pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-   pthread_mutex_lock(&mutex);
+   // Frame period
+   const double period = 1.0/static_cast<double>(getRate());
+   const auto periodNs = static_cast<long long>(period * static_cast<double>(NSEC_PER_SEC) + 0.5);
+   const auto spinNs = static_cast<long long>(getSpinTime() * static_cast<double>(NSEC_PER_SEC));
 
    // ---
    // Inital wait for one frame --
    // --- Linux seems to need this otherwise the userFunc() call failes.
    // ---
-   tp.tv_nsec += (nsec0);
-   if (tp.tv_nsec >= 1000000000) {
-      tp.tv_sec++;
-      tp.tv_nsec -= 1000000000;
-   }
-   pthread_cond_timedwait(&cond, &mutex, &tp);
+   long long deadline = monotonicTime() + periodNs;
+   waitUntil(deadline, spinNs);
 
+   double dt = period;
    while (!getParent()->isShutdown()) {
 
       // ---
       // User defined tasks
       // ---
+      const long long t0 = monotonicTime();
       this->userFunc(dt);
       tcnt++;
+      const long long t1 = monotonicTime();
 
       // ---
-      // Wait for the end of frame
+      // Next deadline
       // ---
-      tp.tv_nsec += (nsec0);
-      if (tp.tv_nsec >= 1000000000) {
-         tp.tv_sec++;
-         tp.tv_nsec -= 1000000000;
+      const long long frameStart = deadline;
+      deadline += periodNs;
+      dt = period;
+
+      double overrun = 0.0;
+      unsigned int skipped = 0;
+      if (t1 > deadline) {
+         overrun = static_cast<double>(t1 - deadline) / static_cast<double>(NSEC_PER_SEC);
+         switch (getOverrunPolicy()) {
+            case OVERRUN_SKIP: {
+               const long long missed = (t1 - deadline) / periodNs + 1;
+               deadline += missed * periodNs;
+               skipped = static_cast<unsigned int>(missed);
+               break;
+            }
+            case OVERRUN_STRETCH: {
+               deadline = t1;
+               break;
+            }
+            case OVERRUN_CATCH_UP: {
+               break;
+            }
+         }
+         if (isVariableDeltaTimeEnabled()) {
+            dt = static_cast<double>(deadline - frameStart) / static_cast<double>(NSEC_PER_SEC);
+         }
       }
-      pthread_cond_timedwait(&cond, &mutex, &tp);
 
-   }
+      frameStats(
+         static_cast<double>(t1 - t0) / static_cast<double>(NSEC_PER_SEC),
+         static_cast<double>(t0 - frameStart) / static_cast<double>(NSEC_PER_SEC),
+         overrun, skipped);
 
-   pthread_mutex_unlock(&mutex);
+      // ---
+      // Wait for the end of frame
+      // ---
+      waitUntil(deadline, spinNs);
+   }
 
    if (getParent()->isMessageEnabled(MSG_INFO) ) {
       std::cout << "Thread(" << this << ")::mainLoopFunc(): ... end of main loop." << std::endl;
@@ -36,49 +36,62 @@ unsigned long PeriodicTask::mainThreadFunc()
 
    // All of the real work is done by ...
    if (ok) {
-      double refTime = 0.0;                                  // Reference time
-      const double startTime = getComputerTime();;           // Computer's time of day (sec) run started
-      double dt = 1.0/static_cast<double>(getRate());
+      const double period = 1.0/static_cast<double>(getRate());
+      double refTime = getComputerTime();                    // Start time of the current frame (sec)
+      double dt = period;
 
       while (!getParent()->isShutdown()) {
 
          // ---
          // User defined tasks
          // ---
+         const double t0 = getComputerTime();
          this->userFunc(dt);
+         tcnt++;
+         const double t1 = getComputerTime();
 
          // ---
          // Wait for the start of the next frame
          // ---
          {
-            // Update reference time at the start of next frame
-            refTime = (refTime + dt);
-
-            // Current computer time
-            const double time = getComputerTime();
+            // Deadline of the next frame
+            const double frameStart = refTime;
+            refTime += period;
+            dt = period;
+
+            double overrun = 0.0;
+            unsigned int skipped = 0;
+            if (t1 > refTime) {
+               overrun = t1 - refTime;
+               switch (getOverrunPolicy()) {
+                  case OVERRUN_SKIP: {
+                     const auto missed = static_cast<unsigned int>(overrun / period) + 1;
+                     refTime += missed * period;
+                     skipped = missed;
+                     break;
+                  }
+                  case OVERRUN_STRETCH: {
+                     refTime = t1;
+                     break;
+                  }
+                  case OVERRUN_CATCH_UP: {
+                     break;
+                  }
+               }
+               if (isVariableDeltaTimeEnabled()) dt = refTime - frameStart;
+            }
 
-            // Actual run time
-            const double t0 = (time - startTime);
+            frameStats((t1 - t0), (t0 - frameStart), overrun, skipped);
 
             // How long should we sleep for
-            const double st = refTime - t0;
+            const double st = refTime - getComputerTime() - getSpinTime();
             const auto sleepFor = static_cast<int>(st*1000.0);
 
             // wait for the next frame
             if (sleepFor > 0) Sleep(sleepFor);
-
-            // Compute next delta time and update frame stats
-            dt = 1.0/static_cast<double>(getRate());
-            if (st < 0) {
-               const double overrun = -st;
-               bfStats.sigma(overrun);
-               if (vdtFlg) {
-                  // adjust for overrun
-                  dt += overrun;
-                  refTime += overrun;
-               }
+            if (getSpinTime() > 0) {
+               while (getComputerTime() < refTime) {}
             }
-            tcnt++;
          }
       }
    }
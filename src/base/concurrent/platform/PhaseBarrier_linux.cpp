@@ -0,0 +1,40 @@
+
+#include "openeaagles/base/concurrent/PhaseBarrier.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+
+namespace oe {
+namespace base {
+
+//-----------------------------------------------------------------------------
+// Sleep while *addr == value (futex wait); may return early (spurious wakeup),
+// so callers re-check their condition.
+//-----------------------------------------------------------------------------
+void PhaseBarrier::waitOn(std::atomic<int>* const addr, const int value)
+{
+   syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Wake all threads sleeping on addr
+//-----------------------------------------------------------------------------
+void PhaseBarrier::wakeAll(std::atomic<int>* const addr)
+{
+   syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Spin loop hint
+//-----------------------------------------------------------------------------
+void PhaseBarrier::pause()
+{
+#if defined(__i386__) || defined(__x86_64__)
+   __builtin_ia32_pause();
+#endif
+}
+
+}
+}
@@ -0,0 +1,39 @@
+
+#include "openeaagles/base/concurrent/PhaseBarrier.hpp"
+
+#include <windows.h>
+
+// WaitOnAddress() and WakeByAddressAll() (Windows 8 and later)
+#pragma comment(lib, "synchronization.lib")
+
+namespace oe {
+namespace base {
+
+//-----------------------------------------------------------------------------
+// Sleep while *addr == value; may return early (spurious wakeup),
+// so callers re-check their condition.
+//-----------------------------------------------------------------------------
+void PhaseBarrier::waitOn(std::atomic<int>* const addr, const int value)
+{
+   int v = value;
+   WaitOnAddress(reinterpret_cast<volatile VOID*>(addr), &v, sizeof(int), INFINITE);
+}
+
+//-----------------------------------------------------------------------------
+// Wake all threads sleeping on addr
+//-----------------------------------------------------------------------------
+void PhaseBarrier::wakeAll(std::atomic<int>* const addr)
+{
+   WakeByAddressAll(reinterpret_cast<PVOID>(addr));
+}
+
+//-----------------------------------------------------------------------------
+// Spin loop hint
+//-----------------------------------------------------------------------------
+void PhaseBarrier::pause()
+{
+   YieldProcessor();
+}
+
+}
+}
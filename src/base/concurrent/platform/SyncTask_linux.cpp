@@ -5,8 +5,15 @@
 #include "openeaagles/base/util/math_utils.hpp"
 #include "openeaagles/base/util/system_utils.hpp"
 
+#include "openeaagles/base/concurrent/PhaseBarrier.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <signal.h>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 namespace oe {
 namespace base {
@@ -14,26 +21,69 @@ namespace base {
 // max number of processors we'll allow
 static const unsigned int MAX_CPUS = 32;
 
+// ---
+// The start and completed signals are binary semaphores on a futex word:
+//    1 -- signaled
+//    0 -- not signaled
+//   -1 -- not signaled, and the (single) waiter is sleeping in the kernel
+//
+// Waiters spin for a short time before sleeping, and the signaling thread
+// only makes the futex wake call when the waiter is sleeping.
+// ---
+using Signal = std::atomic<int>;
+
+static unsigned int spinCount()
+{
+   static const unsigned int n = (std::thread::hardware_concurrency() > 1 ? PhaseBarrier::DEFAULT_SPIN_COUNT : 0);
+   return n;
+}
+
+static void cpuPause()
+{
+#if defined(__i386__) || defined(__x86_64__)
+   __builtin_ia32_pause();
+#endif
+}
+
+static bool tryWaitSignal(Signal* const sig)
+{
+   int v = 1;
+   return sig->compare_exchange_strong(v, 0, std::memory_order_acquire);
+}
+
+static void waitSignal(Signal* const sig)
+{
+   const unsigned int n = spinCount();
+   for (unsigned int i = 0; i < n; i++) {
+      if (tryWaitSignal(sig)) return;
+      cpuPause();
+   }
+
+   while (!tryWaitSignal(sig)) {
+      int v = 0;
+      if (sig->compare_exchange_strong(v, -1) || v == -1) {
+         syscall(SYS_futex, reinterpret_cast<int*>(sig), FUTEX_WAIT_PRIVATE, -1, nullptr, nullptr, 0);
+      }
+   }
+}
+
+static void setSignal(Signal* const sig)
+{
+   if (sig->exchange(1, std::memory_order_release) == -1) {
+      syscall(SYS_futex, reinterpret_cast<int*>(sig), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+   }
+}
+
 //-----------------------------------------------------------------------------
 // create the signals
 //-----------------------------------------------------------------------------
 bool SyncTask::createSignals()
 {
-   // create the start mutex already set, signalStart() will release it.
-   {
-      pthread_mutex_t* mutex = new pthread_mutex_t;
-      pthread_mutex_init(mutex,nullptr);
-      pthread_mutex_lock(mutex);
-      startSig = mutex;
-   }
+   // create the start signal already cleared, signalStart() will set it.
+   startSig = new Signal(0);
 
-   // create the completed semaphore already set, signalCompleted() will release it.
-   {
-      pthread_mutex_t* mutex = new pthread_mutex_t;
-      pthread_mutex_init(mutex,nullptr);
-      pthread_mutex_lock(mutex);
-      completedSig = mutex;
-   }
+   // create the completed signal already cleared, signalCompleted() will set it.
+   completedSig = new Signal(0);
 
    return true;
 }
@@ -43,17 +93,11 @@ bool SyncTask::createSignals()
 //-----------------------------------------------------------------------------
 void SyncTask::closeSignals()
 {
-   {
-      pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(startSig);
-      startSig = nullptr;
-      pthread_mutex_destroy(mutex);
-   }
+   delete static_cast<Signal*>(startSig);
+   startSig = nullptr;
 
-   {
-      pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(completedSig);
-      completedSig = nullptr;
-      pthread_mutex_destroy(mutex);
-   }
+   delete static_cast<Signal*>(completedSig);
+   completedSig = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -61,8 +105,7 @@ void SyncTask::closeSignals()
 //-----------------------------------------------------------------------------
 void SyncTask::signalStart()
 {
-   pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(startSig);
-   pthread_mutex_unlock(mutex);
+   if (startSig != nullptr) setSignal(static_cast<Signal*>(startSig));
 }
 
 //-----------------------------------------------------------------------------
@@ -70,8 +113,7 @@ void SyncTask::signalStart()
 //-----------------------------------------------------------------------------
 void SyncTask::waitForStart()
 {
-   pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(startSig);
-   pthread_mutex_lock(mutex);
+   if (startSig != nullptr) waitSignal(static_cast<Signal*>(startSig));
 }
 
 //-----------------------------------------------------------------------------
@@ -79,8 +121,7 @@ void SyncTask::waitForStart()
 //-----------------------------------------------------------------------------
 void SyncTask::signalCompleted()
 {
-   pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(completedSig);
-   pthread_mutex_unlock(mutex);
+   if (completedSig != nullptr) setSignal(static_cast<Signal*>(completedSig));
 }
 
 //-----------------------------------------------------------------------------
@@ -88,8 +129,7 @@ void SyncTask::signalCompleted()
 //-----------------------------------------------------------------------------
 void SyncTask::waitForCompleted()
 {
-   pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(completedSig);
-   pthread_mutex_lock(mutex);
+   if (completedSig != nullptr) waitSignal(static_cast<Signal*>(completedSig));
 }
 
 //-----------------------------------------------------------------------------
@@ -124,8 +164,8 @@ int SyncTask::waitForAnyCompleted(SyncTask** threads, const unsigned int num)
          while(true) {
             for (i = 0; i < num; i++) {
                if (threads[i] != nullptr) {
-                  pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(threads[i]->completedSig);
-                  if (pthread_mutex_trylock(mutex) == 0) {
+                  Signal* sig = static_cast<Signal*>(threads[i]->completedSig);
+                  if (sig != nullptr && tryWaitSignal(sig)) {
                      return i;
                   }
                }
@@ -5,7 +5,10 @@
 #include "openeaagles/base/util/math_utils.hpp"
 #include "openeaagles/base/util/system_utils.hpp"
 
+#include <dirent.h>
 #include <signal.h>
+#include <unistd.h>
+#include <cstdio>
 #include <iostream>
 
 namespace oe {
@@ -26,11 +29,16 @@ void* Thread::staticThreadFunc(void* lpParam)
    thread->ref();
    parent->ref();
 
+   // Draw our random numbers from the Thread class's stream
+   Rng::setThreadStream(thread->getRngStream());
+
    // The main thread function, which is a Thread class memeber function,
    // will handle the rest.
    unsigned long rtn = thread->mainThreadFunc();
    thread->setTerminated();
 
+   Rng::setThreadStream(nullptr);
+
    parent->unref();
    thread->unref();
 
@@ -56,6 +64,40 @@ unsigned short Thread::getNumProcessors()
    return num;
 }
 
+//-----------------------------------------------------------------------------
+// Static function returns the number of processors that are online
+//-----------------------------------------------------------------------------
+unsigned int Thread::getNumOnlineCpus()
+{
+   const long n = sysconf(_SC_NPROCESSORS_ONLN);
+   return (n > 0 ? static_cast<unsigned int>(n) : 1);
+}
+
+//-----------------------------------------------------------------------------
+// Static function returns the NUMA node of processor 'cpu'
+//-----------------------------------------------------------------------------
+unsigned int Thread::getCpuNode(const unsigned int cpu)
+{
+   // The node is the 'nodeN' link in the processor's sysfs directory
+   char path[128];
+   std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u", cpu);
+   DIR* dir = opendir(path);
+   if (dir == nullptr) return 0;
+
+   unsigned int node = 0;
+   struct dirent* entry = readdir(dir);
+   while (entry != nullptr) {
+      unsigned int n = 0;
+      if (std::sscanf(entry->d_name, "node%u", &n) == 1) {
+         node = n;
+         break;
+      }
+      entry = readdir(dir);
+   }
+   closedir(dir);
+   return node;
+}
+
 //-----------------------------------------------------------------------------
 // Create the thread
 //-----------------------------------------------------------------------------
@@ -106,14 +148,63 @@ bool Thread::createThread()
    }
 
    // ---
-   // Create the thread
+   // Processor affinity (online processors only)
+   // ---
+   bool affinity = false;
+   if (!cpuAffinity.empty()) {
+      const unsigned int numCpus = getNumOnlineCpus();
+      cpu_set_t mask;
+      CPU_ZERO(&mask);
+      for (const unsigned int cpu : cpuAffinity) {
+         if (cpu < numCpus && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &mask);
+            affinity = true;
+         }
+      }
+      int stat = -1;
+      if (affinity) {
+         stat = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &mask);
+         affinity = (stat == 0);
+      }
+      if (!affinity && parent->isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "Thread(" << this << ")::createThread(): WARNING, unable to set the processor affinity (";
+         if (stat > 0) std::cerr << "error " << stat;
+         else std::cerr << "no online processors in the set";
+         std::cerr << "); the thread can run on any processor" << std::endl;
+      }
+   }
+
+   // ---
+   // Create the thread; if the affinity is refused, try again without it
    // ---
    pthread_t* thread = new pthread_t;
-   pthread_create(thread, &attr, staticThreadFunc, this);
+   int stat = pthread_create(thread, &attr, staticThreadFunc, this);
+   if (stat != 0 && affinity) {
+      if (parent->isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "Thread(" << this << ")::createThread(): WARNING, pthread_create() failed with the processor affinity (error ";
+         std::cerr << stat << "); the thread can run on any processor" << std::endl;
+      }
+      cpu_set_t all;
+      CPU_ZERO(&all);
+      const unsigned int numCpus = getNumOnlineCpus();
+      for (unsigned int cpu = 0; cpu < numCpus && cpu < CPU_SETSIZE; cpu++) CPU_SET(cpu, &all);
+      pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &all);
+      stat = pthread_create(thread, &attr, staticThreadFunc, this);
+   }
+   pthread_attr_destroy(&attr);
 
-   //if ( stat != 0 && parent->isMessageEnabled(MSG_INFO) ) {
-      std::cout << "Thread(" << this << ")::createThread(): pthread_create() thread = " << thread << ", pri = " << param.sched_priority << std::endl;
-   //}
+   if (stat != 0) {
+      if (parent->isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Thread(" << this << ")::createThread(): ERROR, pthread_create() failed (error " << stat << ")" << std::endl;
+      }
+      delete thread;
+      thread = nullptr;
+   }
+   else {
+      //if ( parent->isMessageEnabled(MSG_INFO) ) {
+         std::cout << "Thread(" << this << ")::createThread(): pthread_create() thread = " << thread << ", pri = " << param.sched_priority << std::endl;
+      //}
+   }
 
    theThread = thread;
 
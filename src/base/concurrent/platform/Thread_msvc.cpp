@@ -29,11 +29,16 @@ DWORD WINAPI Thread::staticThreadFunc(LPVOID lpParam)
    thread->ref();
    parent->ref();
 
+   // Draw our random numbers from the Thread class's stream
+   Rng::setThreadStream(thread->getRngStream());
+
    // The main thread function, which is a Thread class memeber function,
    // will handle the rest.
    DWORD rtn = thread->mainThreadFunc();
    thread->setTerminated();
 
+   Rng::setThreadStream(nullptr);
+
    parent->unref();
    thread->unref();
 
@@ -63,6 +68,28 @@ unsigned short Thread::getNumProcessors()
    return num;
 }
 
+//-----------------------------------------------------------------------------
+// Static function returns the number of processors that are online
+//-----------------------------------------------------------------------------
+unsigned int Thread::getNumOnlineCpus()
+{
+   SYSTEM_INFO info;
+   GetSystemInfo(&info);
+   return (info.dwNumberOfProcessors > 0 ? static_cast<unsigned int>(info.dwNumberOfProcessors) : 1);
+}
+
+//-----------------------------------------------------------------------------
+// Static function returns the NUMA node of processor 'cpu'
+//-----------------------------------------------------------------------------
+unsigned int Thread::getCpuNode(const unsigned int cpu)
+{
+   UCHAR node = 0;
+   if (cpu < 256 && GetNumaProcessorNode(static_cast<UCHAR>(cpu), &node) != 0 && node != 0xff) {
+      return node;
+   }
+   return 0;
+}
+
 //-----------------------------------------------------------------------------
 // Create the thread
 //-----------------------------------------------------------------------------
@@ -86,6 +113,20 @@ bool Thread::createThread()
       std::cout << "Thread(" << this << ")::createThread(): CreateThread() handle = " << hnd << std::endl;
    }
 
+   // Processor affinity (this process's group and online processors only)
+   if (hnd != 0 && !cpuAffinity.empty()) {
+      const unsigned int numCpus = getNumOnlineCpus();
+      DWORD_PTR mask = 0;
+      for (const unsigned int cpu : cpuAffinity) {
+         if (cpu < numCpus && cpu < (sizeof(DWORD_PTR) * 8)) mask |= (static_cast<DWORD_PTR>(1) << cpu);
+      }
+      const bool ok = (mask != 0 && SetThreadAffinityMask(hnd, mask) != 0);
+      if (!ok && parent->isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "Thread(" << this << ")::createThread(): WARNING, unable to set the processor affinity; ";
+         std::cerr << "the thread can run on any processor" << std::endl;
+      }
+   }
+
    theThread = hnd;
 
    return (hnd != 0);
@@ -0,0 +1,44 @@
+
+#ifndef _oe_base_EdlForm_H_
+#define _oe_base_EdlForm_H_
+
+#include "openeaagles/base/Object.hpp"
+#include <string>
+
+namespace oe {
+namespace base {
+class PairStream;
+
+//------------------------------------------------------------------------------
+// Class: EdlForm
+//
+// Description: An unconstructed EDL form, "( factoryName slots ... )", as
+//              returned by edl_parse_forms().  Used by the snapshot compiler
+//              (see edl_compile()), which needs the parse tree, and not the
+//              objects that the factory would have built from it.
+//------------------------------------------------------------------------------
+class EdlForm : public Object
+{
+   DECLARE_SUBCLASS(EdlForm, Object)
+
+public:
+   EdlForm();
+   EdlForm(const std::string& factoryName, PairStream* const args);
+
+   const std::string& getName() const           { return name; }
+   const PairStream* getArgs() const            { return args; }
+
+private:
+   std::string name;          // Factory name
+   PairStream* args {};       // Slot name/value pairs (ref()'d)
+};
+
+// Parses the EDL file, 'filename', without calling a factory; each form is
+// returned as an EdlForm.
+extern Object* edl_parse_forms(const std::string& filename, unsigned int* num_errors = nullptr);
+
+}
+}
+
+#endif
+
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_EDLPARSER_HPP_INCLUDED
 # define YY_YY_EDLPARSER_HPP_INCLUDED
 /* Debug traces.  */
@@ -39,27 +44,37 @@
 #if YYDEBUG
 extern int yydebug;
 #endif
+/* "%code requires" blocks.  */
+#line 23 "edl_parser.y"
+
+struct EdlParseContext;
+
+#line 53 "EdlParser.hpp"
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    IDENT = 258,
-    SLOT_ID = 259,
-    INTEGERconstant = 260,
-    FLOATINGconstant = 261,
-    BOOLconstant = 262,
-    STRING_LITERAL = 263
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    SLOT_ID = 259,                 /* SLOT_ID  */
+    INTEGERconstant = 260,         /* INTEGERconstant  */
+    FLOATINGconstant = 261,        /* FLOATINGconstant  */
+    BOOLconstant = 262,            /* BOOLconstant  */
+    STRING_LITERAL = 263           /* STRING_LITERAL  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 108 "edl_parser.y" /* yacc.c:1909  */
+#line 143 "edl_parser.y"
 
    double                     dval;
    long                       lval;
@@ -71,17 +86,25 @@ union YYSTYPE
    oe::base::List*            lvalp;
    oe::base::Number*          nvalp;
 
-#line 75 "EdlParser.hpp" /* yacc.c:1909  */
-};
+#line 90 "EdlParser.hpp"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+
+int yyparse (EdlParseContext* ctx);
+
+/* "%code provides" blocks.  */
+#line 27 "edl_parser.y"
+
+// Token value set by the scanner (one per thread)
+extern thread_local YYSTYPE yylval;
+
+#line 109 "EdlParser.hpp"
 
 #endif /* !YY_YY_EDLPARSER_HPP_INCLUDED  */
@@ -0,0 +1,655 @@
+//------------------------------------------------------------------------------
+// Description: Binary EDL snapshots (see edl_compile() and edl_load())
+//
+//    A snapshot is the parse tree of an EDL file, with the factory names and
+//    slot names of the forms resolved to the objects' slot index numbers, so
+//    the objects can be constructed without scanning, parsing or looking up
+//    slot names.
+//
+//    Snapshot file layout (native byte order):
+//
+//       header:     magic[8], version (u32), EDL file size (u64), EDL file hash (u64)
+//       strings:    count (u32), then for each: length (u32), characters, '\0'
+//       slot refs:  count (u32), then for each: factory name (u32 string number),
+//                   slot index (i32), slot name (u32 string number)
+//       tree:       the root node
+//
+//    Nodes are a one byte tag followed by the node's data:
+//
+//       NODE_NULL         (none)
+//       NODE_STRING       string number (u32)
+//       NODE_IDENT        string number (u32)
+//       NODE_INTEGER      value (i32)
+//       NODE_FLOAT        value (f64)
+//       NODE_BOOLEAN      value (u8)
+//       NODE_LIST         count (u32), then the number nodes
+//       NODE_PAIRSTREAM   count (u32), then for each: slot name (u32), node
+//       NODE_PAIR         slot name (u32), node
+//       NODE_FORM         factory name (u32), count (u32), then for each:
+//                         slot ref number (u32), node
+//
+//    The slot index numbers depend on the classes' slot tables, so each slot
+//    ref is checked against the class the first time it's used; a mismatch
+//    (i.e., the classes have changed since the snapshot was compiled) makes
+//    the snapshot stale.
+//------------------------------------------------------------------------------
+#include "openeaagles/base/edl_parser.hpp"
+#include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/String.hpp"
+#include "openeaagles/base/Identifier.hpp"
+#include "openeaagles/base/Integer.hpp"
+#include "openeaagles/base/Float.hpp"
+#include "openeaagles/base/Boolean.hpp"
+#include "openeaagles/base/Pair.hpp"
+#include "openeaagles/base/PairStream.hpp"
+#include "openeaagles/base/List.hpp"
+#include "EdlForm.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace oe {
+namespace base {
+
+//==============================================================================
+// Class: EdlForm
+//==============================================================================
+IMPLEMENT_EMPTY_SLOTTABLE_SUBCLASS(EdlForm, "EdlForm")
+EMPTY_SERIALIZER(EdlForm)
+
+EdlForm::EdlForm()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+EdlForm::EdlForm(const std::string& factoryName, PairStream* const a) : name(factoryName)
+{
+   STANDARD_CONSTRUCTOR()
+   if (a != nullptr) {
+      args = a;
+      args->ref();
+   }
+}
+
+void EdlForm::copyData(const EdlForm& org, const bool)
+{
+   BaseClass::copyData(org);
+   name = org.name;
+   if (args != nullptr) args->unref();
+   args = org.args;
+   if (args != nullptr) args->ref();
+}
+
+void EdlForm::deleteData()
+{
+   if (args != nullptr) {
+      args->unref();
+      args = nullptr;
+   }
+}
+
+//==============================================================================
+// Snapshot file format
+//==============================================================================
+namespace {
+
+const char MAGIC[8] = { 'O', 'E', 'E', 'D', 'L', 'S', 'N', 'P' };
+const std::uint32_t VERSION = 1;
+
+enum : unsigned char {
+   NODE_NULL, NODE_STRING, NODE_IDENT, NODE_INTEGER, NODE_FLOAT,
+   NODE_BOOLEAN, NODE_LIST, NODE_PAIRSTREAM, NODE_PAIR, NODE_FORM
+};
+
+//------------------------------------------------------------------------------
+// readFile() -- reads the whole file into 'data'
+//------------------------------------------------------------------------------
+bool readFile(const std::string& filename, std::vector<char>* const data)
+{
+   std::ifstream fin(filename, std::ios::in | std::ios::binary);
+   if (!fin) return false;
+   fin.seekg(0, std::ios::end);
+   const std::streamoff n = fin.tellg();
+   if (n < 0) return false;
+   fin.seekg(0, std::ios::beg);
+   data->resize(static_cast<std::size_t>(n));
+   if (n > 0) fin.read(data->data(), n);
+   return static_cast<bool>(fin);
+}
+
+//------------------------------------------------------------------------------
+// sourceStamp() -- the EDL file's size and hash (64 bit FNV-1a), which are
+// used to check that a snapshot is current
+//------------------------------------------------------------------------------
+bool sourceStamp(const std::string& filename, std::uint64_t* const size, std::uint64_t* const hash)
+{
+   std::vector<char> data;
+   if (!readFile(filename, &data)) return false;
+   std::uint64_t h = 14695981039346656037ULL;
+   for (const char c : data) {
+      h ^= static_cast<unsigned char>(c);
+      h *= 1099511628211ULL;
+   }
+   *size = data.size();
+   *hash = h;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Class: SnapWriter -- compiles a parse tree (see edl_parse_forms()) into a
+// snapshot.  A prototype of each form's class, made by the factory, is used
+// to look up the slot index numbers.
+//------------------------------------------------------------------------------
+class SnapWriter
+{
+public:
+   SnapWriter(factory_func f, const std::string& fn) : factory(f), filename(fn) {}
+   SnapWriter(const SnapWriter&) = delete;
+   SnapWriter& operator=(const SnapWriter&) = delete;
+   ~SnapWriter() {
+      for (auto& p : protos) {
+         if (p.second != nullptr) p.second->unref();
+      }
+   }
+
+   void node(const Object* const obj);
+   bool write(const std::string& snapshot, const std::uint64_t size, const std::uint64_t hash) const;
+   unsigned int errors() const     { return err_count; }
+
+private:
+   void error(const std::string& msg) {
+      std::cerr << "In " << filename << ": " << msg << std::endl;
+      err_count++;
+   }
+
+   void put8(const unsigned char v)          { body.push_back(static_cast<char>(v)); }
+   void put32(const std::uint32_t v)         { putBytes(&body, &v, sizeof(v)); }
+   void putInt(const std::int32_t v)         { putBytes(&body, &v, sizeof(v)); }
+   void putDouble(const double v)            { putBytes(&body, &v, sizeof(v)); }
+   static void putBytes(std::string* const s, const void* const v, const std::size_t n) {
+      s->append(static_cast<const char*>(v), n);
+   }
+
+   std::uint32_t str(const char* const s);
+   std::uint32_t slotRef(const std::string& factoryName, const char* const slotname);
+
+   factory_func factory {};
+   std::string filename;                  // EDL file name (for messages)
+   unsigned int err_count {};
+
+   std::string body;                      // Encoded tree
+   std::vector<std::string> strings;      // String table
+   std::map<std::string, std::uint32_t> stringIds;
+   std::vector<std::tuple<std::uint32_t, std::int32_t, std::uint32_t>> slotRefs;
+   std::map<std::tuple<std::uint32_t, std::int32_t, std::uint32_t>, std::uint32_t> slotRefIds;
+   std::map<std::string, Object*> protos; // Prototype objects by factory name
+};
+
+std::uint32_t SnapWriter::str(const char* const s)
+{
+   const std::string key(s != nullptr ? s : "");
+   const auto it = stringIds.find(key);
+   if (it != stringIds.end()) return it->second;
+   const auto id = static_cast<std::uint32_t>(strings.size());
+   strings.push_back(key);
+   stringIds[key] = id;
+   return id;
+}
+
+std::uint32_t SnapWriter::slotRef(const std::string& factoryName, const char* const slotname)
+{
+   // The prototype object for this factory name
+   Object* proto {};
+   const auto it = protos.find(factoryName);
+   if (it != protos.end()) {
+      proto = it->second;
+   } else {
+      proto = (factory != nullptr ? factory(factoryName) : nullptr);
+      protos[factoryName] = proto;
+      if (proto == nullptr) error("undefined factory name: " + factoryName);
+   }
+
+   int idx {};
+   if (proto != nullptr) {
+      idx = proto->slotName2Index(slotname);
+      if (idx <= 0) error("slot not found: " + std::string(slotname) + " in " + factoryName);
+   }
+
+   const auto key = std::make_tuple(str(factoryName.c_str()), static_cast<std::int32_t>(idx), str(slotname));
+   const auto rit = slotRefIds.find(key);
+   if (rit != slotRefIds.end()) return rit->second;
+   const auto id = static_cast<std::uint32_t>(slotRefs.size());
+   slotRefs.push_back(key);
+   slotRefIds[key] = id;
+   return id;
+}
+
+//------------------------------------------------------------------------------
+// node() -- encodes 'obj' and its children
+//------------------------------------------------------------------------------
+void SnapWriter::node(const Object* const obj)
+{
+   if (obj == nullptr) {
+      put8(NODE_NULL);
+   }
+
+   else if (const auto form = dynamic_cast<const EdlForm*>(obj)) {
+      put8(NODE_FORM);
+      put32(str(form->getName().c_str()));
+      const PairStream* const args = form->getArgs();
+      put32(args != nullptr ? args->entries() : 0);
+      if (args != nullptr) {
+         for (const List::Item* item = args->getFirstItem(); item != nullptr; item = item->getNext()) {
+            const auto p = static_cast<const Pair*>(item->getValue());
+            put32(slotRef(form->getName(), *p->slot()));
+            node(p->object());
+         }
+      }
+   }
+
+   else if (const auto pair = dynamic_cast<const Pair*>(obj)) {
+      put8(NODE_PAIR);
+      put32(str(*pair->slot()));
+      node(pair->object());
+   }
+
+   else if (const auto stream = dynamic_cast<const PairStream*>(obj)) {
+      put8(NODE_PAIRSTREAM);
+      put32(stream->entries());
+      for (const List::Item* item = stream->getFirstItem(); item != nullptr; item = item->getNext()) {
+         const auto p = static_cast<const Pair*>(item->getValue());
+         put32(str(*p->slot()));
+         node(p->object());
+      }
+   }
+
+   else if (const auto list = dynamic_cast<const List*>(obj)) {
+      put8(NODE_LIST);
+      put32(list->entries());
+      for (const List::Item* item = list->getFirstItem(); item != nullptr; item = item->getNext()) {
+         node(item->getValue());
+      }
+   }
+
+   else if (const auto ident = dynamic_cast<const Identifier*>(obj)) {
+      put8(NODE_IDENT);
+      put32(str(*ident));
+   }
+
+   else if (const auto s = dynamic_cast<const String*>(obj)) {
+      put8(NODE_STRING);
+      put32(str(*s));
+   }
+
+   else if (const auto b = dynamic_cast<const Boolean*>(obj)) {
+      put8(NODE_BOOLEAN);
+      put8(b->getBoolean() ? 1 : 0);
+   }
+
+   else if (const auto i = dynamic_cast<const Integer*>(obj)) {
+      put8(NODE_INTEGER);
+      putInt(i->getInt());
+   }
+
+   else if (const auto f = dynamic_cast<const Float*>(obj)) {
+      put8(NODE_FLOAT);
+      putDouble(f->getDouble());
+   }
+
+   else {
+      error("unexpected object type in parse tree");
+      put8(NODE_NULL);
+   }
+}
+
+//------------------------------------------------------------------------------
+// write() -- writes the snapshot file; a temporary file is written and then
+// renamed, so readers never see a partial snapshot
+//------------------------------------------------------------------------------
+bool SnapWriter::write(const std::string& snapshot, const std::uint64_t size, const std::uint64_t hash) const
+{
+   std::string head;
+   putBytes(&head, MAGIC, sizeof(MAGIC));
+   putBytes(&head, &VERSION, sizeof(VERSION));
+   putBytes(&head, &size, sizeof(size));
+   putBytes(&head, &hash, sizeof(hash));
+
+   auto n = static_cast<std::uint32_t>(strings.size());
+   putBytes(&head, &n, sizeof(n));
+   for (const std::string& s : strings) {
+      const auto len = static_cast<std::uint32_t>(s.size());
+      putBytes(&head, &len, sizeof(len));
+      head.append(s);
+      head.push_back('\0');
+   }
+
+   n = static_cast<std::uint32_t>(slotRefs.size());
+   putBytes(&head, &n, sizeof(n));
+   for (const auto& r : slotRefs) {
+      putBytes(&head, &std::get<0>(r), sizeof(std::uint32_t));
+      putBytes(&head, &std::get<1>(r), sizeof(std::int32_t));
+      putBytes(&head, &std::get<2>(r), sizeof(std::uint32_t));
+   }
+
+   const std::string tmp = snapshot + ".tmp";
+   {
+      std::ofstream fout(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+      if (!fout) return false;
+      fout.write(head.data(), static_cast<std::streamsize>(head.size()));
+      fout.write(body.data(), static_cast<std::streamsize>(body.size()));
+      if (!fout) return false;
+   }
+   if (std::rename(tmp.c_str(), snapshot.c_str()) != 0) {
+      // some systems won't rename over an existing file
+      std::remove(snapshot.c_str());
+      if (std::rename(tmp.c_str(), snapshot.c_str()) != 0) {
+         std::remove(tmp.c_str());
+         return false;
+      }
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Class: SnapReader -- constructs the objects from a snapshot
+//------------------------------------------------------------------------------
+class SnapReader
+{
+public:
+   SnapReader(const std::vector<char>& data, factory_func f, const std::string& fn)
+      : p(data.data()), end(data.data() + data.size()), factory(f), filename(fn) {}
+
+   // Reads the header, string table and slot refs; returns false if the
+   // snapshot is not a snapshot of the EDL file (size, hash), or if the
+   // EDL file wasn't found (stamp == false), then just that it's a snapshot.
+   bool header(const bool stamp, const std::uint64_t size, const std::uint64_t hash);
+
+   Object* node();
+
+   bool isOk() const               { return ok; }
+   unsigned int errors() const     { return err_count; }
+
+private:
+   struct SlotRef {
+      std::uint32_t factoryName {};
+      std::int32_t index {};
+      std::uint32_t slotName {};
+      bool checked {};
+   };
+
+   void error(const char* const msg, const char* const name) {
+      std::cerr << "In " << filename << ": " << msg << name << std::endl;
+      err_count++;
+   }
+
+   bool get(void* const v, const std::size_t n) {
+      if (!ok || static_cast<std::size_t>(end - p) < n) { ok = false; return false; }
+      std::memcpy(v, p, n);
+      p += n;
+      return true;
+   }
+   unsigned char get8()            { unsigned char v {};  get(&v, sizeof(v)); return v; }
+   std::uint32_t get32()           { std::uint32_t v {};  get(&v, sizeof(v)); return v; }
+   std::int32_t getInt()           { std::int32_t v {};   get(&v, sizeof(v)); return v; }
+   double getDouble()              { double v {};         get(&v, sizeof(v)); return v; }
+   const char* getStr() {
+      const std::uint32_t i = get32();
+      if (i >= strings.size()) { ok = false; return ""; }
+      return strings[i];
+   }
+
+   const char* p {};
+   const char* end {};
+   bool ok {true};
+
+   factory_func factory {};
+   std::string filename;                  // Snapshot file name (for messages)
+   unsigned int err_count {};
+
+   std::vector<const char*> strings;      // String table (points into the data)
+   std::vector<SlotRef> slotRefs;
+};
+
+bool SnapReader::header(const bool stamp, const std::uint64_t size, const std::uint64_t hash)
+{
+   char magic[sizeof(MAGIC)] {};
+   std::uint32_t version {};
+   std::uint64_t fsize {};
+   std::uint64_t fhash {};
+   get(magic, sizeof(magic));
+   get(&version, sizeof(version));
+   get(&fsize, sizeof(fsize));
+   get(&fhash, sizeof(fhash));
+   if (!ok || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION) return false;
+   if (stamp && (fsize != size || fhash != hash)) return false;
+
+   std::uint32_t n = get32();
+   for (std::uint32_t i = 0; ok && i < n; i++) {
+      const std::uint32_t len = get32();
+      if (!ok || static_cast<std::size_t>(end - p) <= len || p[len] != '\0') return (ok = false);
+      strings.push_back(p);
+      p += len + 1;
+   }
+
+   n = get32();
+   for (std::uint32_t i = 0; ok && i < n; i++) {
+      SlotRef r;
+      r.factoryName = get32();
+      r.index = getInt();
+      r.slotName = get32();
+      if (r.factoryName >= strings.size() || r.slotName >= strings.size()) ok = false;
+      slotRefs.push_back(r);
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// node() -- constructs the next object; returns zero for a null node or if
+// the snapshot is bad or stale (see isOk())
+//------------------------------------------------------------------------------
+Object* SnapReader::node()
+{
+   Object* obj {};
+   switch (get8()) {
+
+      case NODE_NULL:
+         break;
+
+      case NODE_STRING:
+         obj = new String(getStr());
+         break;
+
+      case NODE_IDENT:
+         obj = new Identifier(getStr());
+         break;
+
+      case NODE_INTEGER:
+         obj = new Integer(getInt());
+         break;
+
+      case NODE_FLOAT:
+         obj = new Float(getDouble());
+         break;
+
+      case NODE_BOOLEAN:
+         obj = new Boolean(get8() != 0);
+         break;
+
+      case NODE_LIST: {
+         const auto list = new List();
+         const std::uint32_t n = get32();
+         for (std::uint32_t i = 0; ok && i < n; i++) {
+            Object* const v = node();
+            if (v != nullptr) {
+               list->put(v);
+               v->unref();
+            }
+         }
+         obj = list;
+         break;
+      }
+
+      case NODE_PAIRSTREAM: {
+         const auto stream = new PairStream();
+         const std::uint32_t n = get32();
+         for (std::uint32_t i = 0; ok && i < n; i++) {
+            const char* const slotname = getStr();
+            Object* const v = node();
+            if (v != nullptr) {
+               const auto pair = new Pair(slotname, v);
+               v->unref();
+               stream->put(pair);
+               pair->unref();
+            }
+         }
+         obj = stream;
+         break;
+      }
+
+      case NODE_PAIR: {
+         const char* const slotname = getStr();
+         Object* const v = node();
+         if (v != nullptr) {
+            obj = new Pair(slotname, v);
+            v->unref();
+         }
+         break;
+      }
+
+      case NODE_FORM: {
+         const char* const name = getStr();
+         const std::uint32_t n = get32();
+         if (!ok) break;
+         obj = (factory != nullptr ? factory(name) : nullptr);
+         if (obj == nullptr) {
+            // the factory no longer knows this name; it's not our snapshot
+            ok = false;
+            break;
+         }
+         for (std::uint32_t i = 0; ok && i < n; i++) {
+            const std::uint32_t ri = get32();
+            if (!ok || ri >= slotRefs.size()) { ok = false; break; }
+            SlotRef& r = slotRefs[ri];
+
+            // the first time a slot ref is used, check that it's still the
+            // class's slot index
+            if (!r.checked) {
+               if (std::strcmp(strings[r.factoryName], name) != 0 ||
+                   obj->slotName2Index(strings[r.slotName]) != r.index) {
+                  ok = false;
+                  break;
+               }
+               r.checked = true;
+            }
+
+            Object* const v = node();
+            if (v != nullptr) {
+               if (!obj->setSlotByIndex(r.index, v)) {
+                  error("error while setting slot name: ", strings[r.slotName]);
+               }
+               v->unref();
+            }
+         }
+         if (ok && !obj->isValid()) {
+            error("error: invalid object: ", name);
+         }
+         break;
+      }
+
+      default:
+         ok = false;
+         break;
+   }
+
+   if (!ok && obj != nullptr) {
+      obj->unref();
+      obj = nullptr;
+   }
+   return obj;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Compiles the EDL file into a binary snapshot
+//------------------------------------------------------------------------------
+bool edl_compile(const std::string& filename, const std::string& snapshot, factory_func f, unsigned int* num_errors)
+{
+   unsigned int err_count {};
+   bool ok {};
+
+   std::uint64_t size {};
+   std::uint64_t hash {};
+   if (sourceStamp(filename, &size, &hash)) {
+      Object* const tree = edl_parse_forms(filename, &err_count);
+      if (tree != nullptr && err_count == 0) {
+         SnapWriter writer(f, filename);
+         writer.node(tree);
+         err_count = writer.errors();
+         if (err_count == 0) {
+            ok = writer.write(snapshot, size, hash);
+            if (!ok) std::cerr << "edl_compile(): unable to write snapshot: " << snapshot << std::endl;
+         }
+      }
+      if (tree != nullptr) tree->unref();
+   } else {
+      std::cerr << "edl_compile(): unable to read: " << filename << std::endl;
+      err_count++;
+   }
+
+   if (num_errors != nullptr) {
+      *num_errors = err_count;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// Loads the objects from the snapshot, if it's current, else parses the
+// EDL file (and optionally updates the snapshot)
+//------------------------------------------------------------------------------
+Object* edl_load(const std::string& filename, const std::string& snapshot, factory_func f, unsigned int* num_errors, const bool update)
+{
+   Object* obj {};
+   unsigned int err_count {};
+   bool loaded {};
+
+   std::uint64_t size {};
+   std::uint64_t hash {};
+   const bool stamp = sourceStamp(filename, &size, &hash);
+
+   std::vector<char> data;
+   if (readFile(snapshot, &data)) {
+      SnapReader reader(data, f, snapshot);
+      if (reader.header(stamp, size, hash)) {
+         obj = reader.node();
+         loaded = reader.isOk();
+         err_count = reader.errors();
+      }
+      if (!loaded && obj != nullptr) {
+         obj->unref();
+         obj = nullptr;
+      }
+   }
+
+   // Missing or stale snapshot
+   if (!loaded) {
+      obj = edl_parser(filename, f, &err_count);
+      if (update && obj != nullptr && err_count == 0) {
+         edl_compile(filename, snapshot, f);
+      }
+   }
+
+   if (num_errors != nullptr) {
+      *num_errors = err_count;
+   }
+   return obj;
+}
+
+}
+}
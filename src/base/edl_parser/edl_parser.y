@@ -13,14 +13,31 @@
 //       recognized then no object is created and nullptr is returned.
 //--------------------------------------------------------------------------
 
+%define api.pure full
+%parse-param {EdlParseContext* ctx}
+%lex-param {EdlParseContext* ctx}
+
 %token	IDENT SLOT_ID
 %token	INTEGERconstant  FLOATINGconstant  BOOLconstant STRING_LITERAL
 
+%code requires {
+struct EdlParseContext;
+}
+
+%code provides {
+// Token value set by the scanner (one per thread)
+extern thread_local YYSTYPE yylval;
+}
+
 %{
 
 #include <cstdio>
 #include <string>
 #include <fstream>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
 
 #include "openeaagles/base/edl_parser.hpp"
 #include "openeaagles/base/Object.hpp"
@@ -33,48 +50,66 @@
 #include "openeaagles/base/PairStream.hpp"
 #include "openeaagles/base/List.hpp"
 #include "EdlScanner.hpp"
+#include "EdlForm.hpp"
 
-static oe::base::Object* result;               // result of all our work (i.e., an Object)
-static oe::base::EdlScanner* scanner;          // edl scanner
-static oe::base::factory_func factory;         // factory function 
-static unsigned int err_count;                 // error count
+//------------------------------------------------------------------------------
+// Parser state; one per parse, so any number of files can be parsed at the
+// same time on different threads.
+//------------------------------------------------------------------------------
+struct EdlParseContext {
+   oe::base::Object* result {};                 // result of all our work (i.e., an Object)
+   oe::base::EdlScanner* scanner {};            // edl scanner
+   oe::base::factory_func factory {};           // factory function
+   unsigned int err_count {};                   // error count
+   bool keepForms {};                           // return forms as EdlForms (don't call the factory)
+};
+
+%}
+
+%code {
 
 //------------------------------------------------------------------------------
 // yylex() -- user defined; used by the parser to call the lexical generator
 //------------------------------------------------------------------------------
-inline int yylex()
+inline int yylex(YYSTYPE* lvalp, EdlParseContext* ctx)
 {
-   return scanner->yylex();
+   const int token = ctx->scanner->yylex();
+   *lvalp = yylval;
+   return token;
 }
 
 //------------------------------------------------------------------------------
 // yyerror() -- user defined; use by the parser to report errors.
 //------------------------------------------------------------------------------
-inline void yyerror(const char* s)
+inline void yyerror(EdlParseContext* ctx, const char* s)
 {
-   std::string filename(scanner->getFilename());
+   std::string filename(ctx->scanner->getFilename());
    if (filename.empty()) {
       std::cerr << "At line ";
    } else {
       std::cerr << "In " << filename << ", line ";
    }
-   std::cerr << scanner->getLineNumber() << ": ";
+   std::cerr << ctx->scanner->getLineNumber() << ": ";
    std::cerr << s << std::endl;
-   err_count++;
+   ctx->err_count++;
 }
 
 //------------------------------------------------------------------------------
 // parse() -- returns an object with factory 'name' with its slots set to
 //            values in 'arg_list'
 //------------------------------------------------------------------------------
-static oe::base::Object* parse(const std::string& name, oe::base::PairStream* arg_list)
+static oe::base::Object* parse(EdlParseContext* ctx, const std::string& name, oe::base::PairStream* arg_list)
 {
     oe::base::Object* obj {nullptr};
 
-    if (factory != nullptr) {
+    if (ctx->keepForms) {
+        // keep the form itself; the snapshot compiler builds the objects
+        obj = new oe::base::EdlForm(name, arg_list);
+    }
+    else if (ctx->factory != nullptr) {
 
         // call user provided factory() to construct an object
-        obj = factory(name);
+        obj = ctx->factory(name);
 
         // set slots in our new object
         if (obj != nullptr && arg_list != nullptr) {
@@ -84,25 +119,25 @@ static oe::base::Object* parse(const std::string& name, oe::base::PairStream* ar
                 bool ok = obj->setSlotByName(*p->slot(), p->object());
                 if (!ok) {
                     std::string msg = "error while setting slot name: " + std::string(*p->slot());
-                    yyerror(msg.c_str());
+                    yyerror(ctx, msg.c_str());
                 }
                 item = item->getNext();
             }
             bool ok = obj->isValid();
             if (!ok) {
                 std::string msg = "error: invalid object: " + name;
-                yyerror(msg.c_str());
+                yyerror(ctx, msg.c_str());
             }
         }
         else if (obj == nullptr) {
             std::string msg = "undefined factory name: " + name;
-            yyerror(msg.c_str());
+            yyerror(ctx, msg.c_str());
         }
     }
     return obj;
 }
 
-%}
+}
 
 // Defines types that our values can be, yylval.
 %union {
@@ -136,8 +171,8 @@ static oe::base::Object* parse(const std::string& name, oe::base::PairStream* ar
 // The grammar rules ---
 //--------------------------------------------------------------------------
 %%
-file    : form                      { result = $1; }
-        | SLOT_ID form              { if ($2 != 0) { result = new oe::base::Pair($1, $2); delete[] $1; $2->unref(); } }
+file    : form                      { ctx->result = $1; }
+        | SLOT_ID form              { if ($2 != 0) { ctx->result = new oe::base::Pair($1, $2); delete[] $1; $2->unref(); } }
         ;
 
 arglist :                           { $$ = new oe::base::PairStream(); }
@@ -169,7 +204,7 @@ arglist :                           { $$ = new oe::base::PairStream(); }
         ;
 
 
-form    : '(' IDENT arglist ')'     { $$ = parse($2, $3); delete[] $2; $3->unref(); }
+form    : '(' IDENT arglist ')'     { $$ = parse(ctx, $2, $3); delete[] $2; $3->unref(); }
 
         | '{' arglist '}'           { $$ = (oe::base::Object*) $2; }
         ;
@@ -195,42 +230,134 @@ number  : INTEGERconstant           { $$ = new oe::base::Integer($1); }
         ;
 %%
 
+// Token value set by the scanner (one per thread)
+thread_local YYSTYPE yylval;
+
 namespace oe {
 namespace base {
 
 //------------------------------------------------------------------------------
-// Returns an Object* that was constructed from parsing an EDL file.
-// factory is the name of the Object creation function  
+// parseFile() -- parses the EDL file using a new parser context
 //------------------------------------------------------------------------------
-Object* edl_parser(const std::string& filename, factory_func f, unsigned int* num_errors)
+static Object* parseFile(const std::string& filename, factory_func f, const bool keepForms, unsigned int* num_errors)
 {
-    // set the global file scope static variables
-    factory = f;
-    result = nullptr;
-    err_count = 0;
+    EdlParseContext ctx;
+    ctx.factory = f;
+    ctx.keepForms = keepForms;
 
     // open the text file and create the scanner
     std::fstream fin;
     fin.open(filename, std::ios::in);
-    scanner = new EdlScanner(&fin);
+    ctx.scanner = new EdlScanner(&fin);
 
     //yydebug = 1;
     Object* obj {nullptr};
-    if (yyparse() == 0) {    // returns 0 on success
-        obj = result;
+    if (yyparse(&ctx) == 0) {    // returns 0 on success
+        obj = ctx.result;
     }
 
     // close the text file and delete the scanner
     fin.close();
-    delete scanner;
+    delete ctx.scanner;
 
     // if we have a good pointer, set the number of errors encountered
     if (num_errors != nullptr) {
-        *num_errors = err_count;
+        *num_errors = ctx.err_count;
     }
     return obj;
 }
 
+//------------------------------------------------------------------------------
+// Returns an Object* that was constructed from parsing an EDL file.
+// factory is the name of the Object creation function  
+//------------------------------------------------------------------------------
+Object* edl_parser(const std::string& filename, factory_func f, unsigned int* num_errors)
+{
+    return parseFile(filename, f, false, num_errors);
 }
+
+//------------------------------------------------------------------------------
+// Returns the parse tree of an EDL file, with EdlForms in place of the
+// objects that the factory would have constructed.
+//------------------------------------------------------------------------------
+Object* edl_parse_forms(const std::string& filename, unsigned int* num_errors)
+{
+    return parseFile(filename, nullptr, true, num_errors);
+}
+
+//------------------------------------------------------------------------------
+// Parses a list of independent EDL files using up to 'num_threads' threads,
+// and returns a PairStream with one Pair for each file that was parsed, in
+// the same order as the list of files.
+//------------------------------------------------------------------------------
+PairStream* edl_parser(const std::vector<std::string>& filenames, factory_func f, unsigned int* num_errors, const unsigned int num_threads)
+{
+    const std::size_t n = filenames.size();
+    std::vector<Object*> objs(n, nullptr);
+    std::vector<unsigned int> errs(n, 0);
+
+    // Each thread takes the next file from the list until there are none left
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        std::size_t i = next++;
+        while (i < n) {
+            objs[i] = edl_parser(filenames[i], f, &errs[i]);
+            i = next++;
+        }
+    };
+
+    std::size_t nt = (num_threads > 0 ? num_threads : 1);
+    if (nt > n) nt = n;
+    if (nt > 1) {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 1; t < nt; t++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& t : threads) {
+            t.join();
+        }
+    } else {
+        worker();
+    }
+
+    // Merge the results in the order of the list; a file that was a
+    // named slot (e.g., "name: ( ... )") keeps its name, all others are
+    // named by their position in the list ("__merged_1", "__merged_2", ...),
+    // with a "_N" suffix, if needed, so they don't match any kept name
+    std::set<std::string> names;
+    for (std::size_t i = 0; i < n; i++) {
+        const Pair* p = dynamic_cast<const Pair*>(objs[i]);
+        if (p != nullptr && p->slot() != nullptr) names.insert(p->slot()->getString());
+    }
+
+    unsigned int err_count {};
+    const auto stream = new PairStream();
+    for (std::size_t i = 0; i < n; i++) {
+        err_count += errs[i];
+        if (objs[i] == nullptr) continue;
+        Pair* p = dynamic_cast<Pair*>(objs[i]);
+        if (p == nullptr) {
+            char cbuf[40];
+            std::sprintf(cbuf, "__merged_%u", static_cast<unsigned int>(i + 1));
+            std::string name(cbuf);
+            for (unsigned int k = 1; names.count(name) > 0; k++) {
+                std::sprintf(cbuf, "__merged_%u_%u", static_cast<unsigned int>(i + 1), k);
+                name = cbuf;
+            }
+            names.insert(name);
+            p = new Pair(name.c_str(), objs[i]);
+            objs[i]->unref();
+        }
+        stream->put(p);
+        p->unref();
+    }
+
+    if (num_errors != nullptr) {
+        *num_errors = err_count;
+    }
+    return stream;
 }
 
+}
+}
@@ -2,6 +2,7 @@
 #include "openeaagles/base/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/base/FileReader.hpp"
 #include "openeaagles/base/Statistic.hpp"
@@ -79,377 +80,160 @@ namespace base {
 
 Object* factory(const std::string& name)
 {
-    Object* obj = nullptr;
-
-    // Numbers
-    if ( name == Number::getFactoryName() ) {
-        obj = new Number();
-    }
-    else if ( name == Complex::getFactoryName() ) {
-        obj = new Complex();
-    }
-    else if ( name == Integer::getFactoryName() ) {
-        obj = new Integer();
-    }
-    else if ( name == Float::getFactoryName() ) {
-        obj = new Float();
-    }
-    else if ( name == Boolean::getFactoryName() ) {
-        obj = new Boolean();
-    }
-    else if ( name == Decibel::getFactoryName() ) {
-        obj = new Decibel();
-    }
-    else if ( name == LatLon::getFactoryName() ) {
-        obj = new LatLon();
-    }
-    else if ( name == Add::getFactoryName() ) {
-        obj = new Add();
-    }
-    else if ( name == Subtract::getFactoryName() ) {
-        obj = new Subtract();
-    }
-    else if ( name == Multiply::getFactoryName() ) {
-        obj = new Multiply();
-    }
-    else if ( name == Divide::getFactoryName() ) {
-        obj = new Divide();
-    }
-
-    // Components
-    else if ( name == FileReader::getFactoryName() ) {
-        obj = new FileReader();
-    }
-    else if ( name == Statistic::getFactoryName() ) {
-        obj = new Statistic();
-    }
-
-    // Transformations
-    else if ( name == Translation::getFactoryName() ) {
-        obj = new Translation();
-    }
-    else if ( name == Rotation::getFactoryName() ) {
-        obj = new Rotation();
-    }
-    else if ( name == Scale::getFactoryName() ) {
-        obj = new Scale();
-    }
-
-    // Functors
-    else if ( name == Func1::getFactoryName() ) {
-        obj = new Func1();
-    }
-    else if ( name == Func2::getFactoryName() ) {
-        obj = new Func2();
-    }
-    else if ( name == Func3::getFactoryName() ) {
-        obj = new Func3();
-    }
-    else if ( name == Func4::getFactoryName() ) {
-        obj = new Func4();
-    }
-    else if ( name == Func5::getFactoryName() ) {
-        obj = new Func5();
-    }
-    else if ( name == Polynomial::getFactoryName() ) {
-        obj = new Polynomial();
-    }
-    else if ( name == Table1::getFactoryName() ) {
-        obj = new Table1();
-    }
-    else if ( name == Table2::getFactoryName() ) {
-        obj = new Table2();
-    }
-    else if ( name == Table3::getFactoryName() ) {
-        obj = new Table3();
-    }
-    else if ( name == Table4::getFactoryName() ) {
-        obj = new Table4();
-    }
-    else if ( name == Table5::getFactoryName() ) {
-        obj = new Table5();
-    }
-
-    // Timers
-    else if ( name == UpTimer::getFactoryName() ) {
-        obj = new UpTimer();
-    }
-    else if ( name == DownTimer::getFactoryName() ) {
-        obj = new DownTimer();
-    }
-
-    // Units: Angles
-    else if ( name == Degrees::getFactoryName() ) {
-        obj = new Degrees();
-    }
-    else if ( name == Radians::getFactoryName() ) {
-        obj = new Radians();
-    }
-    else if ( name == Semicircles::getFactoryName() ) {
-        obj = new Semicircles();
-    }
-
-    // Units: Areas
-    else if ( name == SquareMeters::getFactoryName() ) {
-        obj = new SquareMeters();
-    }
-    else if ( name == SquareFeet::getFactoryName() ) {
-        obj = new SquareFeet();
-    }
-    else if ( name == SquareInches::getFactoryName() ) {
-        obj = new SquareInches();
-    }
-    else if ( name == SquareYards::getFactoryName() ) {
-        obj = new SquareYards();
-    }
-    else if ( name == SquareMiles::getFactoryName() ) {
-        obj = new SquareMiles();
-    }
-    else if ( name == SquareCentiMeters::getFactoryName() ) {
-        obj = new SquareCentiMeters();
-    }
-    else if ( name == SquareMilliMeters::getFactoryName() ) {
-        obj = new SquareMilliMeters();
-    }
-    else if ( name == SquareKiloMeters::getFactoryName() ) {
-        obj = new SquareKiloMeters();
-    }
-    else if ( name == DecibelSquareMeters::getFactoryName() ) {
-        obj = new DecibelSquareMeters();
-    }
-
-    // Units: Distances
-    else if ( name == Meters::getFactoryName() ) {
-        obj = new Meters();
-    }
-    else if ( name == CentiMeters::getFactoryName() ) {
-        obj = new CentiMeters();
-    }
-    else if ( name == MicroMeters::getFactoryName() ) {
-        obj = new MicroMeters();
-    }
-    else if ( name == Microns::getFactoryName() ) {
-        obj = new Microns();
-    }
-    else if ( name == KiloMeters::getFactoryName() ) {
-        obj = new KiloMeters();
-    }
-    else if ( name == Inches::getFactoryName() ) {
-        obj = new Inches();
-    }
-    else if ( name == Feet::getFactoryName() ) {
-        obj = new Feet();
-    }
-    else if ( name == NauticalMiles::getFactoryName() ) {
-        obj = new NauticalMiles();
-    }
-    else if ( name == StatuteMiles::getFactoryName() ) {
-        obj = new StatuteMiles();
-    }
-
-    // Units: Energies
-    else if ( name == KiloWattHours::getFactoryName() ) {
-        obj = new KiloWattHours();
-    }
-    else if ( name == BTUs::getFactoryName() ) {
-        obj = new BTUs();
-    }
-    else if ( name == Calories::getFactoryName() ) {
-        obj = new Calories();
-    }
-    else if ( name == FootPounds::getFactoryName() ) {
-        obj = new FootPounds();
-    }
-    else if ( name == Joules::getFactoryName() ) {
-        obj = new Joules();
-    }
-
-    // Units: Forces
-    else if ( name == Newtons::getFactoryName() ) {
-        obj = new Newtons();
-    }
-    else if ( name == KiloNewtons::getFactoryName() ) {
-        obj = new KiloNewtons();
-    }
-    else if ( name == Poundals::getFactoryName() ) {
-        obj = new Poundals();
-    }
-    else if ( name == PoundForces::getFactoryName() ) {
-        obj = new PoundForces();
-    }
-
-    // Units: Frequencies
-    else if ( name == Hertz::getFactoryName() ) {
-        obj = new Hertz();
-    }
-    else if ( name == KiloHertz::getFactoryName() ) {
-        obj = new KiloHertz();
-    }
-    else if ( name == MegaHertz::getFactoryName() ) {
-        obj = new MegaHertz();
-    }
-    else if ( name == GigaHertz::getFactoryName() ) {
-        obj = new GigaHertz();
-    }
-    else if ( name == TeraHertz::getFactoryName() ) {
-        obj = new TeraHertz();
-    }
-
-    // Units: Masses
-    else if ( name == Grams::getFactoryName() ) {
-        obj = new Grams();
-    }
-    else if ( name == KiloGrams::getFactoryName() ) {
-        obj = new KiloGrams();
-    }
-    else if ( name == Slugs::getFactoryName() ) {
-        obj = new Slugs();
-    }
-
-    // Units: Powers
-    else if ( name == KiloWatts::getFactoryName() ) {
-        obj = new KiloWatts();
-    }
-    else if ( name == Watts::getFactoryName() ) {
-        obj = new Watts();
-    }
-    else if ( name == MilliWatts::getFactoryName() ) {
-        obj = new MilliWatts();
-    }
-    else if ( name == Horsepower::getFactoryName() ) {
-        obj = new Horsepower();
-    }
-    else if ( name == DecibelWatts::getFactoryName() ) {
-        obj = new DecibelWatts();
-    }
-    else if ( name == DecibelMilliWatts::getFactoryName() ) {
-        obj = new DecibelMilliWatts();
-    }
-
-    // Units: Time
-    else if ( name == Seconds::getFactoryName() ) {
-        obj = new Seconds();
-    }
-    else if ( name == MilliSeconds::getFactoryName() ) {
-        obj = new MilliSeconds();
-    }
-    else if ( name == MicroSeconds::getFactoryName() ) {
-        obj = new MicroSeconds();
-    }
-    else if ( name == NanoSeconds::getFactoryName() ) {
-        obj = new NanoSeconds();
-    }
-    else if ( name == Minutes::getFactoryName() ) {
-        obj = new Minutes();
-    }
-    else if ( name == Hours::getFactoryName() ) {
-        obj = new Hours();
-    }
-    else if ( name == Days::getFactoryName() ) {
-        obj = new Days();
-    }
-
-    // Units: Velocities
-    else if ( name == AngularVelocity::getFactoryName() ) {
-        obj = new AngularVelocity();
-    }
-    else if ( name == LinearVelocity::getFactoryName() ) {
-        obj = new LinearVelocity();
-    }
-
-    // Colors
-    else if ( name == Color::getFactoryName() ) {
-        obj = new Color();
-    }
-    else if ( name == Cie::getFactoryName() ) {
-        obj = new Cie();
-    }
-    else if ( name == Cmy::getFactoryName() ) {
-        obj = new Cmy();
-    }
-    else if ( name == Hls::getFactoryName() ) {
-        obj = new Hls();
-    }
-    else if ( name == Hsv::getFactoryName() ) {
-        obj = new Hsv();
-    }
-    else if ( name == Hsva::getFactoryName() ) {
-        obj = new Hsva();
-    }
-    else if ( name == Rgb::getFactoryName() ) {
-        obj = new Rgb();
-    }
-    else if ( name == Rgba::getFactoryName() ) {
-        obj = new Rgba();
-    }
-    else if ( name == Yiq::getFactoryName() ) {
-        obj = new Yiq();
-    }
-
-    // Network handlers
-    else if ( name == TcpClient::getFactoryName() ) {
-        obj = new TcpClient();
-    }
-    else if ( name == TcpServerSingle::getFactoryName() ) {
-        obj = new TcpServerSingle();
-    }
-    else if ( name == TcpServerMultiple::getFactoryName() ) {
-        obj = new TcpServerMultiple();
-    }
-    else if ( name == UdpBroadcastHandler::getFactoryName() ) {
-        obj = new UdpBroadcastHandler();
-    }
-    else if ( name == UdpMulticastHandler::getFactoryName() ) {
-        obj = new UdpMulticastHandler();
-    }
-    else if ( name == UdpUnicastHandler::getFactoryName() ) {
-        obj = new UdpUnicastHandler();
-    }
-
-    // Random number generator and distributions
-    else if ( name == Rng::getFactoryName() ) {
-        obj = new Rng();
-    }
-    else if ( name == Exponential::getFactoryName() ) {
-        obj = new Exponential();
-    }
-    else if ( name == Lognormal::getFactoryName() ) {
-        obj = new Lognormal();
-    }
-    else if ( name == Pareto::getFactoryName() ) {
-        obj = new Pareto();
-    }
-    else if ( name == Uniform::getFactoryName() ) {
-        obj = new Uniform();
-    }
-
-    // General I/O Devices
-    else if ( name == IoHandler::getFactoryName() ) {
-        obj = new IoHandler();
-    }
-    else if ( name == IoData::getFactoryName() ) {
-        obj = new IoData();
-    }
-
-    // Earth models
-    else if ( name == EarthModel::getFactoryName() ) {
-        obj = new EarthModel();
-    }
-
-    // Thread pool
-    else if ( name == ThreadPool::getFactoryName() ) {
-       obj = new ThreadPool();
-    }
-
-    // Ubf
-    else if ( name == ubf::Agent::getFactoryName() ) {
-        obj = new ubf::Agent();
-    }
-    else if ( name == ubf::Arbiter::getFactoryName() ) {
-        obj = new ubf::Arbiter();
-    }
-
-    return obj;
+    static const FactoryTable table {
+        // Numbers
+        { Number::getFactoryName(),               FactoryTable::make<Number> },
+        { Complex::getFactoryName(),              FactoryTable::make<Complex> },
+        { Integer::getFactoryName(),              FactoryTable::make<Integer> },
+        { Float::getFactoryName(),                FactoryTable::make<Float> },
+        { Boolean::getFactoryName(),              FactoryTable::make<Boolean> },
+        { Decibel::getFactoryName(),              FactoryTable::make<Decibel> },
+        { LatLon::getFactoryName(),               FactoryTable::make<LatLon> },
+        { Add::getFactoryName(),                  FactoryTable::make<Add> },
+        { Subtract::getFactoryName(),             FactoryTable::make<Subtract> },
+        { Multiply::getFactoryName(),             FactoryTable::make<Multiply> },
+        { Divide::getFactoryName(),               FactoryTable::make<Divide> },
+
+        // Components
+        { FileReader::getFactoryName(),           FactoryTable::make<FileReader> },
+        { Statistic::getFactoryName(),            FactoryTable::make<Statistic> },
+
+        // Transformations
+        { Translation::getFactoryName(),          FactoryTable::make<Translation> },
+        { Rotation::getFactoryName(),             FactoryTable::make<Rotation> },
+        { Scale::getFactoryName(),                FactoryTable::make<Scale> },
+
+        // Functors
+        { Func1::getFactoryName(),                FactoryTable::make<Func1> },
+        { Func2::getFactoryName(),                FactoryTable::make<Func2> },
+        { Func3::getFactoryName(),                FactoryTable::make<Func3> },
+        { Func4::getFactoryName(),                FactoryTable::make<Func4> },
+        { Func5::getFactoryName(),                FactoryTable::make<Func5> },
+        { Polynomial::getFactoryName(),           FactoryTable::make<Polynomial> },
+        { Table1::getFactoryName(),               FactoryTable::make<Table1> },
+        { Table2::getFactoryName(),               FactoryTable::make<Table2> },
+        { Table3::getFactoryName(),               FactoryTable::make<Table3> },
+        { Table4::getFactoryName(),               FactoryTable::make<Table4> },
+        { Table5::getFactoryName(),               FactoryTable::make<Table5> },
+
+        // Timers
+        { UpTimer::getFactoryName(),              FactoryTable::make<UpTimer> },
+        { DownTimer::getFactoryName(),            FactoryTable::make<DownTimer> },
+
+        // Units: Angles
+        { Degrees::getFactoryName(),              FactoryTable::make<Degrees> },
+        { Radians::getFactoryName(),              FactoryTable::make<Radians> },
+        { Semicircles::getFactoryName(),          FactoryTable::make<Semicircles> },
+
+        // Units: Areas
+        { SquareMeters::getFactoryName(),         FactoryTable::make<SquareMeters> },
+        { SquareFeet::getFactoryName(),           FactoryTable::make<SquareFeet> },
+        { SquareInches::getFactoryName(),         FactoryTable::make<SquareInches> },
+        { SquareYards::getFactoryName(),          FactoryTable::make<SquareYards> },
+        { SquareMiles::getFactoryName(),          FactoryTable::make<SquareMiles> },
+        { SquareCentiMeters::getFactoryName(),    FactoryTable::make<SquareCentiMeters> },
+        { SquareMilliMeters::getFactoryName(),    FactoryTable::make<SquareMilliMeters> },
+        { SquareKiloMeters::getFactoryName(),     FactoryTable::make<SquareKiloMeters> },
+        { DecibelSquareMeters::getFactoryName(),  FactoryTable::make<DecibelSquareMeters> },
+
+        // Units: Distances
+        { Meters::getFactoryName(),               FactoryTable::make<Meters> },
+        { CentiMeters::getFactoryName(),          FactoryTable::make<CentiMeters> },
+        { MicroMeters::getFactoryName(),          FactoryTable::make<MicroMeters> },
+        { Microns::getFactoryName(),              FactoryTable::make<Microns> },
+        { KiloMeters::getFactoryName(),           FactoryTable::make<KiloMeters> },
+        { Inches::getFactoryName(),               FactoryTable::make<Inches> },
+        { Feet::getFactoryName(),                 FactoryTable::make<Feet> },
+        { NauticalMiles::getFactoryName(),        FactoryTable::make<NauticalMiles> },
+        { StatuteMiles::getFactoryName(),         FactoryTable::make<StatuteMiles> },
+
+        // Units: Energies
+        { KiloWattHours::getFactoryName(),        FactoryTable::make<KiloWattHours> },
+        { BTUs::getFactoryName(),                 FactoryTable::make<BTUs> },
+        { Calories::getFactoryName(),             FactoryTable::make<Calories> },
+        { FootPounds::getFactoryName(),           FactoryTable::make<FootPounds> },
+        { Joules::getFactoryName(),               FactoryTable::make<Joules> },
+
+        // Units: Forces
+        { Newtons::getFactoryName(),              FactoryTable::make<Newtons> },
+        { KiloNewtons::getFactoryName(),          FactoryTable::make<KiloNewtons> },
+        { Poundals::getFactoryName(),             FactoryTable::make<Poundals> },
+        { PoundForces::getFactoryName(),          FactoryTable::make<PoundForces> },
+
+        // Units: Frequencies
+        { Hertz::getFactoryName(),                FactoryTable::make<Hertz> },
+        { KiloHertz::getFactoryName(),            FactoryTable::make<KiloHertz> },
+        { MegaHertz::getFactoryName(),            FactoryTable::make<MegaHertz> },
+        { GigaHertz::getFactoryName(),            FactoryTable::make<GigaHertz> },
+        { TeraHertz::getFactoryName(),            FactoryTable::make<TeraHertz> },
+
+        // Units: Masses
+        { Grams::getFactoryName(),                FactoryTable::make<Grams> },
+        { KiloGrams::getFactoryName(),            FactoryTable::make<KiloGrams> },
+        { Slugs::getFactoryName(),                FactoryTable::make<Slugs> },
+
+        // Units: Powers
+        { KiloWatts::getFactoryName(),            FactoryTable::make<KiloWatts> },
+        { Watts::getFactoryName(),                FactoryTable::make<Watts> },
+        { MilliWatts::getFactoryName(),           FactoryTable::make<MilliWatts> },
+        { Horsepower::getFactoryName(),           FactoryTable::make<Horsepower> },
+        { DecibelWatts::getFactoryName(),         FactoryTable::make<DecibelWatts> },
+        { DecibelMilliWatts::getFactoryName(),    FactoryTable::make<DecibelMilliWatts> },
+
+        // Units: Time
+        { Seconds::getFactoryName(),              FactoryTable::make<Seconds> },
+        { MilliSeconds::getFactoryName(),         FactoryTable::make<MilliSeconds> },
+        { MicroSeconds::getFactoryName(),         FactoryTable::make<MicroSeconds> },
+        { NanoSeconds::getFactoryName(),          FactoryTable::make<NanoSeconds> },
+        { Minutes::getFactoryName(),              FactoryTable::make<Minutes> },
+        { Hours::getFactoryName(),                FactoryTable::make<Hours> },
+        { Days::getFactoryName(),                 FactoryTable::make<Days> },
+
+        // Units: Velocities
+        { AngularVelocity::getFactoryName(),      FactoryTable::make<AngularVelocity> },
+        { LinearVelocity::getFactoryName(),       FactoryTable::make<LinearVelocity> },
+
+        // Colors
+        { Color::getFactoryName(),                FactoryTable::make<Color> },
+        { Cie::getFactoryName(),                  FactoryTable::make<Cie> },
+        { Cmy::getFactoryName(),                  FactoryTable::make<Cmy> },
+        { Hls::getFactoryName(),                  FactoryTable::make<Hls> },
+        { Hsv::getFactoryName(),                  FactoryTable::make<Hsv> },
+        { Hsva::getFactoryName(),                 FactoryTable::make<Hsva> },
+        { Rgb::getFactoryName(),                  FactoryTable::make<Rgb> },
+        { Rgba::getFactoryName(),                 FactoryTable::make<Rgba> },
+        { Yiq::getFactoryName(),                  FactoryTable::make<Yiq> },
+
+        // Network handlers
+        { TcpClient::getFactoryName(),            FactoryTable::make<TcpClient> },
+        { TcpServerSingle::getFactoryName(),      FactoryTable::make<TcpServerSingle> },
+        { TcpServerMultiple::getFactoryName(),    FactoryTable::make<TcpServerMultiple> },
+        { UdpBroadcastHandler::getFactoryName(),  FactoryTable::make<UdpBroadcastHandler> },
+        { UdpMulticastHandler::getFactoryName(),  FactoryTable::make<UdpMulticastHandler> },
+        { UdpUnicastHandler::getFactoryName(),    FactoryTable::make<UdpUnicastHandler> },
+
+        // Random number generator and distributions
+        { Rng::getFactoryName(),                  FactoryTable::make<Rng> },
+        { Exponential::getFactoryName(),          FactoryTable::make<Exponential> },
+        { Lognormal::getFactoryName(),            FactoryTable::make<Lognormal> },
+        { Pareto::getFactoryName(),               FactoryTable::make<Pareto> },
+        { Uniform::getFactoryName(),              FactoryTable::make<Uniform> },
+
+        // General I/O Devices
+        { IoHandler::getFactoryName(),            FactoryTable::make<IoHandler> },
+        { IoData::getFactoryName(),               FactoryTable::make<IoData> },
+
+        // Earth models
+        { EarthModel::getFactoryName(),           FactoryTable::make<EarthModel> },
+
+        // Thread pool
+        { ThreadPool::getFactoryName(),           FactoryTable::make<ThreadPool> },
+
+        // Ubf
+        { ubf::Agent::getFactoryName(),           FactoryTable::make<ubf::Agent> },
+        { ubf::Arbiter::getFactoryName(),         FactoryTable::make<ubf::Arbiter> },
+    };
+    return table.create(name);
 }
 
 }
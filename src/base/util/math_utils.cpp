@@ -192,6 +192,27 @@ void pow10Array(const float* const src, float* const dst, const unsigned int n)
    }
 }
 
+//------------
+// Computes the base 10 logarithms of 'n' src values and returns the results in 'dst'
+//------------
+void log10Array(const double* const src, double* const dst, const unsigned int n)
+{
+   double* pd = dst;
+   const double* ps = src;
+   for (unsigned int i = 0; i < n; i++) {
+      *pd++ = std::log10(*ps++);
+   }
+}
+
+void log10Array(const float* const src, float* const dst, const unsigned int n)
+{
+   float* pd = dst;
+   const float* ps = src;
+   for (unsigned int i = 0; i < n; i++) {
+      *pd++ = log10f(*ps++);
+   }
+}
+
 //------------
 // Multiply an array of reals with a constant
 //------------
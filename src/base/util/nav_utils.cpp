@@ -1121,6 +1121,490 @@ bool convertGeod2Ecef(
 }
 
 
+//==============================================================================
+// Batched (array) conversion functions
+//
+//    Array-in/array-out versions of the single set conversion functions.  Each
+//    pass over the arrays is a simple loop (see the array functions in
+//    math_utils.hpp) that the compiler is able to vectorize.
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// fbd2llEArray() -- flat-earth: computes 'n' destination lat/lons from a single
+// starting (ref) point given the distances and initial bearings (see fbd2llE())
+//------------------------------------------------------------------------------
+bool fbd2llEArray(
+      const double slat,            // IN: Starting (reference) latitude (degs)
+      const double slon,            // IN: Starting (reference) longitude (degs)
+      const double* const brng,     // IN: True bearing array (degs)
+      const double* const dist,     // IN: Distance (ground range) array (nm)
+      double* const dlat,           // OUT: Destination latitude array (degs)
+      double* const dlon,           // OUT: Destination longitude array (degs)
+      const unsigned int n,         // IN: Number of sets to convert
+      const EarthModel* const em    // IN: Pointer to an optional earth model (default: WGS-84)
+   )
+{
+   if (dlat == nullptr || dlon == nullptr) return false;
+
+   // Initialize earth model parameters
+   const EarthModel* pModel = em;
+   if (pModel == nullptr) { pModel = &EarthModel::wgs84; }
+
+   const double a  = distance::M2NM * pModel->getA();   // semi-major axis
+   const double e2 = pModel->getE2();  // eccentricity squared
+
+   // Define Local Constants (common starting point)
+   const double sinSlat = std::sin(angle::D2RCC * slat);
+   const double cosSlat = std::cos(angle::D2RCC * slat);
+   const double q       = 1.0 - e2 * sinSlat * sinSlat;
+   const double rn      = a / std::sqrt(q);
+   const double rm      = rn * (1.0 - e2) / q;
+
+   // Compute sin/cos of the bearings
+   const auto brgR = new double[n];
+   const auto sinBrng = new double[n];
+   const auto cosBrng = new double[n];
+   multArrayConst(brng, angle::D2RCC, brgR, n);
+   sinCosArray(brgR, sinBrng, cosBrng, n);
+
+   // Compute new lat/lons
+   const double klat = angle::R2DCC / rm;
+   for (unsigned int i = 0; i < n; i++) {
+      dlat[i] = slat + klat * (cosBrng[i] * dist[i]);
+   }
+   if (cosSlat != 0) {
+      const double klon = angle::R2DCC / (rn * cosSlat);
+      for (unsigned int i = 0; i < n; i++) {
+         dlon[i] = angle::aepcdDeg( slon + klon * (sinBrng[i] * dist[i]) );
+      }
+   }
+   else {
+      for (unsigned int i = 0; i < n; i++) {
+         dlon[i] = slon;
+      }
+   }
+
+   delete [] brgR;
+   delete [] sinBrng;
+   delete [] cosBrng;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// fll2bdEArray() -- flat-earth: computes the initial bearings and the distances
+// from a single starting lat/lon (ref point) to 'n' destination lat/lons
+// (see fll2bdE())
+//------------------------------------------------------------------------------
+bool fll2bdEArray(
+      const double slat,            // IN: Starting (reference) latitude (degs)
+      const double slon,            // IN: Starting (reference) longitude (degs)
+      const double* const dlat,     // IN: Destination latitude array (degs)
+      const double* const dlon,     // IN: Destination longitude array (degs)
+      double* const brng,           // OUT: True bearing array (degs)
+      double* const dist,           // OUT: Distance (ground range) array (nm)
+      const unsigned int n,         // IN: Number of sets to convert
+      const EarthModel* const em    // IN: Pointer to an optional earth model (default: WGS-84)
+   )
+{
+   if (brng == nullptr || dist == nullptr) return false;
+
+   // Initialize earth model parameters
+   const EarthModel* pModel = em;
+   if (pModel == nullptr) { pModel = &EarthModel::wgs84; }
+
+   const double a  = distance::M2NM * pModel->getA();   // semi-major axis
+   const double e2 = pModel->getE2();  // eccentricity squared
+
+   // Define Local Constants (common starting point)
+   const double sinSlat = std::sin(angle::D2RCC * slat);
+   const double cosSlat = std::cos(angle::D2RCC * slat);
+   const double q       = 1.0 - e2 * sinSlat * sinSlat;
+   const double rn      = a / std::sqrt(q);
+   const double rm      = rn * (1.0 - e2) / q;
+
+   // Compute the north and east components
+   const auto dN = new double[n];
+   const auto dE = new double[n];
+   const double kn = angle::D2RCC * rm;
+   const double ke = angle::D2RCC * rn * cosSlat;
+   for (unsigned int i = 0; i < n; i++) {
+      dN[i] = kn * angle::aepcdDeg(dlat[i] - slat);
+      dE[i] = ke * angle::aepcdDeg(dlon[i] - slon);
+   }
+
+   // Compute brg/dist (identical points have a zero bearing)
+   atan2Array(dE, dN, brng, n);
+   for (unsigned int i = 0; i < n; i++) {
+      brng[i] *= angle::R2DCC;
+      dist[i] = std::sqrt(dN[i]*dN[i] + dE[i]*dE[i]);
+   }
+
+   delete [] dN;
+   delete [] dE;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// xyz2aerArray() -- convert 'n' sets of x, y, z positions to azimuth, elevation
+// and range values (see xyz2aer())
+//------------------------------------------------------------------------------
+
+// Computing NED angles
+bool xyz2aerArray(
+      Vec3d* const aer,          // OUT: NED angles array (az, elev, rng) [deg,deg,meters]
+      const Vec3d* const pos,    // IN:  position vector array (NED, player centered)  (meters)
+      const unsigned int n       // IN:  number of sets to convert
+   )
+{
+   if (aer == nullptr || pos == nullptr) return false;
+
+   const auto ranj = new double[n];
+   const auto sel = new double[n];
+   const auto elev = new double[n];
+   const auto xx = new double[n];
+   const auto yy = new double[n];
+   const auto azim = new double[n];
+
+   for (unsigned int i = 0; i < n; i++) {
+      const double x = pos[i][0];
+      const double y = pos[i][1];
+      const double z = pos[i][2];
+      ranj[i] = std::sqrt(x*x + y*y + z*z);
+      sel[i] = -z / ranj[i];
+      xx[i] = x;
+      yy[i] = y;
+   }
+   for (unsigned int i = 0; i < n; i++) {
+      elev[i] = std::asin(sel[i]);
+   }
+   atan2Array(yy, xx, azim, n);
+
+   for (unsigned int i = 0; i < n; i++) {
+      aer[i].set( (angle::R2DCC * azim[i]), (angle::R2DCC * elev[i]), ranj[i] );
+   }
+
+   delete [] ranj;
+   delete [] sel;
+   delete [] elev;
+   delete [] xx;
+   delete [] yy;
+   delete [] azim;
+
+   return true;
+}
+
+// Computing body angles
+bool xyz2aerArray(
+      Vec3d* const aer,          // OUT: body angles array (az, elev, rng) [deg,deg,meters]
+      const Matrixd& rm,         // IN:  NED to body rotational matrix (see computeRotationalMatrix())
+      const Vec3d* const pos,    // IN:  position vector array (NED, player centered)  (meters)
+      const unsigned int n       // IN:  number of sets to convert
+   )
+{
+   if (aer == nullptr || pos == nullptr) return false;
+
+   // Rotate from NED to body coordinates
+   const auto vb = new Vec3d[n];
+   postMultVec3Array(pos,rm,vb,n);
+
+   const bool ok = xyz2aerArray(aer, vb, n);
+
+   delete [] vb;
+
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// computeWorldMatrixArray() -- computes 'n' world (ECEF <==> NED) transformation
+// matrices, M = Ry[-(90+lat)] * Rz[lon]  (see computeWorldMatrix())
+//------------------------------------------------------------------------------
+bool computeWorldMatrixArray(
+      const double* const latD,  // IN: Reference latitude array (degs)
+      const double* const lonD,  // IN: Reference longitude array (degs)
+      Matrixd* const m,          // OUT: Matrix array
+      const unsigned int n       // IN: Number of matrices
+   )
+{
+   if (m == nullptr) return false;
+
+   const auto rad = new double[n];
+   const auto slat = new double[n];
+   const auto clat = new double[n];
+   const auto slon = new double[n];
+   const auto clon = new double[n];
+
+   multArrayConst(latD, angle::D2RCC, rad, n);
+   sinCosArray(rad, slat, clat, n);
+   multArrayConst(lonD, angle::D2RCC, rad, n);
+   sinCosArray(rad, slon, clon, n);
+
+   // With phi = 0, theta = -(90 + lat) and psi = lon (see computeRotationalMatrix()),
+   // sin(theta) = -cos(lat) and cos(theta) = -sin(lat)
+   for (unsigned int i = 0; i < n; i++) {
+      Matrixd& mm = m[i];
+      mm(0,0) = -slat[i]*clon[i];
+      mm(0,1) = -slat[i]*slon[i];
+      mm(0,2) = +clat[i];
+      mm(0,3) = 0;
+
+      mm(1,0) = -slon[i];
+      mm(1,1) = +clon[i];
+      mm(1,2) = 0;
+      mm(1,3) = 0;
+
+      mm(2,0) = -clat[i]*clon[i];
+      mm(2,1) = -clat[i]*slon[i];
+      mm(2,2) = -slat[i];
+      mm(2,3) = 0;
+
+      mm(3,0) = 0;
+      mm(3,1) = 0;
+      mm(3,2) = 0;
+      mm(3,3) = 1;
+   }
+
+   delete [] rad;
+   delete [] slat;
+   delete [] clat;
+   delete [] slon;
+   delete [] clon;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// convertLL2PosVecEArray() -- 'n' LLAs to NED position vectors from a single
+// reference point using a flat earth projection (see convertLL2PosVecE())
+//------------------------------------------------------------------------------
+bool convertLL2PosVecEArray(
+      const double slat,         // IN: Reference latitude (degs)
+      const double slon,         // IN: Reference longitude (degs)
+      const double sinSlat,      // IN: Sine of ref latitude
+      const double cosSlat,      // IN: Cosine of ref latitude
+      const double* const lat,   // IN: Latitude array (degs)
+      const double* const lon,   // IN: Longitude array (degs)
+      const double* const alt,   // IN: Altitude array (meters)
+      Vec3d* const pos,          // OUT: NED position vector array from ref point (Meters)
+      const unsigned int n,      // IN: Number of sets to convert
+      const EarthModel* const em // IN: Pointer to an optional earth model (default: WGS-84)
+   )
+{
+   if (pos == nullptr) return false;
+
+   // Initialize earth model parameters
+   const EarthModel* pModel = em;
+   if (pModel == nullptr) { pModel = &EarthModel::wgs84; }
+
+   const double a  = pModel->getA();   // semi-major axis
+   const double e2 = pModel->getE2();  // eccentricity squared
+
+   // Define Constants
+   const double q   = 1.0 - e2 * sinSlat * sinSlat;
+   const double rn  = a / std::sqrt(q);
+   const double rm  = rn * (1.0 - e2) / q;
+   const double kn  = angle::D2RCC * rm;
+   const double ke  = angle::D2RCC * rn * cosSlat;
+
+   // Compute NED variables
+   for (unsigned int i = 0; i < n; i++) {
+      const double x = kn * angle::aepcdDeg(lat[i] - slat);
+      const double y = ke * angle::aepcdDeg(lon[i] - slon);
+      const double z = ( -alt[i] );
+      pos[i].set(x, y, z);
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// convertEcef2GeodArray() -- convert 'n' ECEF (XYZ coordinates) to Geodetic
+// (LLA coordinates)
+//
+//    Unlike the iterative convertEcef2Geod(), which stops when the altitude has
+//    converged to 0.1 meters, this is the closed form (non-iterative) method of
+//    H. Vermeille, "Direct transformation from geocentric coordinates to geodetic
+//    coordinates", Journal of Geodesy (2002) 76, so all 'n' conversions take the
+//    same path through the loops.  For points from the earth's surface out to
+//    geosynchronous altitudes, it's exact to the round-off of the double
+//    arithmetic (better than 1.0e-12 degrees and 1.0e-6 meters).  The results
+//    of convertEcef2Geod() are within about 1.0e-7 degrees and 1 meter (its
+//    altitudes are only converged to 0.1 meters per iteration) of these.
+//
+//    Points within about 43 km of the center of the earth, where the closed form
+//    is undefined, are converted using convertEcef2Geod().
+//------------------------------------------------------------------------------
+bool convertEcef2GeodArray(
+      const Vec3d* const ecef,   // IN: ECEF [ IX IY IZ ] array (meters)
+      Vec3d* const lla,          // OUT: Geodetic [ ILAT ILON IALT ] array (degs, degs, meters)
+      const unsigned int n,      // IN: Number of sets to convert
+      const EarthModel* const em // IN: Pointer to an optional earth model (default: WGS-84)
+   )
+{
+   if (ecef == nullptr || lla == nullptr) return false;
+
+   //---------------------------------------------
+   // Initialize earth model parameters
+   //---------------------------------------------
+   const EarthModel* pModel = em;
+   if (pModel == nullptr) { pModel = &EarthModel::wgs84; }
+
+   const double a  = pModel->getA();
+   const double e2 = pModel->getE2();
+   const double e4 = e2 * e2;
+   const double ia2 = 1.0 / (a * a);
+
+   const auto xx = new double[n];
+   const auto yy = new double[n];
+   const auto zz = new double[n];
+   const auto dd = new double[n];
+   const auto hh = new double[n];
+   const auto lat = new double[n];
+   const auto lon = new double[n];
+
+   //---------------------------------------------
+   // Closed form solution for 'k', which
+   // gives the distances along the normal
+   //---------------------------------------------
+   for (unsigned int i = 0; i < n; i++) {
+      const double x = ecef[i][IX];
+      const double y = ecef[i][IY];
+      const double z = ecef[i][IZ];
+      const double w2 = x*x + y*y;
+      const double p  = w2 * ia2;
+      const double q  = (1.0 - e2) * ia2 * z * z;
+      const double r  = (p + q - e4) / 6.0;
+      const double s  = e4 * p * q / (4.0 * r * r * r);
+      const double t  = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+      const double u  = r * (1.0 + t + 1.0 / t);
+      const double v  = std::sqrt(u * u + e4 * q);
+      const double uv = u + v;
+      const double w  = e2 * (uv - q) / (2.0 * v);
+      const double k  = std::sqrt(uv + w * w) - w;
+      const double d  = k * std::sqrt(w2) / (k + e2);
+      const double dz = std::sqrt(d * d + z * z);
+      xx[i] = x;
+      yy[i] = y;
+      zz[i] = z;
+      dd[i] = d + dz;
+      hh[i] = (k + e2 - 1.0) / k * dz;
+   }
+
+   //---------------------------------------------
+   // Latitude is twice the half angle atan2(z, d + sqrt(d^2 + z^2)),
+   // which is well conditioned all the way to the poles
+   //---------------------------------------------
+   atan2Array(zz, dd, lat, n);
+   atan2Array(yy, xx, lon, n);
+
+   //---------------------------------------------
+   // Calculate Outputs
+   //---------------------------------------------
+   bool ok = true;
+   for (unsigned int i = 0; i < n; i++) {
+      const double ltD = 2.0 * angle::R2DCC * lat[i];
+      const double lnD = angle::R2DCC * lon[i];
+      if (std::isfinite(ltD) && std::isfinite(hh[i])) {
+         lla[i].set(ltD, lnD, hh[i]);
+      }
+      else {
+         // Near the center of the earth
+         double lt(0.0), ln(0.0), h(0.0);
+         if (!convertEcef2Geod(xx[i], yy[i], zz[i], &lt, &ln, &h, pModel)) ok = false;
+         lla[i].set(lt, ln, h);
+      }
+   }
+
+   delete [] xx;
+   delete [] yy;
+   delete [] zz;
+   delete [] dd;
+   delete [] hh;
+   delete [] lat;
+   delete [] lon;
+
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// convertGeod2EcefArray() -- convert 'n' Geodetic (LLA coordinates) to ECEF
+// (XYZ coordinates); same results and same polar point and bad input handling
+// as convertGeod2Ecef()
+//------------------------------------------------------------------------------
+bool convertGeod2EcefArray(
+      const Vec3d* const lla,    // IN: Geodetic [ ILAT ILON IALT ] array (degs, degs, meters)
+      Vec3d* const ecef,         // OUT: ECEF [ IX IY IZ ] array (meters)
+      const unsigned int n,      // IN: Number of sets to convert
+      const EarthModel* const em // IN: Pointer to an optional earth model (default: WGS-84)
+   )
+{
+   if (lla == nullptr || ecef == nullptr) return false;
+
+   //---------------------------------------------
+   // Initialize earth model parameters
+   //---------------------------------------------
+   const EarthModel* pModel = em;
+   if (pModel == nullptr) { pModel = &EarthModel::wgs84; }
+
+   const double a  = pModel->getA();
+   const double b  = pModel->getB();
+   const double e2 = pModel->getE2();
+
+   const double EPS = 0.5;  // degrees
+
+   const auto rad = new double[n];
+   const auto sinLat = new double[n];
+   const auto cosLat = new double[n];
+   const auto sinLon = new double[n];
+   const auto cosLon = new double[n];
+
+   for (unsigned int i = 0; i < n; i++) {
+      rad[i] = angle::D2RCC * lla[i][ILAT];
+   }
+   sinCosArray(rad, sinLat, cosLat, n);
+   for (unsigned int i = 0; i < n; i++) {
+      rad[i] = angle::D2RCC * lla[i][ILON];
+   }
+   sinCosArray(rad, sinLon, cosLon, n);
+
+   bool ok = true;
+   for (unsigned int i = 0; i < n; i++) {
+      const double lat = lla[i][ILAT];
+      const double lon = lla[i][ILON];
+      const double alt = lla[i][IALT];
+
+      const double w  = std::sqrt(1.0 - e2*sinLat[i]*sinLat[i]);
+      const double rn = a/w;
+
+      if ( (lat < -90.0) || (lat > +90.0) || (lon < -180.0) || (lon > +180.0) ) {
+         // Bad input
+         ecef[i].set(0.0, 0.0, 0.0);
+         ok = false;
+      }
+      else if ( ((90.0 - lat) < EPS) || ((90.0 + lat) < EPS) ) {
+         // Polar point
+         if (lat > 0.0)
+            { ecef[i].set(0.0, 0.0, +(b + alt)); }
+         else
+            { ecef[i].set(0.0, 0.0, -(b + alt)); }
+      }
+      else {
+         ecef[i].set( (alt + rn) * cosLat[i] * cosLon[i],
+                      (alt + rn) * cosLat[i] * sinLon[i],
+                      (alt + rn*(1.0 - e2)) * sinLat[i] );
+      }
+   }
+
+   delete [] rad;
+   delete [] sinLat;
+   delete [] cosLat;
+   delete [] sinLon;
+   delete [] cosLon;
+
+   return ok;
+}
+
 //==============================================================================
 // Legacy functions ...
 //
@@ -2,6 +2,7 @@
 #include "openeaagles/dafif/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/dafif/AirportLoader.hpp"
 #include "openeaagles/dafif/NavaidLoader.hpp"
@@ -14,19 +15,12 @@ namespace dafif {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    if ( name == AirportLoader::getFactoryName() ) {
-        obj = new AirportLoader();
-    }
-    else if ( name == NavaidLoader::getFactoryName() ) {
-        obj = new NavaidLoader();
-    }
-    else if ( name == WaypointLoader::getFactoryName() ) {
-        obj = new WaypointLoader();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        { AirportLoader::getFactoryName(),   base::FactoryTable::make<AirportLoader> },
+        { NavaidLoader::getFactoryName(),    base::FactoryTable::make<NavaidLoader> },
+        { WaypointLoader::getFactoryName(),  base::FactoryTable::make<WaypointLoader> },
+    };
+    return table.create(name);
 }
 
 }
@@ -45,22 +45,7 @@ BEGIN_SLOT_MAP(Field)
 END_SLOT_MAP()
 
 BEGIN_EVENT_HANDLER(Field)
-    if (mode == input) {
-        bool kb = ( _event >= 0x20 && _event <= 0x7f );
-        ON_EVENT(FORWARD_SPACE,onForwardSpace)
-        ON_EVENT(BACK_SPACE,onBackSpace)
-        // Keyboard Entry
-        if (kb) {
-            // Filter the input event -- that is, let a virtual member
-            // function filter the input event using the current template
-            // character.
-            char nc = filterInputEvent(_event,inputExample.getChar(icp));
-            if (nc != '\0') {
-                setChar(nc);
-                _used = true;
-            }
-        }
-    }
+    ON_ANYKEY(onInputKey)
     ON_EVENT_OBJ(SET_POSITION,setPosition,base::List)
     ON_EVENT_OBJ(SET_LINE,onSetLine,base::Number)
     ON_EVENT_OBJ(SET_COLUMN,onSetColumn,base::Number)
@@ -358,6 +343,31 @@ bool Field::isInputValueValid() const
 }
 
 
+//------------------------------------------------------------------------------
+// onInputKey() -- Handles the key events while in input mode
+//------------------------------------------------------------------------------
+bool Field::onInputKey(const int event)
+{
+    bool used = false;
+    if (mode == input) {
+        if (event == FORWARD_SPACE) used = onForwardSpace();
+        if (!used && event == BACK_SPACE) used = onBackSpace();
+        // Keyboard Entry
+        const bool kb = ( event >= 0x20 && event <= 0x7f );
+        if (!used && kb) {
+            // Filter the input event -- that is, let a virtual member
+            // function filter the input event using the current template
+            // character.
+            char nc = filterInputEvent(event,inputExample.getChar(icp));
+            if (nc != '\0') {
+                setChar(nc);
+                used = true;
+            }
+        }
+    }
+    return used;
+}
+
 //------------------------------------------------------------------------------
 // onForwardSpace() --
 //------------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 #include "openeaagles/graphics/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/graphics/Graphic.hpp"
 #include "openeaagles/graphics/Display.hpp"
@@ -44,154 +45,69 @@ namespace graphics {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    // General graphics support
-    if ( name == Graphic::getFactoryName() ) {
-        obj = new Graphic();
-    }
-    else if ( name == Page::getFactoryName() ) {
-        obj = new Page();
-    }
-    else if ( name == Display::getFactoryName() ) {
-        obj = new Display();
-    }
-    else if ( name == Translator::getFactoryName() ) {
-        obj = new Translator();
-    }
-    else if ( name == Rotators::getFactoryName() ) {
-        obj = new Rotators();
-    }
-    else if ( name == ColorRotary::getFactoryName() ) {
-        obj = new ColorRotary();
-    }
-    else if ( name == ColorGradient::getFactoryName() ) {
-        obj = new ColorGradient();
-    }
-
-    // Shapes
-    else if ( name == Circle::getFactoryName() ) {
-        obj = new Circle();
-    }
-    else if ( name == Point::getFactoryName() ) {
-        obj = new Point();
-    }
-    else if ( name == Polygon::getFactoryName() ) {
-        obj = new Polygon();
-    }
-    else if ( name == LineLoop::getFactoryName() ) {
-        obj = new LineLoop();
-    }
-    else if ( name == Line::getFactoryName() ) {
-        obj = new Line();
-    }
-    else if ( name == Arc::getFactoryName() ) {
-        obj = new Arc();
-    }
-    else if ( name == OcclusionCircle::getFactoryName() ) {
-        obj = new OcclusionCircle();
-    }
-    else if ( name == OcclusionArc::getFactoryName() ) {
-        obj = new OcclusionArc();
-    }
-    else if ( name == Quad::getFactoryName() ) {
-        obj = new Quad();
-    }
-    else if ( name == Triangle::getFactoryName() ) {
-        obj = new Triangle();
-    }
-
-    // Fields
-    else if ( name == AsciiText::getFactoryName() ) {
-        obj = new AsciiText();
-    }
-    else if ( name == Cursor::getFactoryName() ) {
-        obj = new Cursor();
-    }
-
-    // Readouts
-    else if ( name == NumericReadout::getFactoryName() ) {
-        obj = new NumericReadout();
-    }
-    else if ( name == HexReadout::getFactoryName() ) {
-        obj = new HexReadout();
-    }
-    else if ( name == OctalReadout::getFactoryName() ) {
-        obj = new OctalReadout();
-    }
-    else if ( name == TimeReadout::getFactoryName() ) {
-        obj = new TimeReadout();
-    }
-    else if ( name == DirectionReadout::getFactoryName() ) {
-        obj = new DirectionReadout();
-    }
-    else if ( name == LatitudeReadout::getFactoryName() ) {
-        obj = new LatitudeReadout();
-    }
-    else if ( name == LongitudeReadout::getFactoryName() ) {
-        obj = new LongitudeReadout();
-    }
-    else if ( name == Rotary::getFactoryName() ) {
-        obj = new Rotary();
-    }
-    else if ( name == Rotary2::getFactoryName() ) {
-        obj = new Rotary2();
-    }
-
-    // Stroke Font
-    else if ( name == StrokeFont::getFactoryName() ) {
-        obj = new StrokeFont();
-    }
-
-    // Bitmap Font
-    else if ( name == BitmapFont::getFactoryName() ) {
-        obj = new BitmapFont();
-    }
-
-    // FTGL Fonts
-    else if ( name == FtglBitmapFont::getFactoryName() ) {
-        obj = new FtglBitmapFont();
-    }
-    else if ( name == FtglOutlineFont::getFactoryName() ) {
-        obj = new FtglOutlineFont();
-    }
-    else if ( name == FtglExtrdFont::getFactoryName() ) {
-        obj = new FtglExtrdFont();
-    }
-    else if ( name == FtglPixmapFont::getFactoryName() ) {
-        obj = new FtglPixmapFont();
-    }
-    else if ( name == FtglPolygonFont::getFactoryName() ) {
-        obj = new FtglPolygonFont();
-    }
-    else if ( name == FtglHaloFont::getFactoryName() ) {
-        obj = new FtglHaloFont();
-    }
-    else if ( name == FtglTextureFont::getFactoryName() ) {
-        obj = new FtglTextureFont();
-    }
-
-    // Bitmap Textures
-    else if ( name == BmpTexture::getFactoryName() ) {
-        obj = new BmpTexture();
-    }
-    // Material
-    else if ( name == Material::getFactoryName() ) {
-        obj = new Material();
-    }
-    // pages
-    else if ( name == MfdPage::getFactoryName() ) {
-        obj = new MfdPage();
-    }
-    else if ( name == MapPage::getFactoryName() ) {
-        obj = new MapPage();
-    }
-    // Symbol loader
-    else if ( name == SymbolLoader::getFactoryName() ) {
-        obj = new SymbolLoader();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        // General graphics support
+        { Graphic::getFactoryName(),           base::FactoryTable::make<Graphic> },
+        { Page::getFactoryName(),              base::FactoryTable::make<Page> },
+        { Display::getFactoryName(),           base::FactoryTable::make<Display> },
+        { Translator::getFactoryName(),        base::FactoryTable::make<Translator> },
+        { Rotators::getFactoryName(),          base::FactoryTable::make<Rotators> },
+        { ColorRotary::getFactoryName(),       base::FactoryTable::make<ColorRotary> },
+        { ColorGradient::getFactoryName(),     base::FactoryTable::make<ColorGradient> },
+
+        // Shapes
+        { Circle::getFactoryName(),            base::FactoryTable::make<Circle> },
+        { Point::getFactoryName(),             base::FactoryTable::make<Point> },
+        { Polygon::getFactoryName(),           base::FactoryTable::make<Polygon> },
+        { LineLoop::getFactoryName(),          base::FactoryTable::make<LineLoop> },
+        { Line::getFactoryName(),              base::FactoryTable::make<Line> },
+        { Arc::getFactoryName(),               base::FactoryTable::make<Arc> },
+        { OcclusionCircle::getFactoryName(),   base::FactoryTable::make<OcclusionCircle> },
+        { OcclusionArc::getFactoryName(),      base::FactoryTable::make<OcclusionArc> },
+        { Quad::getFactoryName(),              base::FactoryTable::make<Quad> },
+        { Triangle::getFactoryName(),          base::FactoryTable::make<Triangle> },
+
+        // Fields
+        { AsciiText::getFactoryName(),         base::FactoryTable::make<AsciiText> },
+        { Cursor::getFactoryName(),            base::FactoryTable::make<Cursor> },
+
+        // Readouts
+        { NumericReadout::getFactoryName(),    base::FactoryTable::make<NumericReadout> },
+        { HexReadout::getFactoryName(),        base::FactoryTable::make<HexReadout> },
+        { OctalReadout::getFactoryName(),      base::FactoryTable::make<OctalReadout> },
+        { TimeReadout::getFactoryName(),       base::FactoryTable::make<TimeReadout> },
+        { DirectionReadout::getFactoryName(),  base::FactoryTable::make<DirectionReadout> },
+        { LatitudeReadout::getFactoryName(),   base::FactoryTable::make<LatitudeReadout> },
+        { LongitudeReadout::getFactoryName(),  base::FactoryTable::make<LongitudeReadout> },
+        { Rotary::getFactoryName(),            base::FactoryTable::make<Rotary> },
+        { Rotary2::getFactoryName(),           base::FactoryTable::make<Rotary2> },
+
+        // Stroke Font
+        { StrokeFont::getFactoryName(),        base::FactoryTable::make<StrokeFont> },
+
+        // Bitmap Font
+        { BitmapFont::getFactoryName(),        base::FactoryTable::make<BitmapFont> },
+
+        // FTGL Fonts
+        { FtglBitmapFont::getFactoryName(),    base::FactoryTable::make<FtglBitmapFont> },
+        { FtglOutlineFont::getFactoryName(),   base::FactoryTable::make<FtglOutlineFont> },
+        { FtglExtrdFont::getFactoryName(),     base::FactoryTable::make<FtglExtrdFont> },
+        { FtglPixmapFont::getFactoryName(),    base::FactoryTable::make<FtglPixmapFont> },
+        { FtglPolygonFont::getFactoryName(),   base::FactoryTable::make<FtglPolygonFont> },
+        { FtglHaloFont::getFactoryName(),      base::FactoryTable::make<FtglHaloFont> },
+        { FtglTextureFont::getFactoryName(),   base::FactoryTable::make<FtglTextureFont> },
+
+        // Bitmap Textures
+        { BmpTexture::getFactoryName(),        base::FactoryTable::make<BmpTexture> },
+        // Material
+        { Material::getFactoryName(),          base::FactoryTable::make<Material> },
+        // pages
+        { MfdPage::getFactoryName(),           base::FactoryTable::make<MfdPage> },
+        { MapPage::getFactoryName(),           base::FactoryTable::make<MapPage> },
+        // Symbol loader
+        { SymbolLoader::getFactoryName(),      base::FactoryTable::make<SymbolLoader> },
+    };
+    return table.create(name);
 }
 
 }
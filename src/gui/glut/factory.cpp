@@ -2,6 +2,7 @@
 #include "openeaagles/gui/glut/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/gui/glut/GlutDisplay.hpp"
 #include "openeaagles/gui/glut/Shapes3D.hpp"
@@ -13,45 +14,22 @@ namespace glut {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    // General graphics support
-    if ( name == GlutDisplay::getFactoryName() ) {
-      obj = new GlutDisplay();
-    }
-    // glut shapes support
-    else if ( name == Sphere::getFactoryName() ) {
-      obj = new Sphere();
-    }
-    else if ( name == Cylinder::getFactoryName() ) {
-      obj = new Cylinder();
-    }
-    else if ( name == Cone::getFactoryName() ) {
-      obj = new Cone();
-    }
-    else if ( name == Cube::getFactoryName() ) {
-      obj = new Cube();
-    }
-    else if ( name == Torus::getFactoryName() ) {
-      obj = new Torus();
-    }
-    else if ( name == Dodecahedron::getFactoryName() ) {
-      obj = new Dodecahedron();
-    }
-    else if ( name == Tetrahedron::getFactoryName() ) {
-      obj = new Tetrahedron();
-    }
-    else if ( name == Icosahedron::getFactoryName() ) {
-      obj = new Icosahedron();
-    }
-    else if ( name == Octahedron::getFactoryName() ) {
-      obj = new Octahedron();
-    }
-    else if ( name == Teapot::getFactoryName() ) {
-      obj = new Teapot();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        // General graphics support
+        { GlutDisplay::getFactoryName(),   base::FactoryTable::make<GlutDisplay> },
+        // glut shapes support
+        { Sphere::getFactoryName(),        base::FactoryTable::make<Sphere> },
+        { Cylinder::getFactoryName(),      base::FactoryTable::make<Cylinder> },
+        { Cone::getFactoryName(),          base::FactoryTable::make<Cone> },
+        { Cube::getFactoryName(),          base::FactoryTable::make<Cube> },
+        { Torus::getFactoryName(),         base::FactoryTable::make<Torus> },
+        { Dodecahedron::getFactoryName(),  base::FactoryTable::make<Dodecahedron> },
+        { Tetrahedron::getFactoryName(),   base::FactoryTable::make<Tetrahedron> },
+        { Icosahedron::getFactoryName(),   base::FactoryTable::make<Icosahedron> },
+        { Octahedron::getFactoryName(),    base::FactoryTable::make<Octahedron> },
+        { Teapot::getFactoryName(),        base::FactoryTable::make<Teapot> },
+    };
+    return table.create(name);
 }
 
 }
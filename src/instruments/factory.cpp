@@ -2,6 +2,7 @@
 #include "openeaagles/instruments/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 // Top Level objects
 #include "openeaagles/instruments/Instrument.hpp"
@@ -56,118 +57,63 @@ namespace instruments {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    // Instrument
-    if ( name == Instrument::getFactoryName() ) {
-        obj = new Instrument;
-    }
-    // Analog Dial
-    else if ( name == AnalogDial::getFactoryName() ) {
-        obj = new AnalogDial;
-    }
-    // Tick Marks for the analog dial
-    else if ( name == DialTickMarks::getFactoryName() ) {
-        obj = new DialTickMarks;
-    }
-    // Arc Segments for the analog dial
-    else if ( name == DialArcSegment::getFactoryName() ) {
-        obj = new DialArcSegment;
-    }
-    // Dial Pointer
-    else if ( name == DialPointer::getFactoryName() ) {
-        obj = new DialPointer;
-    }
-    // CompassRose
-    else if ( name == CompassRose::getFactoryName() ) {
-        obj = new CompassRose;
-    }
-    // Bearing Pointer
-    else if ( name == BearingPointer::getFactoryName() ) {
-        obj = new BearingPointer;
-    }
-    // AltitudeDial
-    else if ( name == AltitudeDial::getFactoryName() ) {
-        obj = new AltitudeDial;
-    }
-    // GMeterDial
-    else if ( name == GMeterDial::getFactoryName() ) {
-        obj = new GMeterDial;
-    }    
-    // Here is the analog gauge and its pieces
-    // AnalogGauge
-    else if ( name == AnalogGauge::getFactoryName() ) {
-        obj = new AnalogGauge;
-    }
-    else if ( name == GaugeSlider::getFactoryName() ) {
-        obj = new GaugeSlider;
-    }
-    // Tape
-    else if ( name == Tape::getFactoryName() ) {
-        obj = new Tape;
-    }
-    // digital AOA gauge
-    else if ( name == AoAIndexer::getFactoryName() ) {
-        obj = new AoAIndexer;
-    }
-    // Tick Marks (horizontal and vertical)
-    else if ( name == TickMarks::getFactoryName() ) {
-        obj = new TickMarks;
-    }
-    // Landing Gear
-    else if ( name == LandingGear::getFactoryName() ) {
-        obj = new LandingGear;
-    }
-    // Landing Lights
-    else if ( name == LandingLight::getFactoryName() ) {
-        obj = new LandingLight;
-    }
-    // EngPage
-    else if ( name == EngPage::getFactoryName() ) {
-        obj = new EngPage;
-    }
-    // Button
-    else if (name == Button::getFactoryName() ) {
-        obj = new Button;
-    }
-    // Push Button
-    else if (name == PushButton::getFactoryName() ) {
-        obj = new PushButton;
-    }
-    // Rotary Switch
-    else if (name == RotarySwitch::getFactoryName() ) {
-        obj = new RotarySwitch;
-    }
-    // Knob
-    else if (name == Knob::getFactoryName() ) {
-        obj = new Knob;
-    }
-    // Switch
-    else if (name == Switch::getFactoryName() ) {
-        obj = new Switch;
-    }
-    // Hold Switch
-    else if (name == SolenoidSwitch::getFactoryName() ) {
-        obj = new SolenoidSwitch;
-    }
-    // Hold Button
-    else if (name == SolenoidButton::getFactoryName() ) {
-        obj = new SolenoidButton;
-    }
-    // Adi
-    else if (name == Adi::getFactoryName() ) {
-        obj = new Adi;
-    }
-    // Ghost Horizon
-    else if (name == GhostHorizon::getFactoryName() ) {
-        obj = new GhostHorizon;
-    }
-    // Eadi3D
-    else if (name == Eadi3DPage::getFactoryName() ) {
-        obj = new Eadi3DPage;
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        // Instrument
+        { Instrument::getFactoryName(),      base::FactoryTable::make<Instrument> },
+        // Analog Dial
+        { AnalogDial::getFactoryName(),      base::FactoryTable::make<AnalogDial> },
+        // Tick Marks for the analog dial
+        { DialTickMarks::getFactoryName(),   base::FactoryTable::make<DialTickMarks> },
+        // Arc Segments for the analog dial
+        { DialArcSegment::getFactoryName(),  base::FactoryTable::make<DialArcSegment> },
+        // Dial Pointer
+        { DialPointer::getFactoryName(),     base::FactoryTable::make<DialPointer> },
+        // CompassRose
+        { CompassRose::getFactoryName(),     base::FactoryTable::make<CompassRose> },
+        // Bearing Pointer
+        { BearingPointer::getFactoryName(),  base::FactoryTable::make<BearingPointer> },
+        // AltitudeDial
+        { AltitudeDial::getFactoryName(),    base::FactoryTable::make<AltitudeDial> },
+        // GMeterDial
+        { GMeterDial::getFactoryName(),      base::FactoryTable::make<GMeterDial> },
+        // Here is the analog gauge and its pieces
+        // AnalogGauge
+        { AnalogGauge::getFactoryName(),     base::FactoryTable::make<AnalogGauge> },
+        { GaugeSlider::getFactoryName(),     base::FactoryTable::make<GaugeSlider> },
+        // Tape
+        { Tape::getFactoryName(),            base::FactoryTable::make<Tape> },
+        // digital AOA gauge
+        { AoAIndexer::getFactoryName(),      base::FactoryTable::make<AoAIndexer> },
+        // Tick Marks (horizontal and vertical)
+        { TickMarks::getFactoryName(),       base::FactoryTable::make<TickMarks> },
+        // Landing Gear
+        { LandingGear::getFactoryName(),     base::FactoryTable::make<LandingGear> },
+        // Landing Lights
+        { LandingLight::getFactoryName(),    base::FactoryTable::make<LandingLight> },
+        // EngPage
+        { EngPage::getFactoryName(),         base::FactoryTable::make<EngPage> },
+        // Button
+        { Button::getFactoryName(),          base::FactoryTable::make<Button> },
+        // Push Button
+        { PushButton::getFactoryName(),      base::FactoryTable::make<PushButton> },
+        // Rotary Switch
+        { RotarySwitch::getFactoryName(),    base::FactoryTable::make<RotarySwitch> },
+        // Knob
+        { Knob::getFactoryName(),            base::FactoryTable::make<Knob> },
+        // Switch
+        { Switch::getFactoryName(),          base::FactoryTable::make<Switch> },
+        // Hold Switch
+        { SolenoidSwitch::getFactoryName(),  base::FactoryTable::make<SolenoidSwitch> },
+        // Hold Button
+        { SolenoidButton::getFactoryName(),  base::FactoryTable::make<SolenoidButton> },
+        // Adi
+        { Adi::getFactoryName(),             base::FactoryTable::make<Adi> },
+        // Ghost Horizon
+        { GhostHorizon::getFactoryName(),    base::FactoryTable::make<GhostHorizon> },
+        // Eadi3D
+        { Eadi3DPage::getFactoryName(),      base::FactoryTable::make<Eadi3DPage> },
+    };
+    return table.create(name);
 }
 
 }
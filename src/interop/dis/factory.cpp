@@ -2,6 +2,7 @@
 #include "openeaagles/interop/dis/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/interop/dis/NetIO.hpp"
 #include "openeaagles/interop/dis/Ntm.hpp"
@@ -15,19 +16,12 @@ namespace dis {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    if ( name == NetIO::getFactoryName() ) {
-        obj = new NetIO();
-    }
-    else if ( name == Ntm::getFactoryName() ) {
-        obj = new Ntm();
-    }
-    else if ( name == EmissionPduHandler::getFactoryName() ) {
-        obj = new EmissionPduHandler();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        { NetIO::getFactoryName(),               base::FactoryTable::make<NetIO> },
+        { Ntm::getFactoryName(),                 base::FactoryTable::make<Ntm> },
+        { EmissionPduHandler::getFactoryName(),  base::FactoryTable::make<EmissionPduHandler> },
+    };
+    return table.create(name);
 }
 
 }
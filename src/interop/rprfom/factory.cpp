@@ -1,5 +1,6 @@
 
 #include "openeaagles/interop/rprfom/factory.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 #include "openeaagles/interop/rprfom/NetIO.hpp"
 
 #include <string>
@@ -9,13 +10,10 @@ namespace rprfom {
 
 base::Object* formFunc(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    if ( name == NetIO::getFactoryName() ) {
-        obj = new NetIO();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        { NetIO::getFactoryName(),  base::FactoryTable::make<NetIO> },
+    };
+    return table.create(name);
 }
 
 }
@@ -2,6 +2,7 @@
 #include "openeaagles/iodevice/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/iodevice/Ai2DiSwitch.hpp"
 #include "openeaagles/iodevice/AnalogInput.hpp"
@@ -24,43 +25,26 @@ namespace iodevice {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    // Data buffers
-    if ( name == IoData::getFactoryName() ) {
-        obj = new IoData();
-    }
-
-    // Data Handlers
-    else if ( name == DiscreteInput::getFactoryName() ) {
-        obj = new DiscreteInput();
-    }
-    else if ( name == DiscreteOutput::getFactoryName() ) {
-        obj = new DiscreteOutput();
-    }
-    else if ( name == AnalogInput::getFactoryName() ) {
-        obj = new AnalogInput();
-    }
-    else if ( name == AnalogOutput::getFactoryName() ) {
-        obj = new AnalogOutput();
-    }
-
-    // Signal converters and generators
-    else if ( name == Ai2DiSwitch::getFactoryName() ) {
-        obj = new Ai2DiSwitch();
-    }
-    else if ( name == SignalGen::getFactoryName() ) {
-        obj = new SignalGen();
-    }
-
-    // ---
-    // Device handler implementations (Linux and/or Windows)
-    // ---
-    else if ( name == UsbJoystick::getFactoryName() ) {
-        obj = new UsbJoystick();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        // Data buffers
+        { IoData::getFactoryName(),          base::FactoryTable::make<IoData> },
+
+        // Data Handlers
+        { DiscreteInput::getFactoryName(),   base::FactoryTable::make<DiscreteInput> },
+        { DiscreteOutput::getFactoryName(),  base::FactoryTable::make<DiscreteOutput> },
+        { AnalogInput::getFactoryName(),     base::FactoryTable::make<AnalogInput> },
+        { AnalogOutput::getFactoryName(),    base::FactoryTable::make<AnalogOutput> },
+
+        // Signal converters and generators
+        { Ai2DiSwitch::getFactoryName(),     base::FactoryTable::make<Ai2DiSwitch> },
+        { SignalGen::getFactoryName(),       base::FactoryTable::make<SignalGen> },
+
+        // ---
+        // Device handler implementations (Linux and/or Windows)
+        // ---
+        { UsbJoystick::getFactoryName(),     base::FactoryTable::make<UsbJoystick> },
+    };
+    return table.create(name);
 }
 
 }
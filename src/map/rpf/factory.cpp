@@ -1,5 +1,6 @@
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/map/rpf/factory.hpp"
 #include "openeaagles/map/rpf/MapDrawer.hpp"
@@ -12,18 +13,13 @@ namespace rpf  {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    // Map Drawer
-    if ( name == MapDrawer::getFactoryName() ) {
-        obj = new MapDrawer();
-    }
-    // CadrgMap
-    else if ( name == CadrgMap::getFactoryName() ) {
-        obj = new CadrgMap();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        // Map Drawer
+        { MapDrawer::getFactoryName(),  base::FactoryTable::make<MapDrawer> },
+        // CadrgMap
+        { CadrgMap::getFactoryName(),   base::FactoryTable::make<CadrgMap> },
+    };
+    return table.create(name);
 }
 
 }
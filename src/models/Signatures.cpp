@@ -10,10 +10,12 @@
 #include "openeaagles/base/PairStream.hpp"
 #include "openeaagles/base/functors/Tables.hpp"
 
+#include "openeaagles/base/units/Angles.hpp"
 #include "openeaagles/base/units/Areas.hpp"
-
 #include "openeaagles/base/units/Distances.hpp"
+#include "openeaagles/base/units/Frequencies.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace oe {
@@ -40,6 +42,23 @@ void RfSignature::deleteData()
 {
 }
 
+//------------------------------------------------------------------------------
+// getRCSArray() -- Get the RCS for arrays of aspect angles and frequencies
+//------------------------------------------------------------------------------
+void RfSignature::getRCSArray(const double az[], const double el[], const double freq[], double rcs[], const unsigned int n)
+{
+    if (n == 0) return;
+
+    const auto em = new Emission();
+    for (unsigned int i = 0; i < n; i++) {
+        em->setAzimuthAoi(az[i]);
+        em->setElevationAoi(el[i]);
+        em->setFrequency(freq[i]);
+        rcs[i] = getRCS(em);
+    }
+    em->unref();
+}
+
 
 //==============================================================================
 // Class: SigConstant
@@ -596,5 +615,481 @@ bool SigAzEl::setSlotDecibel(const base::Number* const msg)
    return ok;
 }
 
+
+//==============================================================================
+// Class: SigCompiled
+//==============================================================================
+IMPLEMENT_SUBCLASS(SigCompiled,"SigCompiled")
+EMPTY_SERIALIZER(SigCompiled)
+
+BEGIN_SLOTTABLE(SigCompiled)
+    "signature",        // 1: Signature to compile
+    "azimuthStep",      // 2: Azimuth grid step
+    "elevationStep",    // 3: Elevation grid step
+    "minFrequency",     // 4: Lowest frequency sampled
+    "maxFrequency",     // 5: Highest frequency sampled
+    "numFrequencies",   // 6: Number of log spaced frequency samples
+END_SLOTTABLE(SigCompiled)
+
+BEGIN_SLOT_MAP(SigCompiled)
+    ON_SLOT(1, setSlotSignature,        RfSignature)
+    ON_SLOT(2, setSlotAzimuthStep,      base::Angle)
+    ON_SLOT(3, setSlotElevationStep,    base::Angle)
+    ON_SLOT(4, setSlotMinFrequency,     base::Number)
+    ON_SLOT(5, setSlotMaxFrequency,     base::Number)
+    ON_SLOT(6, setSlotNumFrequencies,   base::Number)
+END_SLOT_MAP()
+
+SigCompiled::SigCompiled()
+{
+   STANDARD_CONSTRUCTOR()
+
+   azStep = 2.0 * base::angle::D2RCC;
+   elStep = 2.0 * base::angle::D2RCC;
+}
+
+void SigCompiled::copyData(const SigCompiled& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   if (org.signature != nullptr) {
+      RfSignature* copy = org.signature->clone();
+      setSlotSignature(copy);
+      copy->unref();
+   }
+   else {
+      setSlotSignature(nullptr);
+   }
+
+   azStep = org.azStep;
+   elStep = org.elStep;
+   minFreq = org.minFreq;
+   maxFreq = org.maxFreq;
+   nFreq = org.nFreq;
+
+   // The compiled table is immutable, so we share it
+   table = org.table;
+}
+
+void SigCompiled::deleteData()
+{
+   setSlotSignature(nullptr);
+   table.reset();
+}
+
+//------------------------------------------------------------------------------
+// reset() -- compile the table, if we haven't already
+//------------------------------------------------------------------------------
+void SigCompiled::reset()
+{
+   BaseClass::reset();
+   if (signature != nullptr) signature->reset();
+   if (table == nullptr) compile();
+}
+
+//------------------------------------------------------------------------------
+// sample() -- sample the live signature 'sig'
+//------------------------------------------------------------------------------
+double SigCompiled::sample(RfSignature* const sig, Emission* const em, const double az, const double el, const double freq) const
+{
+   double rcs = 0.0;
+   if (sig != nullptr) {
+      em->setAzimuthAoi(az);
+      em->setElevationAoi(el);
+      em->setFrequency(freq);
+      rcs = sig->getRCS(em);
+   }
+   return rcs;
+}
+
+//------------------------------------------------------------------------------
+// compile() -- sample our signature into the az/el/frequency table
+//------------------------------------------------------------------------------
+bool SigCompiled::compile()
+{
+   table.reset();
+
+   if (signature == nullptr || azStep <= 0.0 || elStep <= 0.0 || minFreq <= 0.0) return false;
+
+   const auto t = std::make_shared<Table>();
+
+   // ---
+   // Grid dimensions; the steps are adjusted to evenly span the ranges
+   // ---
+   t->nAz = static_cast<unsigned int>(std::ceil((2.0 * base::PI) / azStep)) + 1;
+   if (t->nAz < 2) t->nAz = 2;
+   t->dAz = (2.0 * base::PI) / static_cast<double>(t->nAz - 1);
+   t->invAz = 1.0 / t->dAz;
+
+   t->nEl = static_cast<unsigned int>(std::ceil(base::PI / elStep)) + 1;
+   if (t->nEl < 2) t->nEl = 2;
+   t->dEl = base::PI / static_cast<double>(t->nEl - 1);
+   t->invEl = 1.0 / t->dEl;
+
+   unsigned int nf = nFreq;
+   if (nf < 1 || maxFreq <= minFreq) nf = 1;
+   t->logMinFreq = std::log10(minFreq);
+   t->logFreqStep = 0.0;
+   if (nf > 1) t->logFreqStep = (std::log10(maxFreq) - t->logMinFreq) / static_cast<double>(nf - 1);
+
+   // ---
+   // Layers: the SigSwitch subcomponents, or just our signature
+   // ---
+   std::vector<RfSignature*> sigs;
+   t->isSwitch = (dynamic_cast<SigSwitch*>(signature) != nullptr);
+   if (t->isSwitch) {
+      base::PairStream* list = signature->getComponents();
+      if (list != nullptr) {
+         base::List::Item* item = list->getFirstItem();
+         while (item != nullptr) {
+            const auto pair = static_cast<base::Pair*>(item->getValue());
+            sigs.push_back( dynamic_cast<RfSignature*>(pair->object()) );
+            item = item->getNext();
+         }
+         list->unref();
+      }
+   }
+   else {
+      sigs.push_back(signature);
+   }
+   if (sigs.empty()) return false;
+
+   // ---
+   // Sample the signatures: [layer][freq][el][az]
+   // ---
+   const auto em = new Emission();
+   const unsigned int nLayer0 = static_cast<unsigned int>(sigs.size());
+   t->data.resize(static_cast<std::size_t>(nLayer0) * nf * t->nEl * t->nAz);
+   std::size_t idx = 0;
+   for (unsigned int l = 0; l < nLayer0; l++) {
+      for (unsigned int k = 0; k < nf; k++) {
+         const double freq = std::pow(10.0, t->logMinFreq + t->logFreqStep * k);
+         for (unsigned int j = 0; j < t->nEl; j++) {
+            const double el = -base::PI/2.0 + t->dEl * j;
+            for (unsigned int i = 0; i < t->nAz; i++) {
+               const double az = -base::PI + t->dAz * i;
+               t->data[idx++] = static_cast<float>( sample(sigs[l], em, az, el, freq) );
+            }
+         }
+      }
+   }
+   t->nFreq = nf;
+   t->nLayers = nLayer0;
+
+   // ---
+   // Accuracy: compare with the live signatures at the cell centers
+   // ---
+   static const double MIN_RCS = 1.0e-10;
+   double maxErr = 0.0;
+   double sumErr2 = 0.0;
+   unsigned int cnt = 0;
+   for (unsigned int l = 0; l < t->nLayers; l++) {
+      for (unsigned int k = 0; k < nf; k++) {
+         double lf = t->logMinFreq + t->logFreqStep * k;
+         if (nf > 1) {
+            if (k == nf - 1) break;
+            lf += t->logFreqStep / 2.0;
+         }
+         const double freq = std::pow(10.0, lf);
+         for (unsigned int j = 0; j < (t->nEl - 1); j++) {
+            const double el = -base::PI/2.0 + t->dEl * (j + 0.5);
+            for (unsigned int i = 0; i < (t->nAz - 1); i++) {
+               const double az = -base::PI + t->dAz * (i + 0.5);
+               const double live = sample(sigs[l], em, az, el, freq);
+               const double tbl = lookup(*t, l, az, el, freq);
+               const double errDb = std::fabs(10.0 * std::log10(std::max(live, MIN_RCS)) - 10.0 * std::log10(std::max(tbl, MIN_RCS)));
+               if (errDb > maxErr) maxErr = errDb;
+               sumErr2 += errDb * errDb;
+               cnt++;
+            }
+         }
+      }
+   }
+   em->unref();
+
+   t->maxErrDb = maxErr;
+   t->rmsErrDb = (cnt > 0 ? std::sqrt(sumErr2 / static_cast<double>(cnt)) : 0.0);
+   table = t;
+
+   if (isMessageEnabled(MSG_INFO)) {
+      std::cout << "SigCompiled::compile(): " << t->nLayers << " layer(s), " << t->nAz << "(az) x " << t->nEl << "(el) x ";
+      std::cout << t->nFreq << "(freq) samples; error (dB): max = " << t->maxErrDb << ", rms = " << t->rmsErrDb << std::endl;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// lookup() -- trilinear table lookup
+//------------------------------------------------------------------------------
+double SigCompiled::lookup(const unsigned int layer, const double az, const double el, const double freq) const
+{
+   if (table == nullptr) return 0.0;
+   return lookup(*table, layer, az, el, freq);
+}
+
+double SigCompiled::lookup(const Table& t, const unsigned int layer, const double az, const double el, const double freq)
+{
+   if (layer >= t.nLayers) return 0.0;
+
+   // Azimuth
+   double x = (az + base::PI) * t.invAz;
+   if (x < 0.0) x = 0.0;
+   unsigned int i0 = static_cast<unsigned int>(x);
+   if (i0 > t.nAz - 2) i0 = t.nAz - 2;
+   double fx = x - i0;
+   if (fx > 1.0) fx = 1.0;
+
+   // Elevation
+   double y = (el + base::PI/2.0) * t.invEl;
+   if (y < 0.0) y = 0.0;
+   unsigned int j0 = static_cast<unsigned int>(y);
+   if (j0 > t.nEl - 2) j0 = t.nEl - 2;
+   double fy = y - j0;
+   if (fy > 1.0) fy = 1.0;
+
+   // Frequency
+   unsigned int k0 = 0;
+   double fz = 0.0;
+   freqIndex(t, freq, &k0, &fz);
+
+   return interpolate(t, layer, i0, fx, j0, fy, k0, fz);
+}
+
+//------------------------------------------------------------------------------
+// freqIndex() -- frequency table index, 'k', and fraction, 'fz'
+//------------------------------------------------------------------------------
+void SigCompiled::freqIndex(const Table& t, const double freq, unsigned int* const k, double* const fz)
+{
+   *k = 0;
+   *fz = 0.0;
+   if (t.nFreq > 1 && freq > 0.0) {
+      double z = (std::log10(freq) - t.logMinFreq) / t.logFreqStep;
+      if (z < 0.0) z = 0.0;
+      unsigned int k0 = static_cast<unsigned int>(z);
+      if (k0 > t.nFreq - 2) k0 = t.nFreq - 2;
+      double f = z - k0;
+      if (f > 1.0) f = 1.0;
+      *k = k0;
+      *fz = f;
+   }
+}
+
+//------------------------------------------------------------------------------
+// interpolate() -- bilinear in az/el; geometric (log-log) in frequency, which
+// is exact for the power-law frequency dependence of the simple shapes.
+//------------------------------------------------------------------------------
+double SigCompiled::interpolate(
+      const Table& t,
+      const unsigned int layer,
+      const unsigned int i0, const double fx,
+      const unsigned int j0, const double fy,
+      const unsigned int k0, const double fz)
+{
+   const unsigned int nAz = t.nAz;
+   const std::size_t planeSize = static_cast<std::size_t>(t.nEl) * nAz;
+   const std::size_t layerBase = static_cast<std::size_t>(layer) * t.nFreq * planeSize;
+   const float* p0 = &t.data[layerBase + k0 * planeSize + j0 * nAz + i0];
+
+   const double a0 = p0[0]   + (p0[1] - p0[0]) * fx;
+   const double b0 = p0[nAz] + (p0[nAz+1] - p0[nAz]) * fx;
+   const double c0 = a0 + (b0 - a0) * fy;
+   if (fz <= 0.0) return c0;
+
+   const float* p1 = p0 + planeSize;
+   const double a1 = p1[0]   + (p1[1] - p1[0]) * fx;
+   const double b1 = p1[nAz] + (p1[nAz+1] - p1[nAz]) * fx;
+   const double c1 = a1 + (b1 - a1) * fy;
+
+   if (c0 > 0.0 && c1 > 0.0) return c0 * std::pow(c1 / c0, fz);
+   return c0 + (c1 - c0) * fz;
+}
+
+//------------------------------------------------------------------------------
+// getLayer() -- Returns the table layer (i.e., ownship's camouflage type when
+// compiled from a SigSwitch)
+//------------------------------------------------------------------------------
+unsigned int SigCompiled::getLayer() const
+{
+   unsigned int layer = 0;
+   if (table != nullptr && table->isSwitch) {
+      layer = table->nLayers;   // invalid unless we find the ownship
+      const auto ownship = static_cast<const Player*>(findContainerByType(typeid(Player)));
+      if (ownship != nullptr) layer = ownship->getCamouflageType();
+   }
+   return layer;
+}
+
+//------------------------------------------------------------------------------
+// getRCS() -- Get the RCS
+//------------------------------------------------------------------------------
+double SigCompiled::getRCS(const Emission* const em)
+{
+   double rcs = 0.0;
+   if (em != nullptr) {
+      if (table != nullptr) {
+         rcs = lookup(*table, getLayer(), em->getAzimuthAoi(), em->getElevationAoi(), em->getFrequency());
+      }
+      else if (signature != nullptr) {
+         rcs = signature->getRCS(em);
+      }
+   }
+   return rcs;
+}
+
+//------------------------------------------------------------------------------
+// getRCSArray() -- Get the RCS for arrays of aspect angles and frequencies
+//------------------------------------------------------------------------------
+void SigCompiled::getRCSArray(const double az[], const double el[], const double freq[], double rcs[], const unsigned int n)
+{
+   if (table == nullptr) {
+      BaseClass::getRCSArray(az, el, freq, rcs, n);
+      return;
+   }
+   const Table& t = *table;
+
+   const unsigned int layer = getLayer();
+   if (layer >= t.nLayers) {
+      for (unsigned int i = 0; i < n; i++) rcs[i] = 0.0;
+      return;
+   }
+
+   // the frequency index is only recomputed when the frequency changes
+   double lastFreq = -1.0;
+   unsigned int k0 = 0;
+   double fz = 0.0;
+
+   for (unsigned int i = 0; i < n; i++) {
+      double x = (az[i] + base::PI) * t.invAz;
+      if (x < 0.0) x = 0.0;
+      unsigned int i0 = static_cast<unsigned int>(x);
+      if (i0 > t.nAz - 2) i0 = t.nAz - 2;
+      double fx = x - i0;
+      if (fx > 1.0) fx = 1.0;
+
+      double y = (el[i] + base::PI/2.0) * t.invEl;
+      if (y < 0.0) y = 0.0;
+      unsigned int j0 = static_cast<unsigned int>(y);
+      if (j0 > t.nEl - 2) j0 = t.nEl - 2;
+      double fy = y - j0;
+      if (fy > 1.0) fy = 1.0;
+
+      if (freq[i] != lastFreq) {
+         freqIndex(t, freq[i], &k0, &fz);
+         lastFreq = freq[i];
+      }
+
+      rcs[i] = interpolate(t, layer, i0, fx, j0, fy, k0, fz);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+
+bool SigCompiled::setSlotSignature(RfSignature* const msg)
+{
+   if (signature != nullptr) {
+      signature->container(nullptr);
+      signature->unref();
+   }
+   signature = msg;
+   if (signature != nullptr) {
+      signature->ref();
+      signature->container(this);
+   }
+   table.reset();
+   return true;
+}
+
+bool SigCompiled::setSlotAzimuthStep(const base::Angle* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double v = base::Radians::convertStatic(*msg);
+      if (v > 0.0) {
+         azStep = v;
+         table.reset();
+         ok = true;
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "SigCompiled::setSlotAzimuthStep(): ERROR, must be greater than zero!" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool SigCompiled::setSlotElevationStep(const base::Angle* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double v = base::Radians::convertStatic(*msg);
+      if (v > 0.0) {
+         elStep = v;
+         table.reset();
+         ok = true;
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "SigCompiled::setSlotElevationStep(): ERROR, must be greater than zero!" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool SigCompiled::setSlotMinFrequency(const base::Number* const msg)
+{
+   bool ok = false;
+   double x = -1.0;
+   const auto p = dynamic_cast<const base::Frequency*>(msg);
+   if (p != nullptr) x = base::Hertz::convertStatic(*p);
+   else if (msg != nullptr) x = msg->getReal();
+
+   if (x > 0.0) {
+      minFreq = x;
+      table.reset();
+      ok = true;
+   }
+   else if (isMessageEnabled(MSG_ERROR)) {
+      std::cerr << "SigCompiled::setSlotMinFrequency(): ERROR, must be greater than zero!" << std::endl;
+   }
+   return ok;
+}
+
+bool SigCompiled::setSlotMaxFrequency(const base::Number* const msg)
+{
+   bool ok = false;
+   double x = -1.0;
+   const auto p = dynamic_cast<const base::Frequency*>(msg);
+   if (p != nullptr) x = base::Hertz::convertStatic(*p);
+   else if (msg != nullptr) x = msg->getReal();
+
+   if (x > 0.0) {
+      maxFreq = x;
+      table.reset();
+      ok = true;
+   }
+   else if (isMessageEnabled(MSG_ERROR)) {
+      std::cerr << "SigCompiled::setSlotMaxFrequency(): ERROR, must be greater than zero!" << std::endl;
+   }
+   return ok;
+}
+
+bool SigCompiled::setSlotNumFrequencies(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const int v = msg->getInt();
+      if (v > 0) {
+         nFreq = static_cast<unsigned int>(v);
+         table.reset();
+         ok = true;
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "SigCompiled::setSlotNumFrequencies(): ERROR, must be greater than zero!" << std::endl;
+      }
+   }
+   return ok;
+}
+
 }
 }
@@ -15,6 +15,7 @@
 #include "openeaagles/base/util/osg_utils.hpp"
 
 #include <cmath>
+#include <cfloat>
 
 namespace oe {
 namespace models {
@@ -77,11 +78,15 @@ void Tdb::copyData(const Tdb& org, const bool)
    }
    numTgts = org.numTgts;
    usingEcefFlg = org.usingEcefFlg;
+
+   // The out of range players are rechecked by the copy
+   clearOutOfRangeList();
 }
 
 void Tdb::deleteData()
 {
    resizeArrays(0);
+   clearOutOfRangeList();
    setGimbal(nullptr);
 }
 
@@ -138,6 +143,9 @@ bool Tdb::resizeArrays(const unsigned int newSize)
          if (za  != nullptr)  { delete[] za;  za  = nullptr; }
          if (ra2 != nullptr)  { delete[] ra2; ra2 = nullptr; }
          if (ra  != nullptr)  { delete[] ra;  ra  = nullptr; }
+         if (vxa != nullptr)  { delete[] vxa; vxa = nullptr; }
+         if (vya != nullptr)  { delete[] vya; vya = nullptr; }
+         if (vza != nullptr)  { delete[] vza; vza = nullptr; }
 
          // Allocate new memory
          if (newSize > 0) {
@@ -159,6 +167,9 @@ bool Tdb::resizeArrays(const unsigned int newSize)
             za = new double[newSize];
             ra2 = new double[newSize];
             ra = new double[newSize];
+            vxa = new double[newSize];
+            vya = new double[newSize];
+            vza = new double[newSize];
          }
 
       }
@@ -168,6 +179,46 @@ bool Tdb::resizeArrays(const unsigned int newSize)
    return ok;
 }
 
+//------------------------------------------------------------------------------
+// Out of range players (by player list index)
+//------------------------------------------------------------------------------
+void Tdb::setOutOfRange(const unsigned int idx, Player* const target, const base::Vec3d& los, const double recheckTime)
+{
+   if (idx >= oorPlayers.size()) {
+      oorPlayers.resize(idx + 1, nullptr);
+      oorTimes.resize(idx + 1, 0.0);
+      oorChecked.resize(idx + 1, 0.0);
+      oorLos.resize(idx + 1);
+   }
+   if (oorPlayers[idx] != target) {
+      if (oorPlayers[idx] != nullptr) oorPlayers[idx]->unref();
+      target->ref();
+      oorPlayers[idx] = target;
+   }
+   oorTimes[idx] = recheckTime;
+   oorChecked[idx] = oorExecTime;
+   oorLos[idx] = los;
+}
+
+void Tdb::clearOutOfRange(const unsigned int idx)
+{
+   if (idx < oorPlayers.size() && oorPlayers[idx] != nullptr) {
+      oorPlayers[idx]->unref();
+      oorPlayers[idx] = nullptr;
+   }
+}
+
+void Tdb::clearOutOfRangeList()
+{
+   for (unsigned int i = 0; i < oorPlayers.size(); i++) {
+      if (oorPlayers[i] != nullptr) oorPlayers[i]->unref();
+   }
+   oorPlayers.clear();
+   oorTimes.clear();
+   oorChecked.clear();
+   oorLos.clear();
+}
+
 
 //------------------------------------------------------------------------------
 // Process players-of-interest ---  Scan the provided player list and generates
@@ -177,10 +228,16 @@ bool Tdb::resizeArrays(const unsigned int newSize)
 //------------------------------------------------------------------------------
 unsigned int Tdb::processPlayers(base::PairStream* const players)
 {
+   // Clear the previous targets (we may be reused)
+   clearArrays();
+
    // ---
    // Early out checks (no ownship, no players of interest, no target data arrays)
    // ---
-   if (gimbal == nullptr || ownship == nullptr || players == nullptr || maxTargets == 0) return 0;
+   if (gimbal == nullptr || ownship == nullptr || players == nullptr || maxTargets == 0) {
+      clearOutOfRangeList();
+      return 0;
+   }
 
    // ---
    // Terrain occulting check setup
@@ -278,10 +335,43 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
    const bool osSpaceVehicle = ownship->isMajorType(Player::SPACE_VEHICLE);
 
    // ---
-   // 1) Scan the player list ---
+   // Out of range players are only rechecked when they could have closed to
+   // within the max range (requires a max range and a max closure rate); all
+   // are rechecked if the executive time has gone backward
+   // ---
+   const double closureRate = gimbal->getMaxClosureRate2PlayersOfInterest();
+   const bool useOor = (maxRange > 0 && closureRate > 0);
+   double execTime = 0;
+   if (useOor) execTime = ownship->getWorldModel()->getExecTimeSec();
+   if (!useOor || maxRange != oorMaxRange || closureRate != oorClosureRate || usingEcefFlg != oorEcef || execTime < oorExecTime) {
+      clearOutOfRangeList();
+      oorMaxRange = maxRange;
+      oorClosureRate = closureRate;
+      oorEcef = usingEcefFlg;
+   }
+   oorExecTime = execTime;
+
+   // ---
+   // 1) Scan the player list --- gather the candidate players and their
+   // ownship to candidate LOS vectors
    // ---
+   const unsigned int nplayers = players->entries();
+   if (cTargets.size() < nplayers) {
+      cTargets.resize(nplayers);
+      cIdx.resize(nplayers);
+      cx.resize(nplayers);
+      cy.resize(nplayers);
+      cz.resize(nplayers);
+      cRanges.resize(nplayers);
+      cTanAngs.resize(nplayers);
+      cInRange.resize(nplayers);
+      cVisible.resize(nplayers);
+   }
+
+   unsigned int nc = 0;
    bool finished = false;
-   for (base::List::Item* item = players->getFirstItem(); item != nullptr && numTgts < maxTargets && !finished; item = item->getNext()) {
+   unsigned int idx = 0;
+   for (base::List::Item* item = players->getFirstItem(); item != nullptr && !finished; item = item->getNext(), idx++) {
 
       // Get the pointer to the target player
       base::Pair* pair = static_cast<base::Pair*>(item->getValue());
@@ -305,96 +395,197 @@ unsigned int Tdb::processPlayers(base::PairStream* const players)
          if (usingEcefFlg) tlos = target->getGeocPosition() - p0;
          else tlos = target->getPosition() - p0;
 
-         // Normalized and compute length: unit LOS vector and range (meters)
-         const double range = tlos.normalize();
-
-         // In-range check (only if maxRange is greater than zero)
-         bool inRange = (maxRange == 0);
-         if ( !inRange ) {
-            inRange = range <= maxRange;
+         // Skip the player if it's still clearly out of range, unless its LOS
+         // vector has changed by more than the max closure rate allows
+         if (useOor && idx < oorPlayers.size() && oorPlayers[idx] == target && execTime < oorTimes[idx]) {
+            const double maxMove = closureRate * (execTime - oorChecked[idx]);
+            if ((tlos - oorLos[idx]).length2() <= maxMove * maxMove) continue;
          }
 
-         if (inRange) {
+         cTargets[nc] = target;
+         cIdx[nc] = idx;
+         cx[nc] = tlos.x();
+         cy[nc] = tlos.y();
+         cz[nc] = tlos.z();
+         nc++;
+      }
+      else if (useOor) {
+         clearOutOfRange(idx);
+      }
+   }
 
-            // LOS vector in local tangent plane NED
-            base::Vec3d losNED = tlos;
-            if (usingEcefFlg) {
-               // LOS vector: ECEF to NED
-               losNED = wm * tlos;
-            }
+   // ---
+   // 2) Range, horizon and FOV tests, with the mode flags folded into the
+   // matrices and limits (see cullLosArray())
+   // ---
+   {
+      const base::Matrixd im;    // identity: our LOS vectors are already NED
+      cullLosArray(
+         cx.data(), cy.data(), cz.data(), nc,
+         (usingEcefFlg ? wm : im),
+         rm,
+         (maxRange == 0 ? DBL_MAX : maxRange),
+         ((usingEcefFlg && checkHorizon) ? hTanAng : DBL_MAX),
+         hDist,
+         (maxAngle == 0 ? -DBL_MAX : cosMaxFov),
+         cRanges.data(), cTanAngs.data(), cInRange.data(), cVisible.data()
+      );
+   }
 
-            // Compute the tangent of the angle from our local level to
-            // the target (positive angles are down)
-            double tanTgtAng = 999999.9; // initial tangent (down)
-            double xyRng = std::sqrt(losNED[0]*losNED[0] + losNED[1]*losNED[1]);
-            if (xyRng > 0) tanTgtAng = losNED[2]/xyRng;
-            else if (losNED[2] <= 0) tanTgtAng = -999999.9; // up
-
-            // Horizon check
-            bool aboveHorizon = true;
-            if (usingEcefFlg && checkHorizon) {
-               // We can see targets that are above the horizon or
-               // targets that are on or above the earth and are closer
-               // than the horizon
-               aboveHorizon = (tanTgtAng <= hTanAng) || (range <= hDist);
-            }
+   // Out of range players
+   if (useOor) {
+      for (unsigned int i = 0; i < nc; i++) {
+         if (cInRange[i]) clearOutOfRange(cIdx[i]);
+         else setOutOfRange(cIdx[i], cTargets[i], base::Vec3d(cx[i], cy[i], cz[i]), execTime + (cRanges[i] - maxRange) / closureRate);
+      }
+   }
+
+   // ---
+   // 3) Terrain occulting of the visible candidates
+   // ---
+   for (unsigned int i = 0; i < nc && numTgts < maxTargets; i++) {
+      if (cVisible[i]) {
+         Player* const target = cTargets[i];
+
+         // Terrain occulting if we have terrain data and we're not a space vehicle
+         bool occulted = false;
+         if (terrain != nullptr && !osSpaceVehicle) {
+
+            const double tgtLat = target->getLatitude();
+            const double tgtLon = target->getLongitude();
+            const double tgtAlt = target->getAltitudeM();
+
+            // Is the target a space vehicle?
+            if ( target->isMajorType(Player::SPACE_VEHICLE) ) {
+               // Get the true, great-circle bearing to the target
+               double tbrg(0), distNM(0);
+               base::nav::vll2bd(osLat, osLon, tgtLat, tgtLon, &tbrg, &distNM);
+
+               // Set the distance to check to 60 nm
+               double dist = 60.0 * base::distance::NM2M;
 
-            if (aboveHorizon) {
-
-               // In FOV check (only if maxAngle is greater than zero)
-               bool inFov = (maxAngle == 0);
-               if ( !inFov ) {
-                  // LOS vector: NED to gimbal coordinates
-                  const base::Vec3d losG = rm * losNED;
-                  inFov = (losG.x() >= cosMaxFov);
-               }
-
-               if (inFov) {
-
-                  // Terrain occulting if we have terrain data and we're not a space vehicle
-                  bool occulted = false;
-                  if (terrain != nullptr && !osSpaceVehicle) {
-
-                     const double tgtLat = target->getLatitude();
-                     const double tgtLon = target->getLongitude();
-                     const double tgtAlt = target->getAltitudeM();
-
-                     // Is the target a space vehicle?
-                     if ( target->isMajorType(Player::SPACE_VEHICLE) ) {
-                        // Get the true, great-circle bearing to the target
-                        double tbrg(0), distNM(0);
-                        base::nav::vll2bd(osLat, osLon, tgtLat, tgtLon, &tbrg, &distNM);
-
-                        // Set the distance to check to 60 nm
-                        double dist = 60.0 * base::distance::NM2M;
-
-                        // Terrain occulting check toward the space vehicle
-                        occulted = terrain->targetOcculting2(osLat, osLon, osAlt, tbrg, dist, -tanTgtAng);
-                     }
-                     else {
-                        // Occulting check between two standard player
-                        occulted = terrain->targetOcculting(osLat, osLon, static_cast<double>(osAlt),
-                                                            tgtLat, tgtLon, static_cast<double>(tgtAlt));
-                     }
-                  }
-
-                  if (!occulted) {
-                     // !!! All is well with this target !!!
-
-                     // Ref() and save the target pointer
-                     target->ref();
-                     targets[numTgts++] = target;
-                  }
-               }
+               // Terrain occulting check toward the space vehicle
+               occulted = terrain->targetOcculting2(osLat, osLon, osAlt, tbrg, dist, -cTanAngs[i]);
             }
+            else {
+               // Occulting check between two standard player
+               occulted = terrain->targetOcculting(osLat, osLon, static_cast<double>(osAlt),
+                                                   tgtLat, tgtLon, static_cast<double>(tgtAlt));
+            }
+         }
+
+         if (!occulted) {
+            // !!! All is well with this target !!!
+
+            // Ref() and save the target pointer
+            target->ref();
+            targets[numTgts++] = target;
          }
       }
    }
 
+   // Release the out of range players past the end of a shorter list
+   if (oorPlayers.size() > nplayers) {
+      for (unsigned int i = nplayers; i < oorPlayers.size(); i++) {
+         clearOutOfRange(i);
+      }
+      oorPlayers.resize(nplayers);
+      oorTimes.resize(nplayers);
+      oorChecked.resize(nplayers);
+      oorLos.resize(nplayers);
+   }
+
    return numTgts;
 }
 
 
+//------------------------------------------------------------------------------
+// Culling kernel --- range, horizon and FOV tests for 'n' LOS vectors.
+//
+// Same arithmetic as Vec3d::normalize() and Matrixd::postMult().  The range
+// pass is a plain loop over the arrays, and the horizon and FOV pass has no
+// branches other than selects and the in-range skip, so both loops can be
+// vectorized by the compiler.
+//------------------------------------------------------------------------------
+void Tdb::cullLosArray(
+      const double* const x, const double* const y, const double* const z,
+      const unsigned int n,
+      const base::Matrixd& wm,
+      const base::Matrixd& rm,
+      const double maxRange,
+      const double hTanAng,
+      const double hDist,
+      const double cosMaxFov,
+      double* const ranges,
+      double* const tanAngs,
+      unsigned char* const inRange,
+      unsigned char* const visible
+   )
+{
+   // LOS to NED matrix
+   const double w00 = wm(0,0), w01 = wm(0,1), w02 = wm(0,2), w03 = wm(0,3);
+   const double w10 = wm(1,0), w11 = wm(1,1), w12 = wm(1,2), w13 = wm(1,3);
+   const double w20 = wm(2,0), w21 = wm(2,1), w22 = wm(2,2), w23 = wm(2,3);
+   const double w30 = wm(3,0), w31 = wm(3,1), w32 = wm(3,2), w33 = wm(3,3);
+
+   // NED to sensor matrix (only the X row is needed)
+   const double r00 = rm(0,0), r01 = rm(0,1), r02 = rm(0,2), r03 = rm(0,3);
+   const double r30 = rm(3,0), r31 = rm(3,1), r32 = rm(3,2), r33 = rm(3,3);
+
+   // ---
+   // 1) Ranges and the in-range flags for all candidates
+   // ---
+   for (unsigned int i = 0; i < n; i++) {
+      const double rng = std::sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+      ranges[i] = rng;
+      inRange[i] = (rng <= maxRange);
+   }
+
+   // ---
+   // 2) Horizon and FOV tests for the in-range candidates
+   // ---
+   for (unsigned int i = 0; i < n; i++) {
+      if (!inRange[i]) {
+         tanAngs[i] = 0.0;
+         visible[i] = false;
+         continue;
+      }
+
+      // Normalized LOS vector
+      const double rng = ranges[i];
+      const double inv = (rng > 0.0) ? (1.0 / rng) : 1.0;
+      const double ux = x[i] * inv;
+      const double uy = y[i] * inv;
+      const double uz = z[i] * inv;
+
+      // LOS vector in local tangent plane NED
+      const double dw = 1.0 / (w30*ux + w31*uy + w32*uz + w33);
+      const double nx = (w00*ux + w01*uy + w02*uz + w03) * dw;
+      const double ny = (w10*ux + w11*uy + w12*uz + w13) * dw;
+      const double nz = (w20*ux + w21*uy + w22*uz + w23) * dw;
+
+      // Tangent of the angle from our local level to the candidate
+      // (positive angles are down; straight up or down if no x-y range)
+      const double xyRng = std::sqrt(nx*nx + ny*ny);
+      const double tanLevel = nz / ((xyRng > 0.0) ? xyRng : 1.0);
+      const double tanVert = (nz <= 0.0) ? -999999.9 : 999999.9;
+      const double tanAng = (xyRng > 0.0) ? tanLevel : tanVert;
+
+      // X component of the LOS vector in sensor coordinates
+      const double dr = 1.0 / (r30*nx + r31*ny + r32*nz + r33);
+      const double gx = (r00*nx + r01*ny + r02*nz + r03) * dr;
+
+      // We can see candidates that are within the FOV, and above the horizon
+      // or on or above the earth and closer than the horizon
+      const bool aboveHorizon = (tanAng <= hTanAng) || (rng <= hDist);
+      const bool inFov = (gx >= cosMaxFov);
+
+      tanAngs[i] = tanAng;
+      visible[i] = (aboveHorizon && inFov);
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // Compute Boresight Data --- Scan the target list, which as been pre-processed by
 // processPlayers(), and compute gimbal boresight data.
@@ -435,40 +626,57 @@ unsigned int Tdb::computeBoresightData()
          v0 = ownship->getVelocity();  // Local gaming area velocity vector (NED)
       }
 
-      for (unsigned int i = 0; i < numTgts; i++) {
-
-         // Target vectors (ECEF or local gaming area NED)
-         base::Vec3d pt;  // Position Vector
-         base::Vec3d vt;  // Velocity vector [ x y z ] (meters/second)
-         if (usingEcefFlg) {
-            // Using ECEF
-            pt = targets[i]->getGeocPosition();  // Geocentric position (ECEF)
-            vt = targets[i]->getGeocVelocity();  // Geocentric (ECEF) velocity vector [ x y z ] (meters/second)
+      // Gather the target LOS vectors (xa, ya, za) and the relative
+      // velocity vectors (vxa, vya, vza) into component arrays
+      if (usingEcefFlg) {
+         // Using ECEF
+         for (unsigned int i = 0; i < numTgts; i++) {
+            const base::Vec3d dp = targets[i]->getGeocPosition() - p0;
+            const base::Vec3d dv = targets[i]->getGeocVelocity() - v0;
+            xa[i] = dp.x();   ya[i] = dp.y();   za[i] = dp.z();
+            vxa[i] = dv.x();  vya[i] = dv.y();  vza[i] = dv.z();
          }
-         else {
-            // Using local gaming area positions
-            pt = targets[i]->getPosition();  // Local gaming area position vector (NED)
-            vt = targets[i]->getVelocity();  // Local gaming area velocity vector (NED)
+      }
+      else {
+         // Using local gaming area positions
+         for (unsigned int i = 0; i < numTgts; i++) {
+            const base::Vec3d dp = targets[i]->getPosition() - p0;
+            const base::Vec3d dv = targets[i]->getVelocity() - v0;
+            xa[i] = dp.x();   ya[i] = dp.y();   za[i] = dp.z();
+            vxa[i] = dv.x();  vya[i] = dv.y();  vza[i] = dv.z();
          }
+      }
 
-         // Target LOS vector
-         base::Vec3d los = (pt - p0);
-
-         // Normalized and compute length [unit vector and range(meters)]
-         ranges[i] = los.normalize();
+      // Ranges (meters)
+      for (unsigned int i = 0; i < numTgts; i++) {
+         ra2[i] = xa[i]*xa[i] + ya[i]*ya[i] + za[i]*za[i];
+      }
+      base::sqrtArray(ra2, ranges, numTgts);
 
-         // Computer range rate (meters/sec)
-         rngRates[i] = ( (vt - v0) * los );
+      // Normalize the LOS vectors and compute the range rates (meters/sec)
+      for (unsigned int i = 0; i < numTgts; i++) {
+         if (ranges[i] > 0.0) {
+            const double inv = 1.0 / ranges[i];
+            xa[i] *= inv;
+            ya[i] *= inv;
+            za[i] *= inv;
+         }
+         rngRates[i] = vxa[i]*xa[i] + vya[i]*ya[i] + vza[i]*za[i];
+      }
 
-         // Save the LOS vectors (own to tgt) and (tgt back to own)
-         if (usingEcefFlg) {
-            // Rotate the LOS vectors into their local tangent planes
+      // Save the LOS vectors (own to tgt) and (tgt back to own)
+      if (usingEcefFlg) {
+         // Rotate the LOS vectors into their local tangent planes
+         for (unsigned int i = 0; i < numTgts; i++) {
+            const base::Vec3d los(xa[i], ya[i], za[i]);
             losO2T[i] = wm * los;
             losT2O[i] = targets[i]->getWorldMat() * (-los);
          }
-         else {
-            losO2T[i] =  los;
-            losT2O[i] = -los;
+      }
+      else {
+         for (unsigned int i = 0; i < numTgts; i++) {
+            losO2T[i].set( xa[i],  ya[i],  za[i]);
+            losT2O[i].set(-xa[i], -ya[i], -za[i]);
          }
       }
 
@@ -2,6 +2,7 @@
 #include "openeaagles/models/Track.hpp"
 
 #include "openeaagles/models/player/Player.hpp"
+#include "openeaagles/models/WorldModel.hpp"
 #include "openeaagles/models/Emission.hpp"
 #include "openeaagles/models/IrQueryMsg.hpp"
 #include "openeaagles/models/SensorMsg.hpp"
@@ -148,6 +149,98 @@ void Track::clear()
    setTarget(nullptr);
 }
 
+//------------------------------------------------------------------------------
+// saveState() -- save the track's state; the target player by name.  The
+// last emission or query isn't saved.
+//------------------------------------------------------------------------------
+void Track::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(id);
+   cp->put(type);
+   cp->put(iffCode);
+   cp->put(trackClass);
+   cp->put(age);
+   cp->put(quality);
+
+   cp->put(latitude);
+   cp->put(longitude);
+   cp->putDoubles(los.ptr(), 3);
+   cp->putDoubles(pos.ptr(), 3);
+   cp->putDoubles(vel.ptr(), 3);
+   cp->putDoubles(accel.ptr(), 3);
+   cp->put(rng);
+   cp->put(rngRate);
+   cp->put(llValid);
+   cp->put(cErr);
+   cp->put(vErr);
+
+   cp->putDoubles(raz, 3);
+   cp->putDoubles(rel, 3);
+   cp->putDoubles(predictedRaz, 3);
+   cp->putDoubles(predictedRel, 3);
+   cp->put(gndRng);
+   cp->put(taz);
+   cp->put(aa);
+   cp->put(gndSpd);
+   cp->put(gndTrk);
+   cp->put(relGndTrk);
+
+   cp->put(shootList);
+   cp->put(wpnRel);
+   cp->put(rejected);
+
+   cp->put(osGndTrk);
+   cp->putDoubles(osVel.ptr(), 3);
+   cp->putDoubles(osAccel.ptr(), 3);
+
+   WorldModel::savePlayerName(cp, tgt);
+
+   cp->put(mslWarn);
+   cp->put(lastSN);
+   cp->put(avgSig);
+   cp->put(maxSig);
+   cp->put(nSig);
+   cp->put(iSig);
+   cp->endSection();
+}
+
+//------------------------------------------------------------------------------
+// restoreState() -- restore the track's state (see saveState()); the target
+// player is found in 'sim'
+//------------------------------------------------------------------------------
+bool Track::restoreState(base::Checkpoint::Reader* const rd, WorldModel* const sim)
+{
+   bool ok = rd->beginSection();
+   ok = ok && rd->get(&id) && rd->get(&type) && rd->get(&iffCode) && rd->get(&trackClass);
+   ok = ok && rd->get(&age) && rd->get(&quality);
+
+   ok = ok && rd->get(&latitude) && rd->get(&longitude);
+   ok = ok && rd->getDoubles(los.ptr(), 3) && rd->getDoubles(pos.ptr(), 3);
+   ok = ok && rd->getDoubles(vel.ptr(), 3) && rd->getDoubles(accel.ptr(), 3);
+   ok = ok && rd->get(&rng) && rd->get(&rngRate) && rd->get(&llValid);
+   ok = ok && rd->get(&cErr) && rd->get(&vErr);
+
+   ok = ok && rd->getDoubles(raz, 3) && rd->getDoubles(rel, 3);
+   ok = ok && rd->getDoubles(predictedRaz, 3) && rd->getDoubles(predictedRel, 3);
+   ok = ok && rd->get(&gndRng) && rd->get(&taz) && rd->get(&aa);
+   ok = ok && rd->get(&gndSpd) && rd->get(&gndTrk) && rd->get(&relGndTrk);
+
+   ok = ok && rd->get(&shootList) && rd->get(&wpnRel) && rd->get(&rejected);
+
+   ok = ok && rd->get(&osGndTrk);
+   ok = ok && rd->getDoubles(osVel.ptr(), 3) && rd->getDoubles(osAccel.ptr(), 3);
+
+   Player* p {};
+   ok = ok && sim != nullptr && sim->restorePlayerName(rd, &p);
+   if (ok) setTarget(p);
+
+   ok = ok && rd->get(&mslWarn) && rd->get(&lastSN);
+   ok = ok && rd->get(&avgSig) && rd->get(&maxSig) && rd->get(&nSig) && rd->get(&iSig);
+   ok = rd->endSection() && ok;
+   return ok;
+}
+
 
 //------------------------------------------------------------------------------
 // ownshipDynamics() -- apply ownship dynamics to predicted track position
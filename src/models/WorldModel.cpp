@@ -1,6 +1,20 @@
 
 #include "openeaagles/models/WorldModel.hpp"
 
+#include "openeaagles/models/player/Player.hpp"
+#include "openeaagles/models/player/AbstractWeapon.hpp"
+#include "openeaagles/models/player/BulletHitIndex.hpp"
+#include "openeaagles/models/dynamics/FleetDynamics.hpp"
+#include "openeaagles/models/navigation/Navigation.hpp"
+#include "openeaagles/models/system/Datalink.hpp"
+#include "openeaagles/models/system/Gimbal.hpp"
+#include "openeaagles/models/system/IrSystem.hpp"
+#include "openeaagles/models/system/Pilot.hpp"
+#include "openeaagles/models/system/Radio.hpp"
+#include "openeaagles/models/system/RfSensor.hpp"
+
+#include "openeaagles/simulation/Station.hpp"
+
 #include "openeaagles/base/EarthModel.hpp"
 #include "openeaagles/base/Identifier.hpp"
 #include "openeaagles/base/LatLon.hpp"
@@ -14,6 +28,9 @@
 #include "openeaagles/terrain/Terrain.hpp"
 
 #include <cmath>
+#include <cfloat>
+#include <string>
+#include <vector>
 
 namespace oe {
 namespace models {
@@ -36,6 +53,11 @@ BEGIN_SLOTTABLE(WorldModel)
 
    "terrain",                 //  6) Terrain elevation database
    "atmosphere",              //  7) Atmospheric model
+
+   "batchGeodeticUpdate",     //  8) Batch geodetic update of the local players (default: false)
+   "fleetDynamics",           //  9) Fleet update of the RacModel and LaeroModel players (default: false)
+   "lodDemoteRange",          // 10) Level of detail: range for demoting players to low fidelity (default: 0 -- disabled)
+   "lodPromoteRange",         // 11) Level of detail: range for promoting players to full fidelity (default: 0 -- demote range)
 END_SLOTTABLE(WorldModel)
 
 BEGIN_SLOT_MAP(WorldModel)
@@ -54,6 +76,10 @@ BEGIN_SLOT_MAP(WorldModel)
 
     ON_SLOT( 6, setSlotTerrain,      terrain::Terrain)
     ON_SLOT( 7, setSlotAtmosphere,   AbstractAtmosphere)
+    ON_SLOT( 8, setSlotBatchGeodeticUpdate, base::Number)
+    ON_SLOT( 9, setSlotFleetDynamics,       base::Number)
+    ON_SLOT(10, setSlotLodDemoteRange,      base::Distance)
+    ON_SLOT(11, setSlotLodPromoteRange,     base::Distance)
 END_SLOT_MAP()
 
 WorldModel::WorldModel()
@@ -81,6 +107,10 @@ void WorldModel::copyData(const WorldModel& org, const bool cc)
    cosRlat = org.cosRlat;
    maxRefRange = org.maxRefRange;
    gaUseEmFlg = org.gaUseEmFlg;
+   batchGeodFlg = org.batchGeodFlg;
+   setFleetDynamics(org.fleet != nullptr);
+   lodDemoteRng = org.lodDemoteRng;
+   lodPromoteRng = org.lodPromoteRng;
    wm = org.wm;
 
 
@@ -107,12 +137,27 @@ void WorldModel::deleteData()
 {
    setSlotAtmosphere( nullptr );
    setSlotTerrain( nullptr );
+   setFleetDynamics(false);
+
+   if (hitIndex != nullptr) {
+      delete hitIndex;
+      hitIndex = nullptr;
+   }
 }
 
 void WorldModel::reset()
 {
    BaseClass::reset();
 
+   // Level of detail counters (our players are reset to full fidelity)
+   lodDemotions = 0;
+   lodPromotions = 0;
+   lodLowCount = 0;
+   lodFrame = 0;
+
+   // Bullet hit candidates are collected again at the start of the next frame
+   if (hitIndex != nullptr) hitIndex->clear();
+
    // ---
    // First time reset of terrain database will load the data
    // ---
@@ -144,6 +189,275 @@ bool WorldModel::shutdownNotification()
    return true;
 }
 
+//------------------------------------------------------------------------------
+// tcPhaseStarting() -- level of detail, fleet dynamics and bullet hit
+//                     candidates at the start of the dynamics phase
+//------------------------------------------------------------------------------
+void WorldModel::tcPhaseStarting(base::PairStream* const playerList, const unsigned int phase, const double dt)
+{
+   BaseClass::tcPhaseStarting(playerList, phase, dt);
+
+   if (phase == 0) {
+      if (rateRefUsed || lodDemoteRng > 0.0) updateRateRefPositions(playerList);
+      if (lodDemoteRng > 0.0) updateLevelOfDetail(playerList);
+      if (fleet != nullptr) fleet->update(playerList, dt);
+      if (hitIndexUsed) {
+         if (hitIndex == nullptr) hitIndex = new BulletHitIndex();
+         hitIndex->update(playerList);
+      }
+   }
+}
+
+// True if the system isn't powered off
+static bool isPowered(const System* const sys)
+{
+   return (sys != nullptr && sys->getPowerSwitch() != System::PWR_OFF);
+}
+
+//------------------------------------------------------------------------------
+// isLodCandidate() -- true if the player can be demoted to a low fidelity,
+// kinematic proxy: not a weapon, with no pilot (or autopilot) or navigation
+// to steer it, and with no powered radios or datalinks.  Its sensors may
+// be powered; their emitters stay live (see Player::updateTC()).
+//------------------------------------------------------------------------------
+static bool isLodCandidate(const Player* const p)
+{
+   return !p->isMajorType(Player::WEAPON) &&
+          p->getPilot() == nullptr && p->getNavigation() == nullptr &&
+          !isPowered(p->getRadio()) && !isPowered(p->getDatalink());
+}
+
+//------------------------------------------------------------------------------
+// updateLevelOfDetail() -- demote or promote a quarter of the local players
+// using their ranges to the update rate reference positions
+//------------------------------------------------------------------------------
+void WorldModel::updateLevelOfDetail(base::PairStream* const playerList)
+{
+   static const unsigned int LOD_CHECK_FRAMES = 4;
+
+   if (playerList == nullptr) return;
+
+   const double demote2 = lodDemoteRng * lodDemoteRng;
+   const double promoteRng = (lodPromoteRng > 0.0 && lodPromoteRng < lodDemoteRng) ? lodPromoteRng : lodDemoteRng;
+   const double promote2 = promoteRng * promoteRng;
+
+   const unsigned int check = (lodFrame++ % LOD_CHECK_FRAMES);
+   unsigned int idx = 0;
+   unsigned int lowCount = 0;
+
+   base::List::Item* item = playerList->getFirstItem();
+   while (item != nullptr) {
+      const auto pair = static_cast<base::Pair*>(item->getValue());
+      const auto p = dynamic_cast<Player*>(pair->object());
+      if (p != nullptr && p->isLocalPlayer()) {
+         if ((idx++ % LOD_CHECK_FRAMES) == check) {
+            bool low = false;
+            if (p->isActive() && p != rateOwnship && isLodCandidate(p)) {
+               // Squared range to the nearest ownship or other sensor player
+               const base::Vec3d pos = p->getPosition();
+               double rng2 = DBL_MAX;
+               if (rateOwnship != nullptr) rng2 = (rateOwnshipPos - pos).length2();
+               const std::size_t n = rateSensors.size();
+               for (std::size_t i = 0; i < n; i++) {
+                  if (rateSensors[i] == p) continue;
+                  const double r2 = (rateSensorPos[i] - pos).length2();
+                  if (r2 < rng2) rng2 = r2;
+               }
+
+               // Hysteresis: demote beyond the demote range, promote within the promote range
+               low = p->isLowFidelity() ? (rng2 > promote2) : (rng2 > demote2);
+            }
+
+            if (low != p->isLowFidelity()) {
+               p->setLowFidelity(low);
+               if (low) lodDemotions++;
+               else lodPromotions++;
+            }
+         }
+         if (p->isLowFidelity()) lowCount++;
+      }
+      item = item->getNext();
+   }
+   lodLowCount = lowCount;
+}
+
+//------------------------------------------------------------------------------
+// updateRateRefPositions() -- collect the update rate reference positions: the
+// station's ownship and the active, full fidelity players with R/F sensors
+//------------------------------------------------------------------------------
+void WorldModel::updateRateRefPositions(base::PairStream* const playerList)
+{
+   rateOwnship = nullptr;
+   const simulation::Station* sta = getStation();
+   if (sta != nullptr) {
+      rateOwnship = dynamic_cast<const Player*>(sta->getOwnship());
+      if (rateOwnship != nullptr) rateOwnshipPos = rateOwnship->getPosition();
+   }
+
+   rateSensors.clear();
+   rateSensorPos.clear();
+   if (playerList != nullptr) {
+      base::List::Item* item = playerList->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         const auto p = dynamic_cast<const Player*>(pair->object());
+         if (p != nullptr && p->isActive() && !p->isLowFidelity() && p->getSensor() != nullptr) {
+            rateSensors.push_back(p);
+            rateSensorPos.push_back(p->getPosition());
+         }
+         item = item->getNext();
+      }
+   }
+   rateRefValid = true;
+}
+
+//------------------------------------------------------------------------------
+// tcPhaseCompleted() -- RF channel: move the emissions transmitted during this
+//                       phase, in player list order, to their targets' inboxes;
+//                       and after the dynamics phase, the batch geodetic update
+//------------------------------------------------------------------------------
+void WorldModel::tcPhaseCompleted(base::PairStream* const playerList, const unsigned int phase)
+{
+   BaseClass::tcPhaseCompleted(playerList, phase);
+
+   const bool geod = (batchGeodFlg && phase == 0);
+   geodPlayers.clear();
+   geodEcef.clear();
+
+   if (playerList != nullptr) {
+      base::List::Item* item = playerList->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         const auto p = dynamic_cast<Player*>(pair->object());
+         if (p != nullptr) {
+            p->rfPartitionEmissions();
+            if (geod && p->isGeodeticUpdatePending()) {
+               geodPlayers.push_back(p);
+               geodEcef.push_back(p->getGeocPosition());
+            }
+         }
+         item = item->getNext();
+      }
+   }
+
+   if (!geodPlayers.empty()) batchGeodeticUpdate();
+}
+
+//------------------------------------------------------------------------------
+// batchGeodeticUpdate() -- computes the geodetic positions, world matrices and
+// gaming area position vectors of the players in 'geodPlayers' from their ECEF
+// positions in 'geodEcef'
+//------------------------------------------------------------------------------
+void WorldModel::batchGeodeticUpdate()
+{
+   const auto n = static_cast<unsigned int>(geodPlayers.size());
+   geodLla.resize(n);
+   geodNed.resize(n);
+   geodWm.resize(n);
+   geodLat.resize(n);
+   geodLon.resize(n);
+   geodAlt.resize(n);
+
+   // Geodetic positions
+   base::nav::convertEcef2GeodArray(geodEcef.data(), geodLla.data(), n, em);
+   for (unsigned int i = 0; i < n; i++) {
+      geodLat[i] = geodLla[i][base::nav::ILAT];
+      geodLon[i] = geodLla[i][base::nav::ILON];
+      geodAlt[i] = geodLla[i][base::nav::IALT];
+   }
+
+   // World matrices
+   base::nav::computeWorldMatrixArray(geodLat.data(), geodLon.data(), geodWm.data(), n);
+
+   // Position vectors relative to the gaming area's ref point
+   if (gaUseEmFlg) {
+      base::nav::convertLL2PosVecEArray(refLat, refLon, sinRlat, cosRlat,
+            geodLat.data(), geodLon.data(), geodAlt.data(), geodNed.data(), n, em);
+   }
+   else {
+      for (unsigned int i = 0; i < n; i++) {
+         base::nav::convertLL2PosVecS(refLat, refLon, cosRlat, geodLat[i], geodLon[i], geodAlt[i], &geodNed[i]);
+      }
+   }
+
+   for (unsigned int i = 0; i < n; i++) {
+      geodPlayers[i]->batchGeodeticUpdate(geodLla[i], geodWm[i], geodNed[i]);
+   }
+   geodPlayers.clear();
+}
+
+//------------------------------------------------------------------------------
+// saveOrigin(), recreatePlayer() -- released weapons are recreated from their
+// launch vehicle's initial weapon (see AbstractWeapon::saveOrigin())
+//------------------------------------------------------------------------------
+void WorldModel::saveOrigin(const simulation::AbstractPlayer* const ip, base::Checkpoint* const cp) const
+{
+   const auto wpn = dynamic_cast<const AbstractWeapon*>(ip);
+   const bool flyout = (wpn != nullptr && wpn->isFlyoutWeapon());
+   cp->put(flyout);
+   if (flyout) wpn->saveOrigin(cp);
+}
+
+simulation::AbstractPlayer* WorldModel::recreatePlayer(base::Checkpoint::Reader* const rd)
+{
+   bool flyout {};
+   if (rd->get(&flyout) && flyout) return AbstractWeapon::recreateFlyout(this, rd);
+   return nullptr;
+}
+
+//------------------------------------------------------------------------------
+// restoreState() -- once all of the players, and their tracks, have been
+// restored, find the weapons' target tracks (see AbstractWeapon)
+//------------------------------------------------------------------------------
+bool WorldModel::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = BaseClass::restoreState(rd);
+
+   base::PairStream* playerList = getPlayers();
+   if (ok && playerList != nullptr) {
+      std::vector<const AbstractWeapon*> wpns;
+      base::List::Item* item = playerList->getFirstItem();
+      while (item != nullptr && ok) {
+         const auto p = dynamic_cast<Player*>(static_cast<base::Pair*>(item->getValue())->object());
+         if (p != nullptr && p->isLocalPlayer()) {
+            const auto wpn = dynamic_cast<AbstractWeapon*>(p);
+            if (wpn != nullptr) ok = wpn->restoreTargetTrack();
+            AbstractWeapon::getStoresWeapons(p, &wpns);
+            for (unsigned int i = 0; i < wpns.size() && ok; i++) {
+               ok = const_cast<AbstractWeapon*>(wpns[i])->restoreTargetTrack();
+            }
+         }
+         item = item->getNext();
+      }
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "WorldModel::restoreState(): ERROR, weapon target track not found" << std::endl;
+      }
+   }
+   if (playerList != nullptr) playerList->unref();
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// savePlayerName(), restorePlayerName() -- checkpoint references to players,
+// by name; restorePlayerName() fails if the player isn't found
+//------------------------------------------------------------------------------
+void WorldModel::savePlayerName(base::Checkpoint* const cp, const Player* const p)
+{
+   cp->putString( (p != nullptr && p->getName() != nullptr) ? p->getName()->getString() : "" );
+}
+
+bool WorldModel::restorePlayerName(base::Checkpoint::Reader* const rd, Player** const p)
+{
+   std::string name;
+   bool ok = rd->getString(&name);
+   *p = nullptr;
+   if (ok && !name.empty()) {
+      *p = dynamic_cast<Player*>(findPlayerByName(name.c_str()));
+      ok = (*p != nullptr);
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // Get functions
 //------------------------------------------------------------------------------
@@ -160,6 +474,84 @@ bool WorldModel::isGamingAreaUsingEarthModel() const
    return gaUseEmFlg;
 }
 
+// Geodetic positions updated in a batch at the end of the dynamics phase?
+bool WorldModel::isBatchGeodeticUpdate() const
+{
+   return batchGeodFlg;
+}
+
+// RacModel and LaeroModel players updated as a fleet?
+bool WorldModel::isFleetDynamics() const
+{
+   return (fleet != nullptr);
+}
+
+// Level of detail demote range (meters), or zero if disabled
+double WorldModel::getLodDemoteRange() const
+{
+   return lodDemoteRng;
+}
+
+// Level of detail promote range (meters)
+double WorldModel::getLodPromoteRange() const
+{
+   return (lodPromoteRng > 0.0 && lodPromoteRng < lodDemoteRng) ? lodPromoteRng : lodDemoteRng;
+}
+
+// Number of players demoted since reset
+unsigned int WorldModel::getLodDemotions() const
+{
+   return lodDemotions;
+}
+
+// Number of players promoted since reset
+unsigned int WorldModel::getLodPromotions() const
+{
+   return lodPromotions;
+}
+
+// Number of low fidelity players
+unsigned int WorldModel::getNumLowFidelityPlayers() const
+{
+   return lodLowCount;
+}
+
+// Range from player 'p' to the station's ownship, or to the nearest other
+// active player with an R/F sensor, at the start of the frame
+double WorldModel::getRateRefRange(const Player* const p, const bool sensors)
+{
+   rateRefUsed = true;
+   if (!rateRefValid || p == nullptr) return 0.0;
+
+   double rng = 0.0;
+   if (!sensors) {
+      if (rateOwnship != nullptr && rateOwnship != p) {
+         rng = (rateOwnshipPos - p->getPosition()).length();
+      }
+   }
+   else {
+      // Nearest other sensor player; if there aren't any, then there's no one to see us
+      double rng2 = -1.0;
+      const base::Vec3d pos = p->getPosition();
+      const std::size_t n = rateSensors.size();
+      for (std::size_t i = 0; i < n; i++) {
+         if (rateSensors[i] != p) {
+            const double r2 = (rateSensorPos[i] - pos).length2();
+            if (rng2 < 0.0 || r2 < rng2) rng2 = r2;
+         }
+      }
+      rng = (rng2 >= 0.0) ? std::sqrt(rng2) : DBL_MAX;
+   }
+   return rng;
+}
+
+// Shared bullet hit candidates
+const BulletHitIndex* WorldModel::getBulletHitIndex()
+{
+   hitIndexUsed = true;
+   return hitIndex;
+}
+
 // Returns the reference latitude
 double WorldModel::getRefLatitude() const
 {
@@ -220,6 +612,38 @@ bool WorldModel::setGamingAreaUseEarthModel(const bool flg)
    return true;
 }
 
+bool WorldModel::setBatchGeodeticUpdate(const bool flg)
+{
+   batchGeodFlg = flg;
+   return true;
+}
+
+bool WorldModel::setLodDemoteRange(const double m)
+{
+   bool ok = (m >= 0.0);
+   if (ok) lodDemoteRng = m;
+   return ok;
+}
+
+bool WorldModel::setLodPromoteRange(const double m)
+{
+   bool ok = (m >= 0.0);
+   if (ok) lodPromoteRng = m;
+   return ok;
+}
+
+bool WorldModel::setFleetDynamics(const bool flg)
+{
+   if (flg && fleet == nullptr) {
+      fleet = new FleetDynamics();
+   }
+   else if (!flg && fleet != nullptr) {
+      delete fleet;
+      fleet = nullptr;
+   }
+   return true;
+}
+
 // Sets Ref latitude
 bool WorldModel::setRefLatitude(const double v)
 {
@@ -339,6 +763,42 @@ bool WorldModel::setSlotGamingAreaEarthModel(const base::Number* const msg)
    return ok;
 }
 
+bool WorldModel::setSlotBatchGeodeticUpdate(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setBatchGeodeticUpdate(msg->getBoolean());
+   }
+   return ok;
+}
+
+bool WorldModel::setSlotFleetDynamics(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setFleetDynamics(msg->getBoolean());
+   }
+   return ok;
+}
+
+bool WorldModel::setSlotLodDemoteRange(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setLodDemoteRange( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool WorldModel::setSlotLodPromoteRange(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setLodPromoteRange( base::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
 std::ostream& WorldModel::serialize(std::ostream& sout, const int i, const bool slotsOnly) const
 {
     int j = 0;
@@ -0,0 +1,381 @@
+
+#include "openeaagles/models/dynamics/FleetDynamics.hpp"
+
+#include "openeaagles/models/dynamics/RacModel.hpp"
+#include "openeaagles/models/dynamics/LaeroModel.hpp"
+#include "openeaagles/models/player/Player.hpp"
+
+#include "openeaagles/base/PairStream.hpp"
+#include "openeaagles/base/Pair.hpp"
+
+#include "openeaagles/base/units/angle_utils.hpp"
+#include "openeaagles/base/units/distance_utils.hpp"
+#include "openeaagles/base/util/constants.hpp"
+#include "openeaagles/base/util/math_utils.hpp"
+
+#include <typeinfo>
+#include <cmath>
+
+namespace oe {
+namespace models {
+
+//------------------------------------------------------------------------------
+// update() -- collect the fleet's players, step the groups and write the new
+//             states back to the players and their models
+//------------------------------------------------------------------------------
+void FleetDynamics::update(base::PairStream* const playerList, const double dt)
+{
+   collect(playerList, dt);
+   if (!rac.plr.empty()) updateRacGroup();
+   if (!laero.plr.empty()) updateLaeroGroup();
+}
+
+//------------------------------------------------------------------------------
+// collect() -- copies the states of the active, local RacModel and LaeroModel
+//              players into the groups
+//------------------------------------------------------------------------------
+void FleetDynamics::collect(base::PairStream* const playerList, const double dt)
+{
+   rac.clear();
+   laero.clear();
+   if (playerList == nullptr) return;
+
+   base::List::Item* item = playerList->getFirstItem();
+   while (item != nullptr) {
+      const auto pair = static_cast<base::Pair*>(item->getValue());
+      const auto p = dynamic_cast<Player*>(pair->object());
+      if (p != nullptr && p->isLocalPlayer() && p->isActive() && !p->isLowFidelity() && p->getDynamicsModel() != nullptr) {
+
+         // Same delta time as Player::updateTC() passes to the model
+         double dt4 = dt * 4.0f;
+         if (p->isFrozen()) dt4 = 0.0;
+
+         DynamicsModel* const dm = p->getDynamicsModel();
+         if (typeid(*dm) == typeid(RacModel)) {
+            const auto m = static_cast<RacModel*>(dm);
+
+            // Set default commanded values
+            if (m->cmdAltitude < -9000.0) m->cmdAltitude = p->getAltitudeM();
+            if (m->cmdHeading < -9000.0) m->cmdHeading = p->getHeadingD();
+            if (m->cmdVelocity < -9000.0) m->cmdVelocity = p->getTotalVelocityKts();
+
+            const base::Vec3d& oldRates = p->getAngularVelocities();
+            rac.plr.push_back(p);
+            rac.mdl.push_back(m);
+            rac.dt.push_back(dt4);
+            rac.alt.push_back(p->getAltitudeM());
+            rac.vt.push_back(p->getTotalVelocity());
+            rac.phi.push_back(p->getRollR());
+            rac.tht.push_back(p->getPitchR());
+            rac.psi.push_back(p->getHeadingR());
+            rac.qa1.push_back(oldRates[Player::IPITCH]);
+            rac.ra1.push_back(oldRates[Player::IYAW]);
+            rac.dmg.push_back(p->getDamage());
+            rac.vpMin.push_back(m->vpMin);
+            rac.vpMaxG.push_back(m->vpMaxG);
+            rac.gMax.push_back(m->gMax);
+            rac.maxAccel.push_back(m->maxAccel);
+            rac.cmdAlt.push_back(m->cmdAltitude);
+            rac.cmdHdg.push_back(m->cmdHeading * base::angle::D2RCC);
+            rac.cmdVel.push_back(m->cmdVelocity * (base::distance::NM2M / 3600.0));
+         }
+         else if (typeid(*dm) == typeid(LaeroModel)) {
+            const auto m = static_cast<LaeroModel*>(dm);
+            laero.plr.push_back(p);
+            laero.mdl.push_back(m);
+            laero.dt.push_back(m->dT);
+            laero.phi.push_back(m->phi);
+            laero.tht.push_back(m->tht);
+            laero.psi.push_back(m->psi);
+            laero.phiDot.push_back(m->phiDot);
+            laero.thtDot.push_back(m->thtDot);
+            laero.psiDot.push_back(m->psiDot);
+            laero.phiDot1.push_back(m->phiDot1);
+            laero.thtDot1.push_back(m->thtDot1);
+            laero.psiDot1.push_back(m->psiDot1);
+            laero.u.push_back(m->u);
+            laero.v.push_back(m->v);
+            laero.w.push_back(m->w);
+            laero.uDot.push_back(m->uDot);
+            laero.vDot.push_back(m->vDot);
+            laero.wDot.push_back(m->wDot);
+            laero.uDot1.push_back(m->uDot1);
+            laero.vDot1.push_back(m->vDot1);
+            laero.wDot1.push_back(m->wDot1);
+         }
+      }
+      item = item->getNext();
+   }
+}
+
+//------------------------------------------------------------------------------
+// updateRacGroup() -- RacModel::updateRAC() for the whole group
+//------------------------------------------------------------------------------
+void FleetDynamics::updateRacGroup()
+{
+   const auto n = static_cast<unsigned int>(rac.plr.size());
+   rac.resize(n);
+
+   // Acceleration of Gravity (M/S)
+   const double g = base::ETHG * base::distance::FT2M;
+
+   // Max altitude rate 6000 ft /min converted to M/S
+   const double maxAltRate = (3000.0 / 60.0) * base::distance::FT2M;
+
+   for (unsigned int i = 0; i < n; i++) {
+      const double vt = rac.vt[i];
+
+      // Commanded vertical velocity and flight path angle
+      double cmdAltRate = (rac.cmdAlt[i] - rac.alt[i]);
+      if (cmdAltRate > maxAltRate) cmdAltRate = maxAltRate;
+      else if (cmdAltRate < -maxAltRate) cmdAltRate = -maxAltRate;
+
+      double cmdPitch = 0;
+      if (vt > 0) cmdPitch = std::asin( cmdAltRate/vt );
+
+      // Max G, max turn rate and max/min pitch rates
+      double gmax = rac.gMax[i];
+      if (vt < rac.vpMaxG[i]) {
+         gmax = 1.0f + (rac.gMax[i] - 1.0f) * (vt - rac.vpMin[i]) / (rac.vpMaxG[i] - rac.vpMin[i]);
+      }
+      const double ra_max = gmax * g / vt;
+      const double qa_max = ra_max;
+      double qa_min = -qa_max;
+      if (gmax > 2.0) qa_min = -( 2.0f * g / vt);
+
+      // Pitch and turn rates
+      double qa = base::angle::aepcdRad(cmdPitch - rac.tht[i]) * 0.1;
+      if (qa > qa_max) qa = qa_max;
+      if (qa < qa_min) qa = qa_min;
+
+      double ra = base::angle::aepcdRad(rac.cmdHdg[i] - rac.psi[i]) * 0.1;
+      if (ra > ra_max) ra = ra_max;
+      if (ra < -ra_max) ra = -ra_max;
+
+      // Damage
+      const double dd = rac.dmg[i];
+      if (dd > 0.5) {
+         ra += (dd - 0.5) * ra_max;
+         qa -= (dd - 0.5) * qa_max;
+      }
+
+      // Integrate pitch and heading
+      const double dt = rac.dt[i];
+      rac.newTht[i] = rac.tht[i] + (qa + rac.qa1[i]) * dt / 2.0;
+
+      double newPsi = rac.psi[i] + (ra + rac.ra1[i]) * dt / 2.0;
+      if (newPsi > 2.0 * base::PI) newPsi -= 2.0 * base::PI;
+      if (newPsi < 0.0) newPsi += 2.0 * base::PI;
+      rac.newPsi[i] = newPsi;
+
+      // Roll angle is proportional to max turn rate - filtered
+      rac.newPhi[i] = 0.98 * rac.phi[i] + 0.02 * (ra / ra_max * (base::angle::D2RCC * 60.0));
+
+      // Acceleration and new velocity
+      double vpdot = (rac.cmdVel[i] - vt) * 0.05;
+      if (vpdot > rac.maxAccel[i])  vpdot = rac.maxAccel[i];
+      if (vpdot < -rac.maxAccel[i]) vpdot = -rac.maxAccel[i];
+
+      rac.vp[i] = vt + vpdot * dt;
+      rac.vpdot[i] = vpdot;
+      rac.qa[i] = qa;
+      rac.ra[i] = ra;
+   }
+
+   // Write back
+   for (unsigned int i = 0; i < n; i++) {
+      Player* const p = rac.plr[i];
+      p->setEulerAngles(rac.newPhi[i], rac.newTht[i], rac.newPsi[i]);
+      p->setAngularVelocities(0.0, rac.qa[i], rac.ra[i]);
+      p->setVelocityBody(rac.vp[i], 0.0, 0.0);
+      p->setAccelerationBody(rac.vpdot[i], 0.0, 0.0);
+      rac.mdl[i]->fleetUpdated = true;
+   }
+}
+
+//------------------------------------------------------------------------------
+// updateLaeroGroup() -- LaeroModel::update4DofModel() for the whole group
+//------------------------------------------------------------------------------
+void FleetDynamics::updateLaeroGroup()
+{
+   const auto n = static_cast<unsigned int>(laero.plr.size());
+   laero.resize(n);
+
+   const double HALF_PI = base::PI / 2.0;
+   const double EPSILON = 1.0E-10;
+
+   // Integrate Euler angles and body velocities using Adams-Bashforth
+   for (unsigned int i = 0; i < n; i++) {
+      const double dT = laero.dt[i];
+
+      double phi = laero.phi[i] + 0.5 * (3.0 * laero.phiDot[i] - laero.phiDot1[i]) * dT;
+      if (phi >  base::PI) phi = -base::PI;
+      if (phi < -base::PI) phi =  base::PI;
+      laero.phi[i] = phi;
+
+      double tht = laero.tht[i] + 0.5 * (3.0 * laero.thtDot[i] - laero.thtDot1[i]) * dT;
+      if (tht >=  HALF_PI) tht =  (HALF_PI - EPSILON);
+      if (tht <= -HALF_PI) tht = -(HALF_PI - EPSILON);
+      laero.tht[i] = tht;
+
+      double psi = laero.psi[i] + 0.5 * (3.0 * laero.psiDot[i] - laero.psiDot1[i]) * dT;
+      if (psi >  base::PI) psi = -base::PI;
+      if (psi < -base::PI) psi =  base::PI;
+      laero.psi[i] = psi;
+
+      laero.u[i] += 0.5 * (3.0 * laero.uDot[i] - laero.uDot1[i]) * dT;
+      laero.v[i] += 0.5 * (3.0 * laero.vDot[i] - laero.vDot1[i]) * dT;
+      laero.w[i] += 0.5 * (3.0 * laero.wDot[i] - laero.wDot1[i]) * dT;
+   }
+
+   // Sines and cosines of the Euler angles
+   base::sinCosArray(laero.phi.data(), laero.sinPhi.data(), laero.cosPhi.data(), n);
+   base::sinCosArray(laero.tht.data(), laero.sinTht.data(), laero.cosTht.data(), n);
+   base::sinCosArray(laero.psi.data(), laero.sinPsi.data(), laero.cosPsi.data(), n);
+
+   // Body angular velocities and NED velocities
+   for (unsigned int i = 0; i < n; i++) {
+      const double sinPhi = laero.sinPhi[i];
+      const double cosPhi = laero.cosPhi[i];
+      const double sinTht = laero.sinTht[i];
+      const double cosTht = laero.cosTht[i];
+      const double sinPsi = laero.sinPsi[i];
+      const double cosPsi = laero.cosPsi[i];
+
+      // local to body axes matrix
+      const double l1 =  cosTht * cosPsi;
+      const double l2 =  cosTht * sinPsi;
+      const double l3 = -sinTht;
+      const double m1 =  sinPhi * sinTht * cosPsi - cosPhi * sinPsi;
+      const double m2 =  sinPhi * sinTht * sinPsi + cosPhi * cosPsi;
+      const double m3 =  sinPhi * cosTht;
+      const double n1 =  cosPhi * sinTht * cosPsi + sinPhi * sinPsi;
+      const double n2 =  cosPhi * sinTht * sinPsi - sinPhi * cosPsi;
+      const double n3 =  cosPhi * cosTht;
+
+      const double phiDot = laero.phiDot[i];
+      const double thtDot = laero.thtDot[i];
+      const double psiDot = laero.psiDot[i];
+      laero.p[i] = phiDot                    +       (-sinTht)*psiDot;
+      laero.q[i] =           (cosPhi)*thtDot + (cosTht*sinPhi)*psiDot;
+      laero.r[i] =          (-sinPhi)*thtDot + (cosTht*cosPhi)*psiDot;
+
+      const double u = laero.u[i];
+      const double v = laero.v[i];
+      const double w = laero.w[i];
+      laero.velN[i] = l1*u + m1*v + n1*w;
+      laero.velE[i] = l2*u + m2*v + n2*w;
+      laero.velD[i] = l3*u + m3*v + n3*w;
+   }
+
+   // Write back
+   for (unsigned int i = 0; i < n; i++) {
+      LaeroModel* const m = laero.mdl[i];
+      m->phi = laero.phi[i];
+      m->tht = laero.tht[i];
+      m->psi = laero.psi[i];
+      m->phiDot1 = laero.phiDot[i];
+      m->thtDot1 = laero.thtDot[i];
+      m->psiDot1 = laero.psiDot[i];
+      m->p = laero.p[i];
+      m->q = laero.q[i];
+      m->r = laero.r[i];
+      m->u = laero.u[i];
+      m->v = laero.v[i];
+      m->w = laero.w[i];
+      m->uDot1 = laero.uDot[i];
+      m->vDot1 = laero.vDot[i];
+      m->wDot1 = laero.wDot[i];
+      m->velN = laero.velN[i];
+      m->velE = laero.velE[i];
+      m->velD = laero.velD[i];
+      m->fleetUpdated = true;
+
+      Player* const p = laero.plr[i];
+      p->setEulerAngles(m->phi, m->tht, m->psi);
+      p->setAngularVelocities(m->p, m->q, m->r);
+      p->setVelocity(m->velN, m->velE, m->velD);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Group arrays
+//------------------------------------------------------------------------------
+void FleetDynamics::RacGroup::clear()
+{
+   plr.clear();
+   mdl.clear();
+   dt.clear();
+   alt.clear();
+   vt.clear();
+   phi.clear();
+   tht.clear();
+   psi.clear();
+   qa1.clear();
+   ra1.clear();
+   dmg.clear();
+   vpMin.clear();
+   vpMaxG.clear();
+   gMax.clear();
+   maxAccel.clear();
+   cmdAlt.clear();
+   cmdHdg.clear();
+   cmdVel.clear();
+}
+
+// Sizes the result arrays
+void FleetDynamics::RacGroup::resize(const unsigned int n)
+{
+   newPhi.resize(n);
+   newTht.resize(n);
+   newPsi.resize(n);
+   qa.resize(n);
+   ra.resize(n);
+   vp.resize(n);
+   vpdot.resize(n);
+}
+
+void FleetDynamics::LaeroGroup::clear()
+{
+   plr.clear();
+   mdl.clear();
+   dt.clear();
+   phi.clear();
+   tht.clear();
+   psi.clear();
+   phiDot.clear();
+   thtDot.clear();
+   psiDot.clear();
+   phiDot1.clear();
+   thtDot1.clear();
+   psiDot1.clear();
+   u.clear();
+   v.clear();
+   w.clear();
+   uDot.clear();
+   vDot.clear();
+   wDot.clear();
+   uDot1.clear();
+   vDot1.clear();
+   wDot1.clear();
+}
+
+// Sizes the work and result arrays
+void FleetDynamics::LaeroGroup::resize(const unsigned int n)
+{
+   sinPhi.resize(n);
+   cosPhi.resize(n);
+   sinTht.resize(n);
+   cosTht.resize(n);
+   sinPsi.resize(n);
+   cosPsi.resize(n);
+   p.resize(n);
+   q.resize(n);
+   r.resize(n);
+   velN.resize(n);
+   velE.resize(n);
+   velD.resize(n);
+}
+
+}
+}
@@ -92,7 +92,9 @@ void LaeroModel::copyData(const LaeroModel& org, const bool)
 //------------------------------------------------------------------------------
 void LaeroModel::dynamics(const double dt)
 {
-    update4DofModel(dt);
+    // Already updated with the rest of the fleet?
+    if (fleetUpdated) fleetUpdated = false;
+    else update4DofModel(dt);
     dT = dt;
 }
 
@@ -102,6 +104,7 @@ void LaeroModel::dynamics(const double dt)
 void LaeroModel::reset()
 {
    BaseClass::reset();
+   fleetUpdated = false;
 
    const auto pPlr = static_cast<Player*>( findContainerByType(typeid(Player)) );
    if (pPlr != nullptr) {
@@ -110,6 +113,39 @@ void LaeroModel::reset()
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- the state of the equations of motion
+//------------------------------------------------------------------------------
+void LaeroModel::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(dT); cp->put(p); cp->put(q); cp->put(r); cp->put(pDot); cp->put(qDot);
+   cp->put(rDot); cp->put(phi); cp->put(tht); cp->put(psi); cp->put(phiDot); cp->put(thtDot);
+   cp->put(psiDot); cp->put(u); cp->put(v); cp->put(w); cp->put(uDot); cp->put(vDot);
+   cp->put(wDot); cp->put(refPosN); cp->put(refPosE); cp->put(refPosD); cp->put(posN); cp->put(posE);
+   cp->put(posD); cp->put(velN); cp->put(velE); cp->put(velD); cp->put(accN); cp->put(accE);
+   cp->put(accD); cp->put(phiDot1); cp->put(thtDot1); cp->put(psiDot1); cp->put(uDot1); cp->put(vDot1);
+   cp->put(wDot1);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool LaeroModel::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection()
+      && rd->get(&dT) && rd->get(&p) && rd->get(&q) && rd->get(&r) && rd->get(&pDot) && rd->get(&qDot)
+      && rd->get(&rDot) && rd->get(&phi) && rd->get(&tht) && rd->get(&psi) && rd->get(&phiDot) && rd->get(&thtDot)
+      && rd->get(&psiDot) && rd->get(&u) && rd->get(&v) && rd->get(&w) && rd->get(&uDot) && rd->get(&vDot)
+      && rd->get(&wDot) && rd->get(&refPosN) && rd->get(&refPosE) && rd->get(&refPosD) && rd->get(&posN) && rd->get(&posE)
+      && rd->get(&posD) && rd->get(&velN) && rd->get(&velE) && rd->get(&velD) && rd->get(&accN) && rd->get(&accE)
+      && rd->get(&accD) && rd->get(&phiDot1) && rd->get(&thtDot1) && rd->get(&psiDot1) && rd->get(&uDot1) && rd->get(&vDot1)
+      && rd->get(&wDot1);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //----------------------------------------------------------
 // update4DofModel -- update equations of motion
 //----------------------------------------------------------
@@ -63,6 +63,29 @@ EMPTY_DELETEDATA(RacModel)
 void RacModel::reset()
 {
    BaseClass::reset();
+   fleetUpdated = false;
+}
+
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- the commanded altitude, heading and velocity
+//------------------------------------------------------------------------------
+void RacModel::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(cmdAltitude);
+   cp->put(cmdHeading);
+   cp->put(cmdVelocity);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool RacModel::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&cmdAltitude) && rd->get(&cmdHeading) && rd->get(&cmdVelocity);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
 }
 
 //------------------------------------------------------------------------------
@@ -70,7 +93,9 @@ void RacModel::reset()
 //------------------------------------------------------------------------------
 void RacModel::dynamics(const double dt)
 {
-    updateRAC(dt);
+    // Already updated with the rest of the fleet?
+    if (fleetUpdated) fleetUpdated = false;
+    else updateRAC(dt);
 }
 
 //------------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 #include "openeaagles/models/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 // dynamics models
 #include "openeaagles/models/dynamics/JSBSimModel.hpp"
@@ -64,6 +65,7 @@
 #include "openeaagles/models/system/OnboardComputer.hpp"
 #include "openeaagles/models/system/Pilot.hpp"
 #include "openeaagles/models/system/Radar.hpp"
+#include "openeaagles/models/system/RadarClutter.hpp"
 #include "openeaagles/models/system/Radio.hpp"
 #include "openeaagles/models/system/RfSensor.hpp"
 #include "openeaagles/models/system/Rwr.hpp"
@@ -96,349 +98,158 @@ namespace models {
 
 base::Object* factory(const std::string& name)
 {
-   base::Object* obj = nullptr;
-
-   // dynamics models
-   if ( name == RacModel::getFactoryName() ) {              // RAC
-      obj = new RacModel();
-   }
-   else if ( name == JSBSimModel::getFactoryName() ) {      // JSBSim
-      obj = new JSBSimModel();
-   }
-   else if ( name == LaeroModel::getFactoryName() ) {       // Laero
-      obj = new LaeroModel();
-   }
-
-   // environment
-   else if ( name == IrAtmosphere::getFactoryName() ) {
-      obj = new IrAtmosphere;
-   }
-   else if ( name == IrAtmosphere1::getFactoryName() ) {
-      obj = new IrAtmosphere1;
-   }
-
-   // sensor models
-   if ( name == Gmti::getFactoryName() ) {
-      obj = new Gmti();
-   }
-   else if ( name == Stt::getFactoryName() ) {
-      obj = new Stt();
-   }
-   else if ( name == Tws::getFactoryName() ) {
-      obj = new Tws();
-   }
-
-   // world models
-   else if ( name == WorldModel::getFactoryName() ) {
-      obj = new WorldModel();
-   }
-   
-   // Players
-   else if ( name == Player::getFactoryName() ) {
-      obj = new Player();
-   }
-   else if ( name == AirVehicle::getFactoryName() ) {
-      obj = new AirVehicle();
-   }
-   else if ( name == Building::getFactoryName() ) {
-      obj = new Building();
-   }
-   else if ( name == GroundVehicle::getFactoryName() ) {
-      obj = new GroundVehicle();
-   }
-   else if ( name == LifeForm::getFactoryName() ) {
-      obj = new LifeForm();
-   }
-   else if ( name == Ship::getFactoryName() ) {
-      obj = new Ship();
-   }
-   else if ( name == SpaceVehicle::getFactoryName() ) {
-      obj = new SpaceVehicle();
-   }
-
-   // Air Vehicles
-   else if ( name == Aircraft::getFactoryName() ) {
-      obj = new Aircraft();
-   }
-   else if ( name == Helicopter::getFactoryName() ) {
-      obj = new Helicopter();
-   }
-   else if ( name == UnmannedAirVehicle::getFactoryName() ) {
-      obj = new UnmannedAirVehicle();
-   }
-
-   // Ground Vehicles
-   else if ( name == Tank::getFactoryName() ) {
-      obj = new Tank();
-   }
-   else if ( name == ArmoredVehicle::getFactoryName() ) {
-      obj = new ArmoredVehicle();
-   }
-   else if ( name == WheeledVehicle::getFactoryName() ) {
-      obj = new WheeledVehicle();
-   }
-   else if ( name == Artillery::getFactoryName() ) {
-      obj = new Artillery();
-   }
-   else if ( name == SamVehicle::getFactoryName() ) {
-      obj = new SamVehicle();
-   }
-   else if ( name == GroundStation::getFactoryName() ) {
-      obj = new GroundStation();
-   }
-   else if ( name == GroundStationRadar::getFactoryName() ) {
-      obj = new GroundStationRadar();
-   }
-   else if ( name == GroundStationUav::getFactoryName() ) {
-      obj = new GroundStationUav();
-   }
-
-   // Space Vehicles
-   else if ( name == MannedSpaceVehicle::getFactoryName() ) {
-      obj = new MannedSpaceVehicle();
-   }
-   else if ( name == UnmannedSpaceVehicle::getFactoryName() ) {
-      obj = new UnmannedSpaceVehicle();
-   }
-   else if ( name == BoosterSpaceVehicle::getFactoryName() ) {
-      obj = new BoosterSpaceVehicle();
-   }
-
-   // System
-   else if ( name == System::getFactoryName() ) {
-      obj = new System();
-   }
-   else if ( name == AvionicsPod::getFactoryName() ) {
-      obj = new AvionicsPod();
-   }
-
-   // Basic Pilot types
-   else if ( name == Pilot::getFactoryName() ) {
-      obj = new Pilot();
-   }
-   else if ( name == Autopilot::getFactoryName() ) {
-      obj = new Autopilot();
-   }
-
-   // Navigation types
-   else if ( name == Navigation::getFactoryName() ) {
-      obj = new Navigation();
-   }
-   else if ( name == Ins::getFactoryName() ) {
-      obj = new Ins();
-   }
-   else if ( name == Gps::getFactoryName() ) {
-      obj = new Gps();
-   }
-   else if ( name == Route::getFactoryName() ) {
-      obj = new Route();
-   }
-   else if ( name == Steerpoint::getFactoryName() ) {
-      obj = new Steerpoint();
-   }
-
-   // Target Data
-   else if ( name == TargetData::getFactoryName() ) {
-      obj = new TargetData();
-   }
-
-   // Bullseye
-   else if ( name == Bullseye::getFactoryName() ) {
-      obj = new Bullseye();
-   }
-
-   // Actions
-   else if ( name == ActionImagingSar::getFactoryName() ) {
-      obj = new ActionImagingSar();
-   }
-   else if ( name == ActionWeaponRelease::getFactoryName() ) {
-      obj = new ActionWeaponRelease();
-   }
-   else if ( name == ActionDecoyRelease::getFactoryName() ) {
-      obj = new ActionDecoyRelease();
-   }
-   else if ( name == ActionCamouflageType::getFactoryName() ) {
-      obj = new ActionCamouflageType();
-   }
-
-   // Bombs and Missiles
-   else if ( name == Bomb::getFactoryName() ) {
-      obj = new Bomb();
-   }
-   else if ( name == Missile::getFactoryName() ) {
-      obj = new Missile();
-   }
-   else if ( name == Aam::getFactoryName() ) {
-      obj = new Aam();
-   }
-   else if ( name == Agm::getFactoryName() ) {
-      obj = new Agm();
-   }
-   else if ( name == Sam::getFactoryName() ) {
-      obj = new Sam();
-   }
-
-   // Effects
-   else if ( name == Chaff::getFactoryName() ) {
-      obj = new Chaff();
-   }
-   else if ( name == Decoy::getFactoryName() ) {
-      obj = new Decoy();
-   }
-   else if ( name == Flare::getFactoryName() ) {
-      obj = new Flare();
-   }
-
-   // Stores, stores manager and external stores (FuelTank, Gun & Bullets (used by the Gun))
-   else if ( name == Stores::getFactoryName() ) {
-      obj = new Stores();
-   }
-   else if ( name == SimpleStoresMgr::getFactoryName() ) {
-      obj = new SimpleStoresMgr();
-   }
-   else if ( name == FuelTank::getFactoryName() ) {
-      obj = new FuelTank();
-   }
-   else if ( name == Gun::getFactoryName() ) {
-      obj = new Gun();
-   }
-   else if ( name == Bullet::getFactoryName() ) {
-      obj = new Bullet();
-   }
-
-   // Data links
-   else if ( name == Datalink::getFactoryName() ) {
-      obj = new Datalink();
-   }
-
-   // Gimbals, Antennas and Optics
-   else if ( name == Gimbal::getFactoryName() ) {
-      obj = new Gimbal();
-   }
-   else if ( name == ScanGimbal::getFactoryName() ) {
-      obj = new ScanGimbal();
-   }
-   else if ( name == StabilizingGimbal::getFactoryName() ) {
-      obj = new StabilizingGimbal();
-   }
-   else if ( name == Antenna::getFactoryName() ) {
-      obj = new Antenna();
-   }
-   else if ( name == IrSeeker::getFactoryName() ) {
-      obj = new IrSeeker();
-   }
-
-   // R/F Signatures
-   else if ( name == SigConstant::getFactoryName() ) {
-      obj = new SigConstant();
-   }
-   else if ( name == SigSphere::getFactoryName() ) {
-      obj = new SigSphere();
-   }
-   else if ( name == SigPlate::getFactoryName() ) {
-      obj = new SigPlate();
-   }
-   else if ( name == SigDihedralCR::getFactoryName() ) {
-      obj = new SigDihedralCR();
-   }
-   else if ( name == SigTrihedralCR::getFactoryName() ) {
-      obj = new SigTrihedralCR();
-   }
-   else if ( name == SigSwitch::getFactoryName() ) {
-      obj = new SigSwitch();
-   }
-   else if ( name == SigAzEl::getFactoryName() ) {
-      obj = new SigAzEl();
-   }
-   // IR Signatures
-   else if ( name == IrSignature::getFactoryName() ) {
-      obj = new IrSignature();
-   }
-   else if ( name == AircraftIrSignature::getFactoryName() ) {
-      obj = new AircraftIrSignature;
-   }
-   else if ( name == IrShape::getFactoryName() ) {
-      obj = new IrShape();
-   }
-   else if ( name == IrSphere::getFactoryName() ) {
-      obj = new IrSphere();
-   }
-   else if ( name == IrBox::getFactoryName() ) {
-      obj = new IrBox();
-   }
-    // Onboard Computers
-   else if ( name == OnboardComputer::getFactoryName() ) {
-      obj = new OnboardComputer();
-   }
-   // Radios
-   else if ( name == Radio::getFactoryName() ) {
-      obj = new Radio();
-   }
-   else if ( name == CommRadio::getFactoryName() ) {
-      obj = new CommRadio();
-   }
-   else if ( name == Iff::getFactoryName() ) {
-      obj = new Iff();
-   }
-   // Sensors
-   else if ( name == RfSensor::getFactoryName() ) {
-      obj = new RfSensor();
-   }
-   else if ( name == SensorMgr::getFactoryName() ) {
-      obj = new SensorMgr();
-   }
-   else if ( name == Radar::getFactoryName() ) {
-      obj = new Radar();
-   }
-   else if ( name == Rwr::getFactoryName() ) {
-      obj = new Rwr();
-   }
-   else if ( name == Sar::getFactoryName() ) {
-      obj = new Sar();
-   }
-   else if ( name == Jammer::getFactoryName() ) {
-      obj = new Jammer();
-   }
-   else if ( name == IrSensor::getFactoryName() ) {
-      obj = new IrSensor();
-   }
-   else if ( name == MergingIrSensor::getFactoryName() ) {
-      obj = new MergingIrSensor();
-   }
-
-   // Tracks
-   else if ( name == Track::getFactoryName() ) {
-      obj = new Track();
-   }
-
-   // Track Managers
-   else if ( name == GmtiTrkMgr::getFactoryName() ) {
-      obj = new GmtiTrkMgr();
-   }
-   else if ( name == AirTrkMgr::getFactoryName() ) {
-      obj = new AirTrkMgr();
-   }
-   else if ( name == RwrTrkMgr::getFactoryName() ) {
-      obj = new RwrTrkMgr();
-   }
-   else if ( name == AirAngleOnlyTrkMgr::getFactoryName() ) {
-      obj = new AirAngleOnlyTrkMgr();
-   }
-
-   // UBF Agents
-   else if ( name == SimAgent::getFactoryName() ) {
-      obj = new SimAgent();
-   }
-   else if ( name == MultiActorAgent::getFactoryName() ) {
-      obj = new MultiActorAgent();
-   }
-
-   // Collision detection component
-   else if ( name == CollisionDetect::getFactoryName() ) {
-      obj = new CollisionDetect();
-   }
-
-   return obj;
+   static const base::FactoryTable table {
+      // dynamics models
+      { RacModel::getFactoryName(),              base::FactoryTable::make<RacModel> },   // RAC
+      { JSBSimModel::getFactoryName(),           base::FactoryTable::make<JSBSimModel> },   // JSBSim
+      { LaeroModel::getFactoryName(),            base::FactoryTable::make<LaeroModel> },   // Laero
+
+      // environment
+      { IrAtmosphere::getFactoryName(),          base::FactoryTable::make<IrAtmosphere> },
+      { IrAtmosphere1::getFactoryName(),         base::FactoryTable::make<IrAtmosphere1> },
+
+      // sensor models
+      { Gmti::getFactoryName(),                  base::FactoryTable::make<Gmti> },
+      { Stt::getFactoryName(),                   base::FactoryTable::make<Stt> },
+      { Tws::getFactoryName(),                   base::FactoryTable::make<Tws> },
+
+      // world models
+      { WorldModel::getFactoryName(),            base::FactoryTable::make<WorldModel> },
+
+      // Players
+      { Player::getFactoryName(),                base::FactoryTable::make<Player> },
+      { AirVehicle::getFactoryName(),            base::FactoryTable::make<AirVehicle> },
+      { Building::getFactoryName(),              base::FactoryTable::make<Building> },
+      { GroundVehicle::getFactoryName(),         base::FactoryTable::make<GroundVehicle> },
+      { LifeForm::getFactoryName(),              base::FactoryTable::make<LifeForm> },
+      { Ship::getFactoryName(),                  base::FactoryTable::make<Ship> },
+      { SpaceVehicle::getFactoryName(),          base::FactoryTable::make<SpaceVehicle> },
+
+      // Air Vehicles
+      { Aircraft::getFactoryName(),              base::FactoryTable::make<Aircraft> },
+      { Helicopter::getFactoryName(),            base::FactoryTable::make<Helicopter> },
+      { UnmannedAirVehicle::getFactoryName(),    base::FactoryTable::make<UnmannedAirVehicle> },
+
+      // Ground Vehicles
+      { Tank::getFactoryName(),                  base::FactoryTable::make<Tank> },
+      { ArmoredVehicle::getFactoryName(),        base::FactoryTable::make<ArmoredVehicle> },
+      { WheeledVehicle::getFactoryName(),        base::FactoryTable::make<WheeledVehicle> },
+      { Artillery::getFactoryName(),             base::FactoryTable::make<Artillery> },
+      { SamVehicle::getFactoryName(),            base::FactoryTable::make<SamVehicle> },
+      { GroundStation::getFactoryName(),         base::FactoryTable::make<GroundStation> },
+      { GroundStationRadar::getFactoryName(),    base::FactoryTable::make<GroundStationRadar> },
+      { GroundStationUav::getFactoryName(),      base::FactoryTable::make<GroundStationUav> },
+
+      // Space Vehicles
+      { MannedSpaceVehicle::getFactoryName(),    base::FactoryTable::make<MannedSpaceVehicle> },
+      { UnmannedSpaceVehicle::getFactoryName(),  base::FactoryTable::make<UnmannedSpaceVehicle> },
+      { BoosterSpaceVehicle::getFactoryName(),   base::FactoryTable::make<BoosterSpaceVehicle> },
+
+      // System
+      { System::getFactoryName(),                base::FactoryTable::make<System> },
+      { AvionicsPod::getFactoryName(),           base::FactoryTable::make<AvionicsPod> },
+
+      // Basic Pilot types
+      { Pilot::getFactoryName(),                 base::FactoryTable::make<Pilot> },
+      { Autopilot::getFactoryName(),             base::FactoryTable::make<Autopilot> },
+
+      // Navigation types
+      { Navigation::getFactoryName(),            base::FactoryTable::make<Navigation> },
+      { Ins::getFactoryName(),                   base::FactoryTable::make<Ins> },
+      { Gps::getFactoryName(),                   base::FactoryTable::make<Gps> },
+      { Route::getFactoryName(),                 base::FactoryTable::make<Route> },
+      { Steerpoint::getFactoryName(),            base::FactoryTable::make<Steerpoint> },
+
+      // Target Data
+      { TargetData::getFactoryName(),            base::FactoryTable::make<TargetData> },
+
+      // Bullseye
+      { Bullseye::getFactoryName(),              base::FactoryTable::make<Bullseye> },
+
+      // Actions
+      { ActionImagingSar::getFactoryName(),      base::FactoryTable::make<ActionImagingSar> },
+      { ActionWeaponRelease::getFactoryName(),   base::FactoryTable::make<ActionWeaponRelease> },
+      { ActionDecoyRelease::getFactoryName(),    base::FactoryTable::make<ActionDecoyRelease> },
+      { ActionCamouflageType::getFactoryName(),  base::FactoryTable::make<ActionCamouflageType> },
+
+      // Bombs and Missiles
+      { Bomb::getFactoryName(),                  base::FactoryTable::make<Bomb> },
+      { Missile::getFactoryName(),               base::FactoryTable::make<Missile> },
+      { Aam::getFactoryName(),                   base::FactoryTable::make<Aam> },
+      { Agm::getFactoryName(),                   base::FactoryTable::make<Agm> },
+      { Sam::getFactoryName(),                   base::FactoryTable::make<Sam> },
+
+      // Effects
+      { Chaff::getFactoryName(),                 base::FactoryTable::make<Chaff> },
+      { Decoy::getFactoryName(),                 base::FactoryTable::make<Decoy> },
+      { Flare::getFactoryName(),                 base::FactoryTable::make<Flare> },
+
+      // Stores, stores manager and external stores (FuelTank, Gun & Bullets (used by the Gun))
+      { Stores::getFactoryName(),                base::FactoryTable::make<Stores> },
+      { SimpleStoresMgr::getFactoryName(),       base::FactoryTable::make<SimpleStoresMgr> },
+      { FuelTank::getFactoryName(),              base::FactoryTable::make<FuelTank> },
+      { Gun::getFactoryName(),                   base::FactoryTable::make<Gun> },
+      { Bullet::getFactoryName(),                base::FactoryTable::make<Bullet> },
+
+      // Data links
+      { Datalink::getFactoryName(),              base::FactoryTable::make<Datalink> },
+
+      // Gimbals, Antennas and Optics
+      { Gimbal::getFactoryName(),                base::FactoryTable::make<Gimbal> },
+      { ScanGimbal::getFactoryName(),            base::FactoryTable::make<ScanGimbal> },
+      { StabilizingGimbal::getFactoryName(),     base::FactoryTable::make<StabilizingGimbal> },
+      { Antenna::getFactoryName(),               base::FactoryTable::make<Antenna> },
+      { IrSeeker::getFactoryName(),              base::FactoryTable::make<IrSeeker> },
+
+      // R/F Signatures
+      { SigConstant::getFactoryName(),           base::FactoryTable::make<SigConstant> },
+      { SigSphere::getFactoryName(),             base::FactoryTable::make<SigSphere> },
+      { SigPlate::getFactoryName(),              base::FactoryTable::make<SigPlate> },
+      { SigDihedralCR::getFactoryName(),         base::FactoryTable::make<SigDihedralCR> },
+      { SigTrihedralCR::getFactoryName(),        base::FactoryTable::make<SigTrihedralCR> },
+      { SigSwitch::getFactoryName(),             base::FactoryTable::make<SigSwitch> },
+      { SigAzEl::getFactoryName(),               base::FactoryTable::make<SigAzEl> },
+      { SigCompiled::getFactoryName(),           base::FactoryTable::make<SigCompiled> },
+      // IR Signatures
+      { IrSignature::getFactoryName(),           base::FactoryTable::make<IrSignature> },
+      { AircraftIrSignature::getFactoryName(),   base::FactoryTable::make<AircraftIrSignature> },
+      { IrShape::getFactoryName(),               base::FactoryTable::make<IrShape> },
+      { IrSphere::getFactoryName(),              base::FactoryTable::make<IrSphere> },
+      { IrBox::getFactoryName(),                 base::FactoryTable::make<IrBox> },
+       // Onboard Computers
+      { OnboardComputer::getFactoryName(),       base::FactoryTable::make<OnboardComputer> },
+      // Radios
+      { Radio::getFactoryName(),                 base::FactoryTable::make<Radio> },
+      { CommRadio::getFactoryName(),             base::FactoryTable::make<CommRadio> },
+      { Iff::getFactoryName(),                   base::FactoryTable::make<Iff> },
+      // Sensors
+      { RfSensor::getFactoryName(),              base::FactoryTable::make<RfSensor> },
+      { SensorMgr::getFactoryName(),             base::FactoryTable::make<SensorMgr> },
+      { Radar::getFactoryName(),                 base::FactoryTable::make<Radar> },
+      { RadarClutter::getFactoryName(),          base::FactoryTable::make<RadarClutter> },
+      { Rwr::getFactoryName(),                   base::FactoryTable::make<Rwr> },
+      { Sar::getFactoryName(),                   base::FactoryTable::make<Sar> },
+      { Jammer::getFactoryName(),                base::FactoryTable::make<Jammer> },
+      { IrSensor::getFactoryName(),              base::FactoryTable::make<IrSensor> },
+      { MergingIrSensor::getFactoryName(),       base::FactoryTable::make<MergingIrSensor> },
+
+      // Tracks
+      { Track::getFactoryName(),                 base::FactoryTable::make<Track> },
+
+      // Track Managers
+      { GmtiTrkMgr::getFactoryName(),            base::FactoryTable::make<GmtiTrkMgr> },
+      { AirTrkMgr::getFactoryName(),             base::FactoryTable::make<AirTrkMgr> },
+      { RwrTrkMgr::getFactoryName(),             base::FactoryTable::make<RwrTrkMgr> },
+      { AirAngleOnlyTrkMgr::getFactoryName(),    base::FactoryTable::make<AirAngleOnlyTrkMgr> },
+
+      // UBF Agents
+      { SimAgent::getFactoryName(),              base::FactoryTable::make<SimAgent> },
+      { MultiActorAgent::getFactoryName(),       base::FactoryTable::make<MultiActorAgent> },
+
+      // Collision detection component
+      { CollisionDetect::getFactoryName(),       base::FactoryTable::make<CollisionDetect> },
+   };
+   return table.create(name);
 }
 
 }
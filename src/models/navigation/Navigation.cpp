@@ -173,6 +173,76 @@ void Navigation::reset()
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our navigation data and our primary route,
+// which isn't one of our components, so it's saved here
+//------------------------------------------------------------------------------
+void Navigation::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(latitude);
+   cp->put(longitude);
+   cp->put(altitude);
+   cp->put(posValid);
+   cp->putDoubles(rm.ptr(), 16);
+   cp->put(heading);
+   cp->put(pitch);
+   cp->put(roll);
+   cp->put(attValid);
+   cp->put(magvar);
+   cp->put(mhdg);
+   cp->put(magVarValid);
+   cp->put(windsValid);
+   cp->put(windDirD);
+   cp->put(windSpdKts);
+   cp->putDoubles(velVec.ptr(), 3);
+   cp->putDoubles(accelVec.ptr(), 3);
+   cp->put(gs);
+   cp->put(tas);
+   cp->put(tk);
+   cp->put(velValid);
+   cp->put(navStrValid);
+   cp->put(tbrg);
+   cp->put(mbrg);
+   cp->put(dst);
+   cp->put(ttg);
+   cp->put(tcrs);
+   cp->put(mcrs);
+   cp->put(xte);
+   cp->put(eta);
+   cp->put(utc);
+   cp->put(utcValid);
+
+   const bool haveRoute = (priRoute != nullptr);
+   cp->put(haveRoute);
+   if (haveRoute) priRoute->saveState(cp);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Navigation::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection();
+   ok = ok && rd->get(&latitude) && rd->get(&longitude) && rd->get(&altitude) && rd->get(&posValid);
+   ok = ok && rd->getDoubles(rm.ptr(), 16);
+   ok = ok && rd->get(&heading) && rd->get(&pitch) && rd->get(&roll) && rd->get(&attValid);
+   ok = ok && rd->get(&magvar) && rd->get(&mhdg) && rd->get(&magVarValid);
+   ok = ok && rd->get(&windsValid) && rd->get(&windDirD) && rd->get(&windSpdKts);
+   ok = ok && rd->getDoubles(velVec.ptr(), 3) && rd->getDoubles(accelVec.ptr(), 3);
+   ok = ok && rd->get(&gs) && rd->get(&tas) && rd->get(&tk) && rd->get(&velValid);
+   ok = ok && rd->get(&navStrValid) && rd->get(&tbrg) && rd->get(&mbrg) && rd->get(&dst) && rd->get(&ttg);
+   ok = ok && rd->get(&tcrs) && rd->get(&mcrs) && rd->get(&xte) && rd->get(&eta);
+   ok = ok && rd->get(&utc) && rd->get(&utcValid);
+
+   bool haveRoute {};
+   ok = ok && rd->get(&haveRoute) && (haveRoute == (priRoute != nullptr));
+   if (ok && haveRoute) ok = priRoute->restoreState(rd);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // updateData() -- update Non-time critical stuff here
 //------------------------------------------------------------------------------
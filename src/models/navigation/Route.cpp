@@ -2,6 +2,7 @@
 #include "openeaagles/models/navigation/Route.hpp"
 
 #include "openeaagles/models/navigation/Steerpoint.hpp"
+#include "openeaagles/models/player/AirVehicle.hpp"
 #include "openeaagles/models/player/Player.hpp"
 #include "openeaagles/models/navigation/Navigation.hpp"
 #include "openeaagles/models/system/OnboardComputer.hpp"
@@ -15,6 +16,7 @@
 #include "openeaagles/base/String.hpp"
 
 #include "openeaagles/base/units/Distances.hpp"
+#include "openeaagles/base/units/Times.hpp"
 
 #include <cstdio>
 
@@ -107,6 +109,34 @@ void Route::reset()
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our 'to' steerpoint, by index, and our
+// steering data; the steerpoints must match
+//------------------------------------------------------------------------------
+void Route::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(stptIdx);
+   cp->put(autoSeq);
+   cp->put(distToGo);
+   cp->put(timeToGo);
+   cp->put(fuelToGo);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Route::restoreState(base::Checkpoint::Reader* const rd)
+{
+   unsigned int idx {};
+   bool ok = rd->beginSection() && rd->get(&idx) && rd->get(&autoSeq);
+   ok = ok && rd->get(&distToGo) && rd->get(&timeToGo) && rd->get(&fuelToGo);
+   ok = rd->endSection() && ok;
+
+   ok = ok && BaseClass::restoreState(rd);
+   return ok && directTo(idx);
+}
+
 //------------------------------------------------------------------------------
 // getNumberOfSteerpoints() -- returns the number of components (stpts) in our
 // list
@@ -131,10 +161,15 @@ void Route::updateData(const double dt)
 }
 
 //------------------------------------------------------------------------------
-// Compute nav steering data for each steerpoint.
+// Compute nav steering data for each steerpoint, and the route's distance,
+// time and fuel to go.
 //------------------------------------------------------------------------------
 void Route::computeSteerpointData(const double, const Navigation* const nav)
 {
+   distToGo = 0.0;
+   timeToGo = 0.0;
+   fuelToGo = 0.0;
+
    if (nav != nullptr) {
       base::PairStream* steerpoints = getComponents();
       if (steerpoints != nullptr) {
@@ -154,6 +189,24 @@ void Route::computeSteerpointData(const double, const Navigation* const nav)
             item = item->getNext();
          }
 
+         // The last steerpoint's enroute data are the route totals
+         if (from != nullptr && from->isNavDataValid()) {
+            distToGo = from->getDistEnrouteNM();
+            timeToGo = from->getETE();
+
+            const auto av = dynamic_cast<const AirVehicle*>(findContainerByType(typeid(AirVehicle)));
+            if (av != nullptr && timeToGo > 0.0) {
+               static const int MAX_ENGINES = 8;
+               double ff[MAX_ENGINES] = {};
+               const int n = av->getEngFuelFlow(ff, MAX_ENGINES);
+               double totalFlow = 0.0;   // (lbs/hour)
+               for (int i = 0; i < n; i++) {
+                  totalFlow += ff[i];
+               }
+               fuelToGo = totalFlow * timeToGo * base::time::S2H;
+            }
+         }
+
          steerpoints->unref();
          steerpoints = nullptr;
       }
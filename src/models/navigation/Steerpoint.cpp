@@ -28,6 +28,11 @@ namespace models {
 
 IMPLEMENT_SUBCLASS(Steerpoint, "Steerpoint")
 
+// Direct-to projection limits (see computeDirectTo())
+static const double MAX_PROJECTION = 0.02;      // Max nav movement; fraction of the reference distance
+static const double MIN_PROJECTION_DIST = 2.0;  // Min reference distance (nm)
+static const double RATE_STEP = 0.001;          // Lat/lon step for the rates of change (deg)
+
 BEGIN_SLOTTABLE(Steerpoint)
     "stptType",         //  1) Steerpoint type          (Identifier) { ROUTE, DEST, MARK, FIX, OAP, TGT }; default: DEST
     "latitude",         //  2) Latitude                 (latLon)
@@ -167,6 +172,9 @@ void Steerpoint::copyData(const Steerpoint& org, const bool)
     elt = org.elt;
     scaWarn = org.scaWarn;
     navDataValid = org.navDataValid;
+
+    legValid = false;
+    refValid = false;
 }
 
 void Steerpoint::deleteData()
@@ -603,6 +611,76 @@ void Steerpoint::clearNavData()
     setETA(0);
     setELT(0);
     navDataValid = false;
+    legValid = false;
+    refValid = false;
+}
+
+//------------------------------------------------------------------------------
+// computeDirectTo() -- 'direct-to' true bearing (deg) and distance (nm) from
+// the nav lat/lon; projected from the reference data when we're able
+//------------------------------------------------------------------------------
+void Steerpoint::computeDirectTo(const double lat, const double lon, double* const brg, double* const dist)
+{
+    // Project from the reference data?
+    if (refValid && refStptLat == latitude && refStptLon == longitude) {
+        const double dlat = base::angle::aepcdDeg(lat - refLat);
+        const double dlon = base::angle::aepcdDeg(lon - refLon);
+        const double dn = refDnDlat * dlat + refDnDlon * dlon;
+        const double de = refDeDlat * dlat + refDeDlon * dlon;
+        const double maxMove = MAX_PROJECTION * refDist;
+        if ( (dn*dn + de*de) <= (maxMove*maxMove) ) {
+            const double n = refN + dn;
+            const double e = refE + de;
+            *brg = base::angle::aepcdDeg( std::atan2(e, n) * base::angle::R2DCC );
+            *dist = std::sqrt(n*n + e*e);
+            return;
+        }
+    }
+
+    // Compute the great circle bearing and distance
+    base::nav::gll2bd(lat, lon, latitude, longitude, brg, dist);
+
+    // and, when we're not too close, our new reference data
+    refValid = (*dist >= MIN_PROJECTION_DIST);
+    if (refValid) {
+        refLat = lat;
+        refLon = lon;
+        refStptLat = latitude;
+        refStptLon = longitude;
+        refDist = *dist;
+        refN = *dist * std::cos(*brg * base::angle::D2RCC);
+        refE = *dist * std::sin(*brg * base::angle::D2RCC);
+
+        double b = 0.0;
+        double d = 0.0;
+        base::nav::gll2bd(lat + RATE_STEP, lon, latitude, longitude, &b, &d);
+        refDnDlat = (d * std::cos(b * base::angle::D2RCC) - refN) / RATE_STEP;
+        refDeDlat = (d * std::sin(b * base::angle::D2RCC) - refE) / RATE_STEP;
+
+        base::nav::gll2bd(lat, lon + RATE_STEP, latitude, longitude, &b, &d);
+        refDnDlon = (d * std::cos(b * base::angle::D2RCC) - refN) / RATE_STEP;
+        refDeDlon = (d * std::sin(b * base::angle::D2RCC) - refE) / RATE_STEP;
+    }
+}
+
+//------------------------------------------------------------------------------
+// computeLeg() -- 'leg' true course (deg) and distance (nm) from the 'from'
+// steerpoint; recomputed only when one of the steerpoints has moved
+//------------------------------------------------------------------------------
+void Steerpoint::computeLeg(const Steerpoint* const from, double* const crs, double* const dist)
+{
+    const double fLat = from->getLatitude();
+    const double fLon = from->getLongitude();
+    if ( !legValid || legFromLat != fLat || legFromLon != fLon || legLat != latitude || legLon != longitude ) {
+        base::nav::gll2bd(fLat, fLon, latitude, longitude, &legCrs, &legDist);
+        legFromLat = fLat;
+        legFromLon = fLon;
+        legLat = latitude;
+        legLon = longitude;
+        legValid = true;
+    }
+    *crs = legCrs;
+    *dist = legDist;
 }
 
 //------------------------------------------------------------------------------
@@ -649,7 +727,7 @@ bool Steerpoint::compute(const Navigation* const nav, const Steerpoint* const fr
             double toBrg = 0.0;
             double toDist = 0.0;
             double toTTG = 0.0;
-            base::nav::gll2bd(nav->getLatitude(), nav->getLongitude(), getLatitude(), getLongitude(), &toBrg, &toDist);
+            computeDirectTo(nav->getLatitude(), nav->getLongitude(), &toBrg, &toDist);
 
             setTrueBrgDeg( static_cast<double>(toBrg) );
             setDistNM( static_cast<double>(toDist) );
@@ -668,7 +746,7 @@ bool Steerpoint::compute(const Navigation* const nav, const Steerpoint* const fr
             toTTG = 0.0;
             if (from != nullptr) {
                 // When we have a 'from' steerpoint, we can compute this leg's data
-                base::nav::gll2bd(from->getLatitude(), from->getLongitude(), getLatitude(), getLongitude(), &toBrg, &toDist);
+                computeLeg(from, &toBrg, &toDist);
                 setTrueCrsDeg( static_cast<double>(toBrg) );
                 setMagCrsDeg( base::angle::aepcdDeg( getTrueCrsDeg() - getMagVarDeg() ) );
                 setLegDistNM( static_cast<double>(toDist) );
@@ -2,6 +2,7 @@
 #include "openeaagles/models/player/AbstractWeapon.hpp"
 
 #include "openeaagles/models/dynamics/DynamicsModel.hpp"
+#include "openeaagles/models/player/Bullet.hpp"
 #include "openeaagles/models/player/Player.hpp"
 #include "openeaagles/models/system/TrackManager.hpp"
 #include "openeaagles/models/Designator.hpp"
@@ -24,6 +25,9 @@
 
 #include "openeaagles/base/util/nav_utils.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace oe {
 namespace models {
 
@@ -219,6 +223,284 @@ void AbstractWeapon::reset()
    if (flyout != nullptr) flyout->unref();
 }
 
+//------------------------------------------------------------------------------
+// Checkpoint helpers: the weapons in our stores (see getStoresWeapons()) and
+// the track managers of a component tree, in order
+//------------------------------------------------------------------------------
+static void addStoresWeapons(const base::Component* const c, std::vector<const AbstractWeapon*>* const list)
+{
+   const auto stores = dynamic_cast<const Stores*>(c);
+   if (stores != nullptr) {
+      const base::PairStream* sl = stores->getStores();
+      if (sl != nullptr) {
+         const base::List::Item* item = sl->getFirstItem();
+         while (item != nullptr) {
+            const base::Object* obj = static_cast<const base::Pair*>(item->getValue())->object();
+            const auto wpn = dynamic_cast<const AbstractWeapon*>(obj);
+            const auto gun = dynamic_cast<const Gun*>(obj);
+            if (wpn != nullptr) list->push_back(wpn);
+            else if (gun != nullptr && gun->getBulletType() != nullptr) list->push_back(gun->getBulletType());
+            else if (dynamic_cast<const Stores*>(obj) != nullptr) addStoresWeapons(static_cast<const Stores*>(obj), list);
+            item = item->getNext();
+         }
+         sl->unref();
+      }
+   }
+
+   const base::PairStream* subcomponents = c->getComponents();
+   if (subcomponents != nullptr) {
+      const base::List::Item* item = subcomponents->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<const base::Pair*>(item->getValue());
+         addStoresWeapons(static_cast<const base::Component*>(pair->object()), list);
+         item = item->getNext();
+      }
+      subcomponents->unref();
+   }
+}
+
+static void addTrackManagers(const base::Component* const c, std::vector<const TrackManager*>* const list)
+{
+   const base::PairStream* subcomponents = c->getComponents();
+   if (subcomponents != nullptr) {
+      const base::List::Item* item = subcomponents->getFirstItem();
+      while (item != nullptr) {
+         const auto p = static_cast<const base::Component*>(static_cast<const base::Pair*>(item->getValue())->object());
+         const auto tm = dynamic_cast<const TrackManager*>(p);
+         if (tm != nullptr) list->push_back(tm);
+         addTrackManagers(p, list);
+         item = item->getNext();
+      }
+      subcomponents->unref();
+   }
+}
+
+// All of the weapons in player 'p's stores, including its guns' bullets, in order
+void AbstractWeapon::getStoresWeapons(const Player* const p, std::vector<const AbstractWeapon*>* const list)
+{
+   list->clear();
+   if (p != nullptr) {
+      const base::PairStream* subcomponents = p->getComponents();
+      if (subcomponents != nullptr) {
+         const base::List::Item* item = subcomponents->getFirstItem();
+         while (item != nullptr) {
+            const auto pair = static_cast<const base::Pair*>(item->getValue());
+            addStoresWeapons(static_cast<const base::Component*>(pair->object()), list);
+            item = item->getNext();
+         }
+         subcomponents->unref();
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// saveState() -- save our release and target state (see "Checkpoints")
+//------------------------------------------------------------------------------
+void AbstractWeapon::saveState(base::Checkpoint* const cp) const
+{
+   const Player* const lv = getLaunchVehicle();
+
+   cp->beginSection();
+   WorldModel::savePlayerName(cp, lv);
+
+   // Flyout and initial weapons: 0 -- none, 1 -- us, 2 -- another weapon
+   const unsigned char flyoutRef = (flyoutWpn == nullptr ? 0 : (flyoutWpn == this ? 1 : 2));
+   cp->put(flyoutRef);
+   if (flyoutRef == 2) WorldModel::savePlayerName(cp, flyoutWpn);
+
+   const unsigned char initialRef = (initialWpn == nullptr ? 0 : (initialWpn == this ? 1 : 2));
+   cp->put(initialRef);
+   if (initialRef == 2) {
+      std::vector<const AbstractWeapon*> list;
+      getStoresWeapons(lv, &list);
+      const auto found = std::find(list.begin(), list.end(), static_cast<const AbstractWeapon*>(initialWpn));
+      cp->put(static_cast<int>(found != list.end() ? found - list.begin() : -1));
+   }
+
+   WorldModel::savePlayerName(cp, tgtPlayer);
+
+   // Target track: its owner, its track manager and its ID
+   int owner {};
+   unsigned int mgr {};
+   int id {};
+   if (tgtTrack != nullptr) {
+      const Player* const owners[2] = { lv, this };
+      for (int k = 0; k < 2 && owner == 0; k++) {
+         if (owners[k] == nullptr) continue;
+         std::vector<const TrackManager*> tms;
+         addTrackManagers(owners[k], &tms);
+         for (unsigned int i = 0; i < tms.size() && owner == 0; i++) {
+            std::vector<base::safe_ptr<const Track>> trks(tms[i]->getMaxTracks());
+            const int n = tms[i]->getTrackList(trks.data(), static_cast<unsigned int>(trks.size()));
+            for (int j = 0; j < n && owner == 0; j++) {
+               if (trks[j] == tgtTrack) {
+                  owner = k + 1;
+                  mgr = i;
+                  id = tgtTrack->getTrackID();
+               }
+            }
+         }
+      }
+   }
+   cp->put(owner);
+   cp->put(mgr);
+   cp->put(id);
+
+   cp->putDoubles(tgtPos.ptr(), 3);
+   cp->put(tgtPosValid);
+   cp->putDoubles(tgtVel.ptr(), 3);
+   cp->put(posTrkEnb);
+   cp->put(detonationRange);
+   cp->putDoubles(tgtDetLoc.ptr(), 3);
+   cp->put(eventID);
+   cp->put(power);
+   cp->put(failed);
+   cp->put(released);
+   cp->put(releaseHold);
+   cp->put(willHang);
+   cp->put(hung);
+   cp->put(blocked);
+   cp->put(jettisoned);
+   cp->put(results);
+   cp->put(tof);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+//------------------------------------------------------------------------------
+// restoreState() -- restore our release and target state; our target track
+// is found later, by restoreTargetTrack()
+//------------------------------------------------------------------------------
+bool AbstractWeapon::restoreState(base::Checkpoint::Reader* const rd)
+{
+   WorldModel* const sim = getWorldModel();
+
+   Player* lv {};
+   bool ok = rd->beginSection() && (sim != nullptr) && sim->restorePlayerName(rd, &lv);
+   if (ok) setLaunchVehicle(lv);
+
+   unsigned char flyoutRef {};
+   ok = ok && rd->get(&flyoutRef);
+   if (ok) {
+      Player* p {};
+      if (flyoutRef == 2) ok = sim->restorePlayerName(rd, &p) && (dynamic_cast<AbstractWeapon*>(p) != nullptr);
+      else ok = (flyoutRef <= 1);
+      if (ok) setFlyoutWeapon(flyoutRef == 1 ? this : dynamic_cast<AbstractWeapon*>(p));
+   }
+
+   unsigned char initialRef {};
+   ok = ok && rd->get(&initialRef) && (initialRef <= 2);
+   if (ok) {
+      const AbstractWeapon* initial = (initialRef == 1 ? this : nullptr);
+      if (initialRef == 2) {
+         int idx {};
+         std::vector<const AbstractWeapon*> list;
+         getStoresWeapons(lv, &list);
+         ok = rd->get(&idx) && (idx >= 0 && idx < static_cast<int>(list.size()));
+         if (ok) initial = list[idx];
+      }
+      if (ok) setInitialWeapon(const_cast<AbstractWeapon*>(initial));
+   }
+
+   Player* tgt {};
+   ok = ok && sim->restorePlayerName(rd, &tgt);
+   if (ok) tgtPlayer = tgt;
+
+   tgtTrack = nullptr;
+   ok = ok && rd->get(&rstTrkOwner) && rd->get(&rstTrkMgr) && rd->get(&rstTrkId);
+   ok = ok && (rstTrkOwner >= 0 && rstTrkOwner <= 2);
+
+   ok = ok && rd->getDoubles(tgtPos.ptr(), 3) && rd->get(&tgtPosValid);
+   ok = ok && rd->getDoubles(tgtVel.ptr(), 3) && rd->get(&posTrkEnb);
+   ok = ok && rd->get(&detonationRange) && rd->getDoubles(tgtDetLoc.ptr(), 3);
+   ok = ok && rd->get(&eventID) && rd->get(&power) && rd->get(&failed);
+   ok = ok && rd->get(&released) && rd->get(&releaseHold) && rd->get(&willHang) && rd->get(&hung);
+   ok = ok && rd->get(&blocked) && rd->get(&jettisoned) && rd->get(&results) && rd->get(&tof);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
+//------------------------------------------------------------------------------
+// restoreTargetTrack() -- after all of the players have been restored, finds
+// our target track; returns false if it's not found
+//------------------------------------------------------------------------------
+bool AbstractWeapon::restoreTargetTrack()
+{
+   bool ok = true;
+   if (rstTrkOwner != 0) {
+      const Player* const owner = (rstTrkOwner == 1 ? getLaunchVehicle() : this);
+      Track* trk {};
+      if (owner != nullptr) {
+         std::vector<const TrackManager*> tms;
+         addTrackManagers(owner, &tms);
+         if (rstTrkMgr < tms.size()) {
+            std::vector<base::safe_ptr<Track>> trks(tms[rstTrkMgr]->getMaxTracks());
+            const int n = tms[rstTrkMgr]->getTrackList(trks.data(), static_cast<unsigned int>(trks.size()));
+            for (int j = 0; j < n && trk == nullptr; j++) {
+               if (trks[j]->getTrackID() == rstTrkId) trk = trks[j];
+            }
+         }
+      }
+      tgtTrack = trk;
+      ok = (trk != nullptr);
+      rstTrkOwner = 0;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// saveOrigin() -- our launch vehicle, the index of our initial weapon in its
+// stores and our player ID, so we can be recreated by recreateFlyout()
+//------------------------------------------------------------------------------
+void AbstractWeapon::saveOrigin(base::Checkpoint* const cp) const
+{
+   const Player* const lv = getLaunchVehicle();
+   std::vector<const AbstractWeapon*> list;
+   getStoresWeapons(lv, &list);
+   const auto found = std::find(list.begin(), list.end(), static_cast<const AbstractWeapon*>(initialWpn));
+
+   WorldModel::savePlayerName(cp, lv);
+   cp->put(static_cast<int>(found != list.end() ? found - list.begin() : -1));
+   cp->put(getID());
+}
+
+//------------------------------------------------------------------------------
+// recreateFlyout() -- recreates a flyout weapon from its origin (see
+// saveOrigin()) by cloning its initial weapon, like prerelease(); returns
+// a pre-ref()'d pointer to the flyout weapon, or zero if it can't
+//------------------------------------------------------------------------------
+AbstractWeapon* AbstractWeapon::recreateFlyout(WorldModel* const sim, base::Checkpoint::Reader* const rd)
+{
+   Player* lv {};
+   int idx {};
+   unsigned short id {};
+   bool ok = sim->restorePlayerName(rd, &lv) && rd->get(&idx) && rd->get(&id);
+   ok = ok && (lv != nullptr);
+
+   AbstractWeapon* flyout {};
+   if (ok) {
+      std::vector<const AbstractWeapon*> list;
+      getStoresWeapons(lv, &list);
+      if (idx >= 0 && idx < static_cast<int>(list.size())) {
+         const auto initial = const_cast<AbstractWeapon*>(list[idx]);
+
+         flyout = initial->clone();
+         flyout->container( sim );
+         flyout->reset();
+
+         flyout->setFlyoutWeapon(flyout);
+         flyout->setInitialWeapon(initial);
+         flyout->setID( id );
+
+         flyout->setLaunchVehicle( lv );
+         flyout->setSide( lv->getSide() );
+      }
+   }
+   return flyout;
+}
+
 //------------------------------------------------------------------------------
 // updateTC() -- update time critical stuff here
 //------------------------------------------------------------------------------
@@ -1035,6 +1317,12 @@ const AbstractWeapon* AbstractWeapon::getInitialWeapon() const
    return initialWpn.getRefPtr();
 }
 
+// True if we're a flyout weapon (cloned from an initial weapon)
+bool AbstractWeapon::isFlyoutWeapon() const
+{
+   return (flyoutWpn == this && initialWpn != nullptr && initialWpn != this);
+}
+
 // Release event ID (to help match weapon launch and detonation events)
 unsigned short AbstractWeapon::getReleaseEventID() const
 {
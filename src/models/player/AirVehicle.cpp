@@ -73,6 +73,28 @@ void AirVehicle::reset()
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- gear, weapon bay door and wing sweep positions
+//------------------------------------------------------------------------------
+void AirVehicle::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(gearPos);
+   cp->put(wpnBayDoorPos);
+   cp->put(wingSweep);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool AirVehicle::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&gearPos) && rd->get(&wpnBayDoorPos) && rd->get(&wingSweep);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // Data access functions that need conversion
 //------------------------------------------------------------------------------
@@ -81,6 +81,30 @@ void Bomb::deleteData()
 {
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our guidance data
+//------------------------------------------------------------------------------
+void Bomb::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(guidanceValid);
+   cp->put(missDistRef);
+   cp->put(tgtRangeRef);
+   cp->put(cmdStrAz);
+   cp->put(cmdStrEl);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Bomb::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&guidanceValid) && rd->get(&missDistRef) && rd->get(&tgtRangeRef) && rd->get(&cmdStrAz) && rd->get(&cmdStrEl);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // Get functions
 //------------------------------------------------------------------------------
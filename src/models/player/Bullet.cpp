@@ -1,10 +1,9 @@
 
 #include "openeaagles/models/player/Bullet.hpp"
+#include "openeaagles/models/player/BulletHitIndex.hpp"
 #include "openeaagles/models/WorldModel.hpp"
 
-#include "openeaagles/base/List.hpp"
-#include "openeaagles/base/PairStream.hpp"
-
+#include <algorithm>
 #include <cmath>
 
 namespace oe {
@@ -16,6 +15,8 @@ EMPTY_SERIALIZER(Bullet)
 // Default Parameters
 const double Bullet::DEFAULT_MUZZLE_VEL = 1000.0f;     // Meters / second
 const double Bullet::DEFAULT_MAX_TOF = 3.0f;           // Seconds
+const double Bullet::DEFAULT_TGT_HIT_RANGE = 10.0;     // Meters
+const double Bullet::DEFAULT_LF_HIT_RANGE = 1.0;       // Meters
 
 int Bullet::getCategory() const               { return (GRAVITY); }
 const char* Bullet::getDescription() const    { return "Bullets"; }
@@ -37,8 +38,10 @@ void Bullet::copyData(const Bullet& org, const bool)
 
    nbt = 0;
    hitPlayer = nullptr;
+   burstDt = 0;
 
    for (int i = 0; i < MBT; i++) {
+      bursts[i].bPos0 = org.bursts[i].bPos0;
       bursts[i].bPos = org.bursts[i].bPos;
       bursts[i].bVel = org.bursts[i].bVel;
       bursts[i].bTof = org.bursts[i].bTof;
@@ -66,6 +69,39 @@ void Bullet::reset()
    setHitPlayer(nullptr);
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our burst trajectories and the player we hit
+//------------------------------------------------------------------------------
+void Bullet::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(nbt);
+   for (int i = 0; i < nbt; i++) {
+      cp->put(bursts[i]);
+   }
+   cp->put(burstDt);
+   WorldModel::savePlayerName(cp, hitPlayer);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Bullet::restoreState(base::Checkpoint::Reader* const rd)
+{
+   Player* hp = nullptr;
+   bool ok = rd->beginSection() && rd->get(&nbt) && nbt >= 0 && nbt <= MBT;
+   for (int i = 0; ok && i < nbt; i++) {
+      ok = rd->get(&bursts[i]);
+   }
+   ok = ok && rd->get(&burstDt);
+   ok = ok && getWorldModel() != nullptr && getWorldModel()->restorePlayerName(rd, &hp);
+   ok = rd->endSection() && ok;
+   if (!ok) nbt = 0;
+   setHitPlayer(hp);
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // weaponDynamics() -- Bullet dynamics
 //------------------------------------------------------------------------------
@@ -147,6 +183,7 @@ void Bullet::resetBurstTrajectories()
 bool Bullet::burstOfBullets(const base::Vec3d* const pos, const base::Vec3d* const vel, const int num, const int rate, const int e)
 {
    if (nbt < MBT && pos != nullptr && vel != nullptr) {
+      bursts[nbt].bPos0 = *pos; // Burst positions at the start of the frame -- world (m)
       bursts[nbt].bPos = *pos;  // Burst positions -- world  (m)
       bursts[nbt].bVel = *vel;  // Burst velocities -- world (m)
       bursts[nbt].bTof = 0;    // Burst time of flight      (sec)
@@ -166,9 +203,12 @@ void Bullet::updateBurstTrajectories(const double dt)
 {
    static const double g = base::ETHG * base::distance::FT2M;      // Acceleration of Gravity (m/s/s)
 
+   burstDt = dt;
+
    // For all active bursts
    for (int i = 0; i < nbt; i++) {
       if (bursts[i].bStatus == Burst::ACTIVE) {
+         bursts[i].bPos0 = bursts[i].bPos;                                         // start of the swept segment
          bursts[i].bVel[Player::IDOWN] = bursts[i].bVel[Player::IDOWN] + (g*dt);  // falling bullets
 
          bursts[i].bPos = bursts[i].bPos + (bursts[i].bVel * dt);
@@ -177,77 +217,118 @@ void Bullet::updateBurstTrajectories(const double dt)
    }
 }
 
+//------------------------------------------------------------------------------
+// sweptHitRange() -- Returns the range (m) from the point 'c' to the closest
+// point on the line segment from 'p0' to 'p1'.  The segment parameter [ 0 .. 1 ]
+// of the closest point is returned in 't'.
+//------------------------------------------------------------------------------
+double Bullet::sweptHitRange(const base::Vec3d& p0, const base::Vec3d& p1, const base::Vec3d& c, double* const t)
+{
+   const base::Vec3d d = p1 - p0;
+   const base::Vec3d w = c - p0;
+   const double dd = d * d;
+
+   double s = 0.0;
+   if (dd > 0.0) {
+      s = (w * d) / dd;
+      if (s < 0.0) s = 0.0;
+      else if (s > 1.0) s = 1.0;
+   }
+   *t = s;
+
+   const base::Vec3d r = w - (d * s);
+   return r.length();
+}
+
 //------------------------------------------------------------------------------
 // checkForTargetHit() -- check to see if we hit anything
 //------------------------------------------------------------------------------
 bool Bullet::checkForTargetHit()
 {
-   Player* ownship = getLaunchVehicle();
+   // Our target, or the shared candidates (all active life forms)
+   BulletHitIndex::Candidate tgtCandidate;
+   const BulletHitIndex::Candidate* candidates = nullptr;
+   unsigned int n = 0;
+   double radius = DEFAULT_LF_HIT_RANGE;
+   double maxNorthSpeed = 0.0;
+   const BulletHitIndex* index = nullptr;
+
    Player* tgt = getTargetPlayer();
-   if (ownship != nullptr && tgt != nullptr) {
-      base::Vec3d osPos = tgt->getPosition();
+   if (tgt != nullptr) {
+      tgtCandidate.player = tgt;
+      tgtCandidate.vel = tgt->getVelocity();
+      tgtCandidate.pos = tgt->getPosition() - (tgtCandidate.vel * burstDt);
+      candidates = &tgtCandidate;
+      n = 1;
+      radius = DEFAULT_TGT_HIT_RANGE;
+      maxNorthSpeed = std::fabs(tgtCandidate.vel[Player::INORTH]);
+   }
+   else {
+      WorldModel* sim = getWorldModel();
+      if (sim != nullptr) index = sim->getBulletHitIndex();
+      if (index != nullptr) {
+         candidates = index->getCandidates();
+         n = index->getNumCandidates();
+         maxNorthSpeed = index->getMaxNorthSpeed();
+      }
+   }
+   if (n == 0) return false;
 
-      // For all active bursts ...
-      for (int i = 0; i < nbt; i++) {
-         if (bursts[i].bStatus == Burst::ACTIVE) {
+   const Player* ownship = getLaunchVehicle();
+   const base::Vec3d origin(0, 0, 0);
+   const double margin = radius + maxNorthSpeed * burstDt;
 
-            // Check if we're within range of the target
-            base::Vec3d rPos = bursts[i].bPos - osPos;
-            double rng = rPos.length();
-            if (rng < 10.0) {
-               // Yes -- it's a hit!
-               bursts[i].bStatus = Burst::HIT;
-               setHitPlayer(tgt);
-               setLocationOfDetonation();
-               tgt->processDetonation(rng,this);
-            }
+   bool hit = false;
 
+   // For all active bursts ...
+   for (int i = 0; i < nbt; i++) {
+      if (bursts[i].bStatus != Burst::ACTIVE) continue;
+
+      const base::Vec3d& p0 = bursts[i].bPos0;
+      const base::Vec3d& p1 = bursts[i].bPos;
+
+      // North extent of this burst's swept segment, plus the candidates' motion
+      double nmin = p0[Player::INORTH];
+      double nmax = p1[Player::INORTH];
+      if (nmin > nmax) std::swap(nmin, nmax);
+      nmin -= margin;
+      nmax += margin;
+
+      // First candidate within the north extent
+      unsigned int j = (index != nullptr ? index->lowerBound(nmin) : 0);
+
+      // Find the closest candidate hit along the segment, relative to the
+      // candidate's motion over the frame
+      const BulletHitIndex::Candidate* hc = nullptr;
+      double hcT = 2.0;
+      double hcRng = 0.0;
+      for ( ; j < n && candidates[j].pos[Player::INORTH] <= nmax; j++) {
+         const BulletHitIndex::Candidate& c = candidates[j];
+         if (c.player == ownship || c.player == this) continue;
+
+         const base::Vec3d r0 = p0 - c.pos;
+         const base::Vec3d r1 = p1 - (c.pos + (c.vel * burstDt));
+         double t = 0.0;
+         const double rng = sweptHitRange(r0, r1, origin, &t);
+         if (rng < radius && t < hcT) {
+            hc = &c;
+            hcT = t;
+            hcRng = rng;
          }
       }
-   }
-   // if we are just flying along, check our range to the nearest player and tell him we killed it
-   else {
-        //base::Vec3 old = getEulerAngles();
-        base::Vec3d myPos = getPosition();
-        base::Vec3d tgtPos;
-        base::Vec3d vecPos;
-        //double az = 0;
-        //double el = 0;
-        double range = 0;
-        //double diffAz = 0;
-        //double diffEl = 0;
-        double maxRange = 1; // close range of detonation
-        WorldModel* sim = getWorldModel();
-        if (sim != nullptr) {
-            base::PairStream* players = sim->getPlayers();
-            if (players != nullptr) {
-                base::List::Item* item = players->getFirstItem();
-                while (item != nullptr) {
-                    const auto pair = static_cast<base::Pair*>(item->getValue());
-                    if (pair != nullptr) {
-                        const auto player = dynamic_cast<Player*>(pair->object());
-                        if (player != nullptr && player != ownship && player->isMajorType(LIFE_FORM) && !player->isDestroyed()) {
-                            // ok, calculate our position from this guy
-                            tgtPos = player->getPosition();
-                            vecPos = tgtPos - myPos;
-                            //az = std::atan2(vecPos.y(), vecPos.x());
-                            range = (vecPos.x() * vecPos.x() + vecPos.y() * vecPos.y());
-                            range = std::sqrt(range);
-                            if (range < maxRange) {
-                                // tell this target we hit it
-                                player->processDetonation(range, this);
-                            }
-                        }
-                    }
-                    item = item->getNext();
-                }
-                players->unref();
-                players = nullptr;
-            }
-        }
 
+      if (hc != nullptr) {
+         // Yes -- it's a hit!
+         bursts[i].bStatus = Burst::HIT;
+         bursts[i].bPos = p0 + ((p1 - p0) * hcT);
+         setHitPlayer(hc->player);
+         setLocationOfDetonation();
+         hc->player->processDetonation(hcRng, this);
+         hit = true;
+      }
    }
-   return false;
+
+   return hit;
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,62 @@
+
+#include "openeaagles/models/player/BulletHitIndex.hpp"
+
+#include "openeaagles/models/player/Player.hpp"
+
+#include "openeaagles/base/PairStream.hpp"
+#include "openeaagles/base/Pair.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace oe {
+namespace models {
+
+//------------------------------------------------------------------------------
+// update() -- collect the active life forms and sort them by their north positions
+//------------------------------------------------------------------------------
+void BulletHitIndex::update(base::PairStream* const playerList)
+{
+   clear();
+   if (playerList == nullptr) return;
+
+   base::List::Item* item = playerList->getFirstItem();
+   while (item != nullptr) {
+      const auto pair = static_cast<base::Pair*>(item->getValue());
+      const auto p = dynamic_cast<Player*>(pair->object());
+      if (p != nullptr && p->isMajorType(Player::LIFE_FORM) && p->isActive() && !p->isDestroyed()) {
+         Candidate c;
+         c.player = p;
+         c.pos = p->getPosition();
+         c.vel = p->getVelocity();
+         candidates.push_back(c);
+         const double vn = std::fabs(c.vel[Player::INORTH]);
+         if (vn > maxNorthSpeed) maxNorthSpeed = vn;
+      }
+      item = item->getNext();
+   }
+
+   if (candidates.size() > 1) {
+      std::sort(candidates.begin(), candidates.end(),
+         [](const Candidate& a, const Candidate& b) { return a.pos[Player::INORTH] < b.pos[Player::INORTH]; } );
+   }
+}
+
+void BulletHitIndex::clear()
+{
+   candidates.clear();
+   maxNorthSpeed = 0.0;
+}
+
+//------------------------------------------------------------------------------
+// lowerBound() -- index of the first candidate at or north of 'north'
+//------------------------------------------------------------------------------
+unsigned int BulletHitIndex::lowerBound(const double north) const
+{
+   const auto it = std::lower_bound(candidates.begin(), candidates.end(), north,
+      [](const Candidate& a, const double v) { return a.pos[Player::INORTH] < v; } );
+   return static_cast<unsigned int>(it - candidates.begin());
+}
+
+}
+}
@@ -99,6 +99,32 @@ void Missile::reset()
    BaseClass::reset();
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- target range and flight commands
+//------------------------------------------------------------------------------
+void Missile::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(trng);
+   cp->put(trngT);
+   cp->put(trdot);
+   cp->put(trdotT);
+   cp->put(cmdPitch);
+   cp->put(cmdHeading);
+   cp->put(cmdVelocity);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Missile::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&trng) && rd->get(&trngT) && rd->get(&trdot) && rd->get(&trdotT) && rd->get(&cmdPitch) && rd->get(&cmdHeading) && rd->get(&cmdVelocity);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // atReleaseInit() -- Init weapon data at release
 //------------------------------------------------------------------------------
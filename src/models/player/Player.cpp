@@ -51,6 +51,9 @@ namespace models {
 
 IMPLEMENT_SUBCLASS(Player, "Player")
 
+// The player whose time-critical frame is running in this thread
+static thread_local const Player* tcPlayer = nullptr;
+
 BEGIN_SLOTTABLE(Player)
    // Player's initial position relative to the simulation's reference point
    "initXPos",          //  1) Initial X position    (meters, base::Distance)
@@ -425,6 +428,8 @@ void Player::deleteData()
    for (unsigned int i = 0; i < MAX_RF_REFLECTIONS; i++) {
       if (rfReflect[i] != nullptr) { rfReflect[i]->unref(); rfReflect[i] = nullptr; }
    }
+
+   clearRfEmissions();
 }
 
 //------------------------------------------------------------------------------
@@ -436,6 +441,8 @@ bool Player::shutdownNotification()
       if (rfReflect[i] != nullptr) { rfReflect[i]->unref(); rfReflect[i] = nullptr; }
    }
 
+   clearRfEmissions();
+
    return BaseClass::shutdownNotification();
 }
 
@@ -460,6 +467,8 @@ void Player::reset()
    updateSystemPointers();
    loadSysPtrs = false;
 
+   clearRfEmissions();
+
    if (isLocalPlayer()) {
 
       // ---
@@ -517,6 +526,14 @@ void Player::reset()
       syncState2Ready = false;
    }
 
+   // Full fidelity
+   lowFidelity = false;
+   lodDt = 0.0;
+   lodDataDt = 0.0;
+
+   // Signatures (e.g., compiled RCS tables)
+   if (signature != nullptr) signature->reset();
+
    // ---
    // Reset our base class
    // -- Do this last because it sends reset pulses to our components and
@@ -525,6 +542,106 @@ void Player::reset()
    BaseClass::reset();
 }
 
+//------------------------------------------------------------------------------
+// saveState() -- save our dynamic state: position, velocities, orientation,
+// damage and freeze flags (see base::Checkpoint)
+//------------------------------------------------------------------------------
+void Player::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+
+   cp->put(useCoordSys);
+   cp->put(useCoordSysN1);
+   cp->put(latitude);
+   cp->put(longitude);
+   cp->put(altitude);
+
+   const base::Vec3d* const vec3[] = {
+      &posVecNED, &posVecECEF, &velVecNED, &velVecECEF, &velVecBody, &velVecN1,
+      &accelVecNED, &accelVecECEF, &accelVecBody, &angles, &anglesW, &angularVel, &gcAngVel
+   };
+   for (const base::Vec3d* v : vec3) cp->putDoubles(v->ptr(), 3);
+
+   const base::Vec2d* const vec2[] = { &scPhi, &scTheta, &scPsi, &scPhiW, &scThetaW, &scPsiW };
+   for (const base::Vec2d* v : vec2) cp->putDoubles(v->ptr(), 2);
+
+   cp->putDoubles(q._v, 4);
+   cp->putDoubles(rm.ptr(), 16);
+   cp->putDoubles(wm.ptr(), 16);
+   cp->putDoubles(rmW2B.ptr(), 16);
+
+   cp->put(vp);
+   cp->put(gndSpd);
+   cp->put(gndTrk);
+   cp->put(tElev);
+   cp->put(tElevValid);
+   cp->put(posVecValid);
+   cp->put(altSlaved);
+   cp->put(posSlaved);
+   cp->put(posFrz);
+   cp->put(altFrz);
+   cp->put(attFrz);
+   cp->put(fuelFrz);
+
+   cp->put(camouflage);
+   cp->put(damage);
+   cp->put(smoking);
+   cp->put(flames);
+   cp->put(justKilled);
+   cp->put(killedBy);
+
+   cp->put(dataLogTimer);
+
+   cp->put(lowFidelity);
+   cp->put(lodDt);
+   cp->put(lodDataDt);
+
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+//------------------------------------------------------------------------------
+// restoreState() -- restore our dynamic state (see saveState())
+//------------------------------------------------------------------------------
+bool Player::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection();
+
+   ok = ok && rd->get(&useCoordSys) && rd->get(&useCoordSysN1);
+   ok = ok && rd->get(&latitude) && rd->get(&longitude) && rd->get(&altitude);
+
+   base::Vec3d* const vec3[] = {
+      &posVecNED, &posVecECEF, &velVecNED, &velVecECEF, &velVecBody, &velVecN1,
+      &accelVecNED, &accelVecECEF, &accelVecBody, &angles, &anglesW, &angularVel, &gcAngVel
+   };
+   for (base::Vec3d* v : vec3) ok = ok && rd->getDoubles(v->ptr(), 3);
+
+   base::Vec2d* const vec2[] = { &scPhi, &scTheta, &scPsi, &scPhiW, &scThetaW, &scPsiW };
+   for (base::Vec2d* v : vec2) ok = ok && rd->getDoubles(v->ptr(), 2);
+
+   ok = ok && rd->getDoubles(q._v, 4);
+   ok = ok && rd->getDoubles(rm.ptr(), 16);
+   ok = ok && rd->getDoubles(wm.ptr(), 16);
+   ok = ok && rd->getDoubles(rmW2B.ptr(), 16);
+
+   ok = ok && rd->get(&vp) && rd->get(&gndSpd) && rd->get(&gndTrk);
+   ok = ok && rd->get(&tElev) && rd->get(&tElevValid) && rd->get(&posVecValid);
+   ok = ok && rd->get(&altSlaved) && rd->get(&posSlaved);
+   ok = ok && rd->get(&posFrz) && rd->get(&altFrz) && rd->get(&attFrz) && rd->get(&fuelFrz);
+
+   ok = ok && rd->get(&camouflage) && rd->get(&damage) && rd->get(&smoking) && rd->get(&flames);
+   ok = ok && rd->get(&justKilled) && rd->get(&killedBy);
+
+   ok = ok && rd->get(&dataLogTimer);
+
+   ok = ok && rd->get(&lowFidelity) && rd->get(&lodDt) && rd->get(&lodDataDt);
+
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // updateTC() -- update time critical stuff here
 //------------------------------------------------------------------------------
@@ -536,6 +653,13 @@ void Player::updateTC(const double dt0)
       loadSysPtrs = false;
    }
 
+   // Our time-critical frame is running in this thread (see isInTcFrame())
+   const Player* const prevTcPlayer = tcPlayer;
+   tcPlayer = this;
+
+   // Receive the RF emissions that have been delivered to us
+   if (!rfInbox.empty()) processRfInbox();
+
    if (mode == ACTIVE || mode == PRE_RELEASE) {
 
       // ---
@@ -611,10 +735,25 @@ void Player::updateTC(const double dt0)
       //     sms and obc) are updated by our call to BaseClass:updateTC()
       //  b) We're calling BaseClass::updateTC() class because we want to update
       //     our player dynamics, etc before our subsystems.
+      //  c) While we're low fidelity, our subsystems are suspended, except for
+      //     our R/F emitters, and their first frame after we're promoted
+      //     includes the suspended time.
       // ---
-      BaseClass::updateTC(dt);
+      if (lowFidelity) {
+         if (getWorldModel()->phase() == 0) lodDt += dt;
+         updateSubcomponentsTC(dt, -1.0);
+      }
+      else if (lodDt > 0.0) {
+         updateSubcomponentsTC(dt, dt + lodDt);
+         if (getWorldModel()->phase() == 3) lodDt = 0.0;
+      }
+      else {
+         BaseClass::updateTC(dt);
+      }
 
    }
+
+   tcPlayer = prevTcPlayer;
 }
 
 //------------------------------------------------------------------------------
@@ -635,9 +774,61 @@ void Player::updateData(const double dt)
 
       // ---
       // Note: our subsystems in the components list (e.g., pilot, nav, sms and obc) are updated
-      // by our call to BaseClass:updateData()
+      // by our call to BaseClass:updateData(), unless they're suspended (low fidelity)
       // ---
-      BaseClass::updateData(dt);
+      if (lowFidelity) {
+         lodDataDt += dt;
+         updateSubcomponentsData(dt, -1.0);
+      }
+      else if (lodDataDt > 0.0) {
+         updateSubcomponentsData(dt, dt + lodDataDt);
+         lodDataDt = 0.0;
+      }
+      else {
+         BaseClass::updateData(dt);
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// updateSubcomponentsTC(), updateSubcomponentsData() -- level of detail:
+// updates our R/F emitters (our top level sensor and antenna models) using
+// 'dt', and our other subcomponents using 'dtOthers', or not at all if it's
+// less than zero (they're suspended)
+//------------------------------------------------------------------------------
+void Player::updateSubcomponentsTC(const double dt, const double dtOthers)
+{
+   base::PairStream* subcomponents = getComponents();
+   if (subcomponents != nullptr) {
+      const base::Component* const rfSensor = getSensor();
+      const base::Component* const rfGimbal = getGimbal();
+      base::List::Item* item = subcomponents->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         const auto obj = static_cast<base::Component*>(pair->object());
+         if (obj == rfSensor || obj == rfGimbal) obj->tcFrame(dt);
+         else if (dtOthers >= 0.0) obj->tcFrame(dtOthers);
+         item = item->getNext();
+      }
+      subcomponents->unref();
+   }
+}
+
+void Player::updateSubcomponentsData(const double dt, const double dtOthers)
+{
+   base::PairStream* subcomponents = getComponents();
+   if (subcomponents != nullptr) {
+      const base::Component* const rfSensor = getSensor();
+      const base::Component* const rfGimbal = getGimbal();
+      base::List::Item* item = subcomponents->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         const auto obj = static_cast<base::Component*>(pair->object());
+         if (obj == rfSensor || obj == rfGimbal) obj->dataFrame(dt);
+         else if (dtOthers >= 0.0) obj->dataFrame(dtOthers);
+         item = item->getNext();
+      }
+      subcomponents->unref();
    }
 }
 
@@ -1574,6 +1765,18 @@ base::Pair* Player::getIrSystemByType(const std::type_info& type)
    return p;
 }
 
+// Player's RCS signature
+RfSignature* Player::getSignature()
+{
+   return signature;
+}
+
+// Player's RCS signature (const version)
+const RfSignature* Player::getSignature() const
+{
+   return signature;
+}
+
 //------------------------------------------------------------------------------
 // Set functions
 //------------------------------------------------------------------------------
@@ -1844,6 +2047,7 @@ bool Player::setPosition(const double n, const double e, const double d, const b
 
    // Set the position vector relative to sim ref pt
    posVecNED.set(n, e, d);
+   geodPending = false;
 
    // The position vector is valid if the gaming area range is unlimited (zero) or
    // if the vector's length is less than or equal the max range.
@@ -1908,6 +2112,7 @@ bool Player::setPositionLLA(const double lat, const double lon, const double alt
    latitude = lat;
    longitude = lon;
    altitude = alt;
+   geodPending = false;
 
    // compute the world matrix
    base::nav::computeWorldMatrix(latitude, longitude, &wm);
@@ -1953,6 +2158,7 @@ bool Player::setGeocPosition(const base::Vec3d& pos, const bool slaved)
 
    // Set the geocentric position
    posVecECEF = pos;
+   geodPending = false;
 
    // Compute & set the geodetic position
    double ecef[3] = { posVecECEF[0], posVecECEF[1], posVecECEF[2] };
@@ -1990,6 +2196,34 @@ bool Player::setGeocPosition(const base::Vec3d& pos, const bool slaved)
    return true;
 }
 
+// Completes a batched geodetic update; the geodetic position, world matrix and
+// gaming area position vector were computed from our ECEF position
+void Player::batchGeodeticUpdate(const base::Vec3d& lla, const base::Matrixd& wm0, const base::Vec3d& posNED)
+{
+   if (!geodPending) return;
+   geodPending = false;
+
+   // Set the geodetic position
+   latitude = lla[base::nav::ILAT];
+   longitude = lla[base::nav::ILON];
+   altitude = lla[base::nav::IALT];
+
+   // Set the world matrix and the body/ECEF directional cosines
+   wm = wm0;
+   rmW2B = rm * wm;
+
+   // Set the position vector relative to sim ref pt
+   posVecNED = posNED;
+   const double maxRefRange = getWorldModel()->getMaxRefRange();
+   posVecValid = (maxRefRange <= 0.0) || (posVecNED.length2() <= (maxRefRange*maxRefRange));
+
+   // Check for ground collisions (see dynamics())
+   if (getAltitudeAgl() < 0.0 && isMajorType(AIR_VEHICLE | WEAPON | SPACE_VEHICLE)) {
+      // We're below the ground!
+      this->event(CRASH_EVENT,nullptr);
+   }
+}
+
 
 // Sets Euler angles: (rad) [ roll pitch yaw ]
 bool Player::setEulerAngles(const double r, const double p, const double y)
@@ -2585,6 +2819,32 @@ bool Player::onRfEmissionEventPlayer(Emission* const em)
    // Player must be active ...
    if (isNotMode(ACTIVE)) return false;
 
+   // 1) thru 5)
+   rfReflectEmission(em);
+
+   // 6) and 7)
+   rfReceiveEmission(em);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// RF channel functions (see "RF emissions and the RF channel" in Player.hpp)
+//------------------------------------------------------------------------------
+
+// True if called from our running time-critical frame
+bool Player::isInTcFrame() const
+{
+   return (tcPlayer == this);
+}
+
+// Reflects an emission that's hitting us -- onRfEmissionEventPlayer() steps
+// 1) thru 5); called from the transmitter's thread
+bool Player::rfReflectEmission(Emission* const em)
+{
+   // Player must be active ...
+   if (isNotMode(ACTIVE)) return false;
+
    // ---
    //  1) Compute the Line-Of-Sight vectors back to the transmitter (los0)
    // ---
@@ -2626,8 +2886,18 @@ bool Player::onRfEmissionEventPlayer(Emission* const em)
       em->getGimbal()->event(RF_EMISSION_RETURN,em);
    }
 
-   // 6) Pass the emission to our antennas
-   {
+   return true;
+}
+
+// Passes an emission that's hitting us to our antennas and to anyone requesting
+// reflected emissions -- onRfEmissionEventPlayer() steps 6) and 7)
+bool Player::rfReceiveEmission(Emission* const em)
+{
+   // Player must be active ...
+   if (isNotMode(ACTIVE)) return false;
+
+   // 6) Pass the emission to our antennas (unless they're suspended)
+   if (!lowFidelity) {
       Gimbal* g = getGimbal();
       if (g != nullptr && g->getPowerSwitch() != System::PWR_OFF) {
          g->event(RF_EMISSION,em);
@@ -2644,6 +2914,56 @@ bool Player::onRfEmissionEventPlayer(Emission* const em)
    return true;
 }
 
+// Demotes (true) or promotes (false) the player (see "Level of detail" in Player.hpp);
+// called by the world model, when no player is being updated
+bool Player::setLowFidelity(const bool flg)
+{
+   lowFidelity = flg;
+   return true;
+}
+
+// Puts an emission, transmitted by us during our time-critical frame, on our RF outbox
+void Player::rfSendEmission(Emission* const em)
+{
+   if (em != nullptr && em->getTarget() != nullptr) {
+      em->ref();
+      rfOutbox.push_back(em);
+   }
+}
+
+// Moves the emissions on our RF outbox, in order, to their targets' RF inboxes;
+// called by the world model between phases, when no player is being updated
+void Player::rfPartitionEmissions()
+{
+   for (Emission* em : rfOutbox) {
+      em->getTarget()->rfInbox.push_back(em);
+   }
+   rfOutbox.clear();
+}
+
+// Receives, in order, the emissions on our RF inbox
+void Player::processRfInbox()
+{
+   for (Emission* em : rfInbox) {
+      rfReceiveEmission(em);
+      em->unref();
+   }
+   rfInbox.clear();
+}
+
+// Clears our RF outbox and inbox
+void Player::clearRfEmissions()
+{
+   for (Emission* em : rfOutbox) {
+      em->unref();
+   }
+   rfOutbox.clear();
+   for (Emission* em : rfInbox) {
+      em->unref();
+   }
+   rfInbox.clear();
+}
+
 //------------------------------------------------------------------------------
 // onRfReflectedEmissionEventPlayer() -- process reflected R/F Emission events
 //
@@ -2794,8 +3114,9 @@ void Player::dynamics(const double dt)
    // Local player ...
    // ---
    if (isLocalPlayer()) {
-      // Update the external dynamics model (if any)
-      if (getDynamicsModel() != nullptr) {
+      // Update the external dynamics model (if any), unless we're a
+      // low fidelity, kinematic proxy
+      if (getDynamicsModel() != nullptr && !lowFidelity) {
          // If we have a dynamics model ...
          getDynamicsModel()->freeze( isFrozen() );
          getDynamicsModel()->dynamics(dt);
@@ -2833,9 +3154,9 @@ void Player::dynamics(const double dt)
       }
 
       // ---
-      // Check for ground collisions
+      // Check for ground collisions (or in batchGeodeticUpdate())
       // ---
-      if (getAltitudeAgl() < 0.0 && isLocalPlayer() && isMajorType(AIR_VEHICLE | WEAPON | SPACE_VEHICLE)) {
+      if (!geodPending && getAltitudeAgl() < 0.0 && isLocalPlayer() && isMajorType(AIR_VEHICLE | WEAPON | SPACE_VEHICLE)) {
          // We're below the ground!
          this->event(CRASH_EVENT,nullptr);
       }
@@ -3025,7 +3346,15 @@ void Player::positionUpdate(const double dt)
             // Update our position
             base::Vec3d newPosVecECEF = posVecECEF + (velVecECEF + velVecN1) * 0.5 * dt;
 
-            if (!gcEnabled) {
+            if (!gcEnabled && getWorldModel()->isBatchGeodeticUpdate()) {
+               // Set our ECEF position; the rest is set by batchGeodeticUpdate()
+               posVecECEF = newPosVecECEF;
+               altSlaved = false;
+               posSlaved = false;
+               geodPending = true;
+            }
+
+            else if (!gcEnabled) {
                // Set the our position
                setGeocPosition(newPosVecECEF);
             }
@@ -531,8 +531,15 @@ void Antenna::rfTransmit(Emission* const xmit)
                em->setPolarization(getPolarization());
                em->setLocalPlayersOnly( isLocalPlayersOfInterestOnly() );
 
-               // c) Send the emission to the target
-               targets[i]->event(RF_EMISSION, em);
+               // c) Send the emission to the target: during our player's time-critical
+               //    frame, the target reflects it now, and it's received by the target
+               //    from the RF channel (see Player.hpp); otherwise, send the event.
+               if (ownship->isInTcFrame()) {
+                  if (targets[i]->rfReflectEmission(em)) ownship->rfSendEmission(em);
+               }
+               else {
+                  targets[i]->event(RF_EMISSION, em);
+               }
 
                // d) Recycle the emission (we don't bother)
                //bool recycled = false;
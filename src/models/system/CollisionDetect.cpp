@@ -2,6 +2,7 @@
 #include "openeaagles/models/system/CollisionDetect.hpp"
 #include "openeaagles/models/player/Player.hpp"
 #include "openeaagles/models/WorldModel.hpp"
+#include "openeaagles/models/Tdb.hpp"
 
 #include "openeaagles/base/Number.hpp"
 #include "openeaagles/base/Pair.hpp"
@@ -10,6 +11,7 @@
 #include "openeaagles/base/units/Distances.hpp"
 
 #include <cmath>
+#include <cfloat>
 
 namespace oe {
 namespace models {
@@ -188,11 +190,25 @@ void CollisionDetect::updateData(const double dt)
    }
 
    // ---
-   // Scan the player list ---
+   // Scan the player list --- gather the candidate players and their
+   // ownship to candidate LOS vectors
    // ---
    base::PairStream* plist = sim->getPlayers();
    if (plist != nullptr) {
 
+      const unsigned int nplayers = plist->entries();
+      if (cTargets.size() < nplayers) {
+         cTargets.resize(nplayers);
+         cx.resize(nplayers);
+         cy.resize(nplayers);
+         cz.resize(nplayers);
+         cRanges.resize(nplayers);
+         cTanAngs.resize(nplayers);
+         cInRange.resize(nplayers);
+         cVisible.resize(nplayers);
+      }
+
+      unsigned int nc = 0;
       base::List::Item* item = plist->getFirstItem();
       bool finished = false;
       while ( item != nullptr && !finished ) {
@@ -224,52 +240,43 @@ void CollisionDetect::updateData(const double dt)
             }
 
             // Target Line-Of-Sight (LOS) vector
-            base::Vec3d los = (tgtPos - ownPos);
-
-            // Normalized and compute length:
-            const double range = los.normalize();
-
-            // In-range check; but only if max range is greater than zero
-            bool inRange = (maxRange2Players == 0.0);
-            if ( !inRange ) {
-               inRange = range <= maxRange2Players;
-            }
-
-            if (inRange) {
-
-               // Field of View (FOV) check; but only if the max FOV angle is
-               // greater than zero
-               bool inFov = (maxAngle2Players == 0.0);
-               if ( !inFov ) {
-
-                  // Transform the LOS vector to local tangent plane NED
-                  base::Vec3d losNED = los;
-                  if (usingEcefFlg) {
-                     // LOS vector: ECEF to NED
-                     losNED = wm * los;
-                  }
-
-                  // Transform the LOS vector from NED to body coordinates
-                  base::Vec3d losBody = rm * losNED;
+            const base::Vec3d los = (tgtPos - ownPos);
 
-                  // It's within our max FOV angle when the X component is
-                  // greater than the cosine of the max FOV angle.
-                  inFov = (losBody.x() >= cosMaxFovAngle);
-               }
-
-               if (inFov) {
-                  // If we are here then we have a target player that's active,
-                  // the correct type, in-range and within our max FOV ...
-                  // so update our POI list with it.
-                  updatePoiList(target);
-               }
-            }
+            cTargets[nc] = target;
+            cx[nc] = los.x();
+            cy[nc] = los.y();
+            cz[nc] = los.z();
+            nc++;
          }
 
          // Next player ...
          item = item->getNext();
       }
 
+      // ---
+      // Range and Field of View (FOV) checks, but only if the max range and
+      // max FOV angle are greater than zero (no horizon check)
+      // ---
+      const base::Matrixd im;    // identity: our LOS vectors are already NED
+      Tdb::cullLosArray(
+         cx.data(), cy.data(), cz.data(), nc,
+         (usingEcefFlg ? wm : im),
+         rm,
+         (maxRange2Players == 0.0 ? DBL_MAX : maxRange2Players),
+         DBL_MAX, 0.0,
+         (maxAngle2Players == 0.0 ? -DBL_MAX : cosMaxFovAngle),
+         cRanges.data(), cTanAngs.data(), cInRange.data(), cVisible.data()
+      );
+
+      for (unsigned int i = 0; i < nc; i++) {
+         if (cVisible[i]) {
+            // If we are here then we have a target player that's active,
+            // the correct type, in-range and within our max FOV ...
+            // so update our POI list with it.
+            updatePoiList(cTargets[i]);
+         }
+      }
+
       // Unref the player list
       plist->unref();
    }
@@ -61,6 +61,26 @@ void ExternalStore::reset()
    jettisoned = false;
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our jettisoned flag
+//------------------------------------------------------------------------------
+void ExternalStore::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(jettisoned);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool ExternalStore::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&jettisoned);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // Event handlers
 //------------------------------------------------------------------------------
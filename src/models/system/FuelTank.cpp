@@ -45,6 +45,26 @@ void FuelTank::reset()
     fuelWt = initFuelWt;
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our fuel contents
+//------------------------------------------------------------------------------
+void FuelTank::saveState(base::Checkpoint* const cp) const
+{
+    cp->beginSection();
+    cp->put(fuelWt);
+    cp->endSection();
+
+    BaseClass::saveState(cp);
+}
+
+bool FuelTank::restoreState(base::Checkpoint::Reader* const rd)
+{
+    bool ok = rd->beginSection() && rd->get(&fuelWt);
+    ok = rd->endSection() && ok;
+
+    return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // Tank capacity (lb) functions
 //------------------------------------------------------------------------------
@@ -69,6 +69,7 @@ BEGIN_SLOTTABLE(Gimbal)
     "localPlayersOfInterestOnly",   // 34: Sets the local only players of interest flag (default: false)
     "useWorldCoordinates",          // 35: Using player of interest's world (ECEF) coordinate system
     "ownHeadingOnly",               // 36: Whether only the ownship heading is used by the target data block
+    "maxClosureRate2PlayersOfInterest", // 37: Max closure rate to players of interest or zero (m/s) (default: 0)
 END_SLOTTABLE(Gimbal)
 
 BEGIN_SLOT_MAP(Gimbal)
@@ -120,6 +121,7 @@ BEGIN_SLOT_MAP(Gimbal)
 
     ON_SLOT(35, setSlotUseWorldCoordinates, base::Number)                // Using player of interest's world (ECEF) coordinate system
     ON_SLOT(36,setSlotUseOwnHeadingOnly,base::Number)
+    ON_SLOT(37, setSlotMaxClosureRate2PlayersOfInterest, base::Number)   // Max closure rate to players of interest or zero (m/s)
 END_SLOT_MAP()
 
 BEGIN_EVENT_HANDLER(Gimbal)
@@ -187,13 +189,16 @@ void Gimbal::copyData(const Gimbal& org, const bool cc)
    ownHeadingOnly = org.ownHeadingOnly;
    playerTypes = org.playerTypes;
    maxPlayers = org.maxPlayers;
+   maxClosureRate = org.maxClosureRate;
 
    tdb = nullptr;
+   clearTdbPool();
 }
 
 void Gimbal::deleteData()
 {
    tdb = nullptr;
+   clearTdbPool();
 }
 
 //------------------------------------------------------------------------------
@@ -205,15 +210,52 @@ void Gimbal::reset()
    cmdRate = initCmdRate;
    cmdPos = initCmdPos;
    updateMatrix();
+   clearTdbPool();   // and their out of range players
    BaseClass::reset();
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our servo state; the pooled target data
+// blocks are cleared on restore, so they're all rebuilt and their out of
+// range players are rechecked
+//------------------------------------------------------------------------------
+void Gimbal::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(servoMode);
+   cp->put(fastSlew);
+   cp->putDoubles(tm.ptr(), 16);
+   cp->putDoubles(pos.ptr(), 3);
+   cp->putDoubles(rate.ptr(), 3);
+   cp->putDoubles(cmdPos.ptr(), 3);
+   cp->putDoubles(cmdRate.ptr(), 3);
+   cp->put(atLimit);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Gimbal::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&servoMode) && rd->get(&fastSlew);
+   ok = ok && rd->getDoubles(tm.ptr(), 16);
+   ok = ok && rd->getDoubles(pos.ptr(), 3) && rd->getDoubles(rate.ptr(), 3);
+   ok = ok && rd->getDoubles(cmdPos.ptr(), 3) && rd->getDoubles(cmdRate.ptr(), 3);
+   ok = ok && rd->get(&atLimit);
+   ok = rd->endSection() && ok;
+
+   clearTdbPool();
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // shutdownNotification() -- Shutdown the simulation
 //------------------------------------------------------------------------------
 bool Gimbal::shutdownNotification()
 {
     tdb = nullptr;
+    clearTdbPool();
 
     return BaseClass::shutdownNotification();
 }
@@ -515,6 +557,7 @@ bool Gimbal::setPlayerOfInterestTypes(const unsigned int typeMask)
 bool Gimbal::setMaxPlayersOfInterest(const unsigned int n)
 {
    maxPlayers = n;
+   clearTdbPool();   // pooled TDBs are sized for the old max
    return true;
 }
 
@@ -525,6 +568,17 @@ bool Gimbal::setLocalPlayersOfInterestOnly(const bool flg)
    return true;
 }
 
+// Max closure rate to players of interest or zero (m/s)
+bool Gimbal::setMaxClosureRate2PlayersOfInterest(const double mps)
+{
+   bool ok = false;
+   if (mps >= 0.0) {
+      maxClosureRate = mps;
+      ok = true;
+   }
+   return ok;
+}
+
 // Sets the target terrain occulting enabled flag
 bool Gimbal::setTerrainOccultingEnabled(const bool flg)
 {
@@ -1198,6 +1252,16 @@ bool Gimbal::setSlotLocalPlayersOfInterestOnly(const base::Number* const msg)
    return ok;
 }
 
+// Max closure rate to players of interest or zero (m/s)
+bool Gimbal::setSlotMaxClosureRate2PlayersOfInterest(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setMaxClosureRate2PlayersOfInterest(msg->getReal());
+   }
+   return ok;
+}
+
 // Using player of interest's world (ECEF) coordinate system
 bool Gimbal::setSlotUseWorldCoordinates(const base::Number* const msg)
 {
@@ -1321,15 +1385,48 @@ void Gimbal::limitVec(base::Vec3d& vec, const base::Vec3d& ll, const base::Vec3d
 //------------------------------------------------------------------------------
 unsigned int Gimbal::processPlayersOfInterest(base::PairStream* const poi)
 {
-   const auto tdb0 = new Tdb(maxPlayers, this);
+   // Reuse a pooled TDB that only the pool is referencing (i.e., it's not our
+   // current TDB and no one is still using it), else add a new one to the pool
+   Tdb* tdb0 = nullptr;
+   for (unsigned int i = 0; i < TDB_POOL_SIZE && tdb0 == nullptr; i++) {
+      if (tdbPool[i] == nullptr) {
+         tdbPool[i] = new Tdb(maxPlayers, this);
+         tdb0 = tdbPool[i];
+      }
+      else if (tdbPool[i]->getRefCount() == 1) {
+         tdb0 = tdbPool[i];
+      }
+   }
 
-   unsigned int ntgts = tdb0->processPlayers(poi);
-   setCurrentTdb(tdb0);
-   tdb0->unref();
+   unsigned int ntgts = 0;
+   if (tdb0 != nullptr) {
+      ntgts = tdb0->processPlayers(poi);
+      setCurrentTdb(tdb0);
+   }
+   else {
+      // All pooled TDBs are still in use
+      const auto tdb1 = new Tdb(maxPlayers, this);
+      ntgts = tdb1->processPlayers(poi);
+      setCurrentTdb(tdb1);
+      tdb1->unref();
+   }
 
    return ntgts;
 }
 
+//------------------------------------------------------------------------------
+// Releases the pooled TDBs (users of the current TDB keep their references)
+//------------------------------------------------------------------------------
+void Gimbal::clearTdbPool()
+{
+   for (unsigned int i = 0; i < TDB_POOL_SIZE; i++) {
+      if (tdbPool[i] != nullptr) {
+         tdbPool[i]->unref();
+         tdbPool[i] = nullptr;
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // Returns the current TDB (pre-ref())
 //------------------------------------------------------------------------------
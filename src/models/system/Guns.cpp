@@ -121,6 +121,40 @@ void Gun::reset()
    reload();
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our firing state and our bullet type, which
+// is the initial weapon of our bullets (see Bullet)
+//------------------------------------------------------------------------------
+void Gun::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(shortBurstTimer);
+   cp->put(burstFrameTimer);
+   cp->put(rcount);
+   cp->put(rounds);
+   cp->put(fire);
+   cp->put(armed);
+
+   const Bullet* const b = getBulletType();
+   cp->put(b != nullptr);
+   if (b != nullptr) b->saveState(cp);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Gun::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool haveBullet {};
+   bool ok = rd->beginSection() && rd->get(&shortBurstTimer) && rd->get(&burstFrameTimer);
+   ok = ok && rd->get(&rcount) && rd->get(&rounds) && rd->get(&fire) && rd->get(&armed);
+   ok = ok && rd->get(&haveBullet) && (haveBullet == (getBulletType() != nullptr));
+   if (ok && haveBullet) ok = getBulletType()->restoreState(rd);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // reload() -- Reload the gun
 //------------------------------------------------------------------------------
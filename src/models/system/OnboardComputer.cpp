@@ -65,6 +65,16 @@ void OnboardComputer::reset()
    setNextToShoot(nullptr);
 }
 
+//------------------------------------------------------------------------------
+// restoreState() -- the tracks are replaced by the track managers, so our
+// next-to-shoot is found again, by its shoot list index, by updateShootList()
+//------------------------------------------------------------------------------
+bool OnboardComputer::restoreState(base::Checkpoint::Reader* const rd)
+{
+   setNextToShoot(nullptr);
+   return BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // process() -- Process phase
 //------------------------------------------------------------------------------
@@ -220,6 +230,13 @@ void OnboardComputer::updateShootList(const bool step)
             if (nts == trackList[i]) cNTS = i;
          }
       }
+      else {
+         // No next-to-shoot (e.g., after restoreState()), so keep
+         // the track that's first on the shoot list, if any
+         for (int i = 0; i < n && cNTS < 0; i++) {
+            if (trackList[i]->getShootListIndex() == 1) cNTS = i;
+         }
+      }
 
       // ---
       // Update the next to shoot?
@@ -3,6 +3,7 @@
 
 #include "openeaagles/models/player/Player.hpp"
 #include "openeaagles/models/system/Antenna.hpp"
+#include "openeaagles/models/system/RadarClutter.hpp"
 #include "openeaagles/models/system/TrackManager.hpp"
 #include "openeaagles/models/Emission.hpp"
 
@@ -10,6 +11,9 @@
 #include "openeaagles/base/Pair.hpp"
 #include "openeaagles/base/PairStream.hpp"
 
+#include "openeaagles/base/util/constants.hpp"
+#include "openeaagles/base/util/math_utils.hpp"
+
 #include <cmath>
 
 namespace oe {
@@ -19,10 +23,12 @@ IMPLEMENT_PARTIAL_SUBCLASS(Radar, "Radar")
 
 BEGIN_SLOTTABLE(Radar)
    "igain",    //  1: RF: Integrator gain (dB or no units; def: 1.0)
+   "clutter",  //  2: Terrain clutter model
 END_SLOTTABLE(Radar)
 
 BEGIN_SLOT_MAP(Radar)
-    ON_SLOT(1,  setSlotIGain, base::Number)
+    ON_SLOT(1,  setSlotIGain,   base::Number)
+    ON_SLOT(2,  setSlotClutter, RadarClutter)
 END_SLOT_MAP()
 
 Radar::Radar()
@@ -74,11 +80,20 @@ void Radar::copyData(const Radar& org, const bool)
    numberOfJammedEmissions = org.numberOfJammedEmissions;
 
    rfIGain = org.rfIGain;
+
+   if (org.clutter != nullptr) {
+      RadarClutter* copy = org.clutter->clone();
+      setSlotClutter( copy );
+      copy->unref();
+   } else {
+      setSlotClutter(nullptr);
+   }
 }
 
 void Radar::deleteData()
 {
    clearTracksAndQueues();
+   setSlotClutter(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -134,6 +149,40 @@ void Radar::reset()
 {
    BaseClass::reset();
    clearTracksAndQueues();
+   if (clutter != nullptr) clutter->reset();
+}
+
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our real-beam sweeps and jamming state; the
+// queued reports are from before the restore, so they're cleared, and the
+// clutter is recomputed
+//------------------------------------------------------------------------------
+void Radar::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(endOfScanFlg);
+   cp->put(csweep);
+   cp->put(sweeps);
+   cp->put(vclos);
+   cp->put(currentJamSignal);
+   cp->put(numberOfJammedEmissions);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Radar::restoreState(base::Checkpoint::Reader* const rd)
+{
+   clearTracksAndQueues();
+   if (clutter != nullptr) clutter->reset();
+
+   bool ok = rd->beginSection() && rd->get(&endOfScanFlg) && rd->get(&csweep);
+   ok = ok && rd->get(&sweeps) && rd->get(&vclos);
+   ok = ok && rd->get(&currentJamSignal) && rd->get(&numberOfJammedEmissions);
+   ok = ok && (csweep >= 0 && csweep < static_cast<int>(NUM_SWEEPS));
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
 }
 
 //------------------------------------------------------------------------------
@@ -202,116 +251,118 @@ void Radar::receive(const double dt)
    currentJamSignal = jamSignal * getRfReceiveLoss();
    int countNumJammedEm = 0;
 
-   // ---
-   // Process Returned Emissions
-   // ---
-
-   Emission* em = nullptr;
-   double signal = 0;
-
-   // Get an emission from the queue
-   base::lock(packetLock);
-   if (np > 0) {
-      np--; // Decrement 'np', now the array index
-      em = packets[np];
-      signal = signals[np];
+   // Terrain clutter: update the current sweep's cells, and compute the clutter
+   // power factor -- the radar equation without the antenna's two-way gain and
+   // the cell's sigma/R^4 -- and the cells' sigma/R^4 times their two-way gains,
+   // which are cached with the sweep (see RadarClutter::getG2R4())
+   bool haveClutter = false;
+   const double* clutterG2R4 = nullptr;
+   double kc = 0.0;
+   if (clutter != nullptr && isTransmitting() && getFrequency() > 0.0 && getAntenna() != nullptr) {
+      clutter->update(this, csweep);
+      clutterG2R4 = clutter->getG2R4(this, csweep);
+      haveClutter = (clutterG2R4 != nullptr);
+
+      double losses = getRfSignalProcessLoss() * getRfTransmitLoss();
+      if (losses < 1.0) losses = 1.0;
+      const double lambda = base::LIGHTSPEED / getFrequency();
+      const double fourPi = 4.0 * base::PI;
+      kc = getPeakPower() * lambda * lambda * rfIGain / (fourPi * fourPi * fourPi * losses);
    }
-   base::unlock(packetLock);
 
-   while (em != nullptr) {
-
-      // exclude noise jammers (accounted for already in RfSystem::rfReceivedEmission)
+   // ---
+   // Process Returned Emissions: take all of the received emissions at once, and
+   // process them as a batch (newest first) without holding the packet semaphore
+   // ---
+   EmissionBuffer* buff = takeReceivedEmissions();
+
+   // 1) Compute the signals of our returned emissions (excluding noise jammers,
+   //    which are accounted for already in RfSystem::rfReceivedEmission)
+   Emission* rems[MAX_EMISSIONS];
+   double rsig[MAX_EMISSIONS];
+   unsigned int nr = 0;
+   for (unsigned int i = buff->n; i > 0; i--) {
+      Emission* em = buff->packets[i-1];
       if (em->getTransmitter() == this || (em->isECM() && !em->isECMType(Emission::ECM_NOISE)) ) {
 
          // compute the return trip loss ...
 
-         // Compute signal received
-         double rcs = em->getRCS();
-
          // Signal Equation (Equation 2-7)
-         double rl = em->getRangeLoss();
-         signal *= (rcs * rl);
+         double signal = buff->signals[i-1];
+         signal *= (em->getRCS() * em->getRangeLoss());
 
          // Integration gain
          signal *= rfIGain;
 
          // Range attenuation: we don't want the strong signal from short range targets
-         double maxRng = getRange() * base::distance::NM2M;
-         //double maxRng4 = (maxRng*maxRng*maxRng*maxRng);
-         //double rng = (em->getRange());
-
-         const double s1 = 1.0;
-         //if (rng > 0) {
-         //    double rng4 = (rng*rng*rng*rng);
-         //    s1 = (rng4/maxRng4);
-         //    if (s1 > 1.0f) s1 = 1.0f;
-         //}
-         signal *= s1;
+         // (not used; s1 = 1.0)
 
          if (signal > 0.0) {
-
-            // Signal/Noise  (Equation 2-9)
-            const double signalToInterferenceRatio = signal / interference;
-            const double signalToInterferenceRatioDbl = 10.0f * std::log10(signalToInterferenceRatio);
-            const double signalToNoiseRatio = signal / noise;
-            const double signalToNoiseRatioDbl = 10.0f * std::log10(signalToNoiseRatio);
-
-            //std::cout << "Radar::receive(" << em->getTarget() << "): ";
-            //std::cout << " pwr=" << em->getPower();
-            //std::cout << " gain=" << em->getGain();
-            //std::cout << " rl=" << rl;
-            //std::cout << " rcs=" << rcs;
-            //std::cout << " signal=" << signal;
-            //std::cout << " recvN=" << getRfRecvNoise();
-            //std::cout << " signalToInterferenceRatio=" << signalToInterferenceRatio;
-            //std::cout << " signalToInterferenceRatioDbl=" << signalToInterferenceRatioDbl;
-            //std::cout << " thrs=" << getRfThreshold();
-            //std::cout << std::endl;
-
-            // Is S/N above receiver threshold and within 125% of max range?
-            // CGB, if "signal <= 0.0", then "signalToInterferenceRatioDbl" is probably invalid
-            // we should probably do something smart with "signalToInterferenceRatioDbl" above as well.
-            base::lock(myLock);
-            if (signalToInterferenceRatioDbl >= getRfThreshold() && em->getRange() <= (maxRng*1.25) && rptQueue.isNotFull()) {
-
-               // send the report to the track manager
-               em->ref();
-               rptQueue.put(em);
-               rptSnQueue.put(signalToInterferenceRatioDbl);
-
-               //std::cout << " (" << em->getRange() << ", " << signalToInterferenceRatioDbl << ", " << signalToInterferenceRatio << ", " << signalToInterferenceRatioDbl << ")";
-
-               // Save signal for real-beam display
-               int iaz = csweep;
-               int irng = computeRangeIndex( em->getRange() );
-               sweeps[iaz][irng] += (signalToInterferenceRatioDbl/100.0f);
-               vclos[iaz][irng] = em->getRangeRate();
-
-            } else if (signalToInterferenceRatioDbl < getRfThreshold() && signalToNoiseRatioDbl >= getRfThreshold()) {
-               countNumJammedEm++;
-            }
-            base::unlock(myLock);
+            rems[nr] = em;
+            rsig[nr] = signal;
+            nr++;
          }
       }
+   }
 
-      em->unref();   // this unref() undoes the ref() done by RfSystem::rfReceivedEmission
-      em = nullptr;
-
-      //if (np >= 0 && np < MAX_EMISSIONS) {
-      //    packets[np] = 0;
-      //    signals[np] = 0;
-      //}
+   // 2) Signal/Interference and Signal/Noise (dB) (Equation 2-9)
+   double sir[MAX_EMISSIONS];
+   double snr[MAX_EMISSIONS];
+   for (unsigned int i = 0; i < nr; i++) {
+      // Clutter within the return's range cell; reduced for returns from movers
+      double c = 0.0;
+      if (haveClutter) {
+         c = kc * clutterG2R4[computeRangeIndex( rems[i]->getRange() )];
+         const double mdv = clutter->getMinVelocity();
+         if (mdv > 0.0 && std::fabs(rems[i]->getRangeRate()) >= mdv) c /= clutter->getImprovementFactor();
+      }
+      sir[i] = rsig[i] / (interference + c);
+      snr[i] = rsig[i] / (noise + c);
+   }
+   base::log10Array(sir, sir, nr);
+   base::multArrayConst(sir, 10.0, sir, nr);
+   base::log10Array(snr, snr, nr);
+   base::multArrayConst(snr, 10.0, snr, nr);
+
+   // 3) Is S/I above receiver threshold and within 125% of max range?  Then
+   //    queue a report for the track manager (and our real-beam display).
+   const double maxRng = getRange() * base::distance::NM2M;
+   const double threshold = getRfThreshold();
+   base::lock(myLock);
+   for (unsigned int i = 0; i < nr; i++) {
+      Emission* em = rems[i];
+      if (sir[i] >= threshold && em->getRange() <= (maxRng*1.25) && rptQueue.isNotFull()) {
+
+         // send the report to the track manager
+         em->ref();
+         rptQueue.put(em);
+         rptSnQueue.put(sir[i]);
+
+         // Save signal for real-beam display
+         int iaz = csweep;
+         int irng = computeRangeIndex( em->getRange() );
+         sweeps[iaz][irng] += (sir[i]/100.0f);
+         vclos[iaz][irng] = em->getRangeRate();
+
+      } else if (sir[i] < threshold && snr[i] >= threshold) {
+         countNumJammedEm++;
+      }
+   }
 
-      // Get another emission from the queue
-      base::lock(packetLock);
-      if (np > 0) {
-         np--;
-         em = packets[np];
-         signal = signals[np];
+   // Paint the current sweep's clutter on the real-beam display
+   if (haveClutter && kc > 0.0 && noise > 0.0) {
+      const double minG2R4 = std::pow(10.0, threshold/10.0) * noise / kc;
+      for (unsigned int j = 0; j < PTRS_PER_SWEEP; j++) {
+         if (clutterG2R4[j] > 0.0 && clutterG2R4[j] >= minG2R4) {
+            const double cnr = 10.0 * std::log10(kc * clutterG2R4[j] / noise);
+            sweeps[csweep][j] += (cnr/100.0);
+         }
       }
-      base::unlock(packetLock);
    }
-   //std::cout << std::endl;
+   base::unlock(myLock);
+
+   // this undoes the ref() done by RfSystem::rfReceivedEmission
+   releaseReceivedEmissions(buff);
 
    numberOfJammedEmissions = countNumJammedEm;
 
@@ -346,10 +397,10 @@ void Radar::process(const double dt)
       endOfScanFlg = false;
 
       base::lock(myLock);
+      if (tm != nullptr) {
+         tm->newReports(reports.data(), rptMaxSn.data(), (numReports < MAX_REPORTS ? numReports : MAX_REPORTS));
+      }
       for (unsigned int i = 0; i < numReports && i < MAX_REPORTS; i++) {
-         if (tm != nullptr) {
-            tm->newReport(reports[i], rptMaxSn[i]);
-         }
          reports[i]->unref();
          reports[i] = nullptr;
          rptMaxSn[i] = 0;
@@ -528,6 +579,15 @@ unsigned int Radar::computeRangeIndex(const double rng)
 // Slot functions
 //------------------------------------------------------------------------------
 
+// clutter: Terrain clutter model
+bool Radar::setSlotClutter(RadarClutter* const msg)
+{
+   if (clutter != nullptr) clutter->unref();
+   clutter = msg;
+   if (clutter != nullptr) clutter->ref();
+   return true;
+}
+
 // igain: Integrator gain (dB or no units; def: 1.0)
 bool Radar::setSlotIGain(base::Number* const v)
 {
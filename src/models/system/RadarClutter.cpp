@@ -0,0 +1,521 @@
+
+#include "openeaagles/models/system/RadarClutter.hpp"
+
+#include "openeaagles/models/player/Player.hpp"
+#include "openeaagles/models/system/Antenna.hpp"
+#include "openeaagles/models/system/Radar.hpp"
+#include "openeaagles/models/WorldModel.hpp"
+
+#include "openeaagles/terrain/Terrain.hpp"
+
+#include "openeaagles/base/Number.hpp"
+#include "openeaagles/base/functors/Functions.hpp"
+#include "openeaagles/base/units/Distances.hpp"
+
+#include "openeaagles/base/units/angle_utils.hpp"
+#include "openeaagles/base/util/constants.hpp"
+#include "openeaagles/base/util/nav_utils.hpp"
+
+#include <cmath>
+
+namespace oe {
+namespace models {
+
+IMPLEMENT_SUBCLASS(RadarClutter, "RadarClutter")
+EMPTY_SERIALIZER(RadarClutter)
+
+BEGIN_SLOTTABLE(RadarClutter)
+   "landGamma",            //  1: Land reflectivity, gamma (no units, or base::Decibel; def: -15 dB)
+   "seaGamma",             //  2: Sea reflectivity, gamma (no units, or base::Decibel; def: -40 dB)
+   "improvementFactor",    //  3: Clutter improvement factor (no units, or base::Decibel; def: 1.0)
+   "minVelocity",          //  4: Minimum detectable velocity (m/s; def: 0)
+   "updateDistance",       //  5: Ownship movement before a sweep is recomputed (Distance; def: 100 m)
+END_SLOTTABLE(RadarClutter)
+
+BEGIN_SLOT_MAP(RadarClutter)
+   ON_SLOT(1, setSlotLandGamma,         base::Number)
+   ON_SLOT(2, setSlotSeaGamma,          base::Number)
+   ON_SLOT(3, setSlotImprovementFactor, base::Number)
+   ON_SLOT(4, setSlotMinVelocity,       base::Number)
+   ON_SLOT(5, setSlotUpdateDistance,    base::Distance)
+END_SLOT_MAP()
+
+static const unsigned int NUM_CELLS = Radar::NUM_SWEEPS * Radar::PTRS_PER_SWEEP;
+
+// Effective (4/3) earth radius (m)
+static const double EFF_ERAD = base::nav::ERADM * 4.0 / 3.0;
+
+// A sweep is recomputed when the ownship has turned more than this (degs)
+static const double MAX_HDG_CHANGE = 0.25;
+
+RadarClutter::RadarClutter() : rcs(NUM_CELLS), rcsR4(NUM_CELLS), sinGraze(NUM_CELLS), tanDep(NUM_CELLS),
+   swPos(Radar::NUM_SWEEPS), swHdg(Radar::NUM_SWEEPS), swRng(Radar::NUM_SWEEPS), swValid(Radar::NUM_SWEEPS),
+   g2R4(NUM_CELLS), gnGimbal(Radar::NUM_SWEEPS), gnOwnship(Radar::NUM_SWEEPS), gnValid(Radar::NUM_SWEEPS),
+   elev(Radar::PTRS_PER_SWEEP), elevValid(new bool[Radar::PTRS_PER_SWEEP])
+{
+   STANDARD_CONSTRUCTOR()
+
+   landGamma = std::pow(10.0, -15.0/10.0);
+   seaGamma = std::pow(10.0, -40.0/10.0);
+}
+
+void RadarClutter::copyData(const RadarClutter& org, const bool cc)
+{
+   BaseClass::copyData(org);
+
+   if (cc) {
+      rcs.resize(NUM_CELLS);
+      rcsR4.resize(NUM_CELLS);
+      sinGraze.resize(NUM_CELLS);
+      tanDep.resize(NUM_CELLS);
+      swPos.resize(Radar::NUM_SWEEPS);
+      swHdg.resize(Radar::NUM_SWEEPS);
+      swRng.resize(Radar::NUM_SWEEPS);
+      swValid.resize(Radar::NUM_SWEEPS);
+      g2R4.resize(NUM_CELLS);
+      gnGimbal.resize(Radar::NUM_SWEEPS);
+      gnOwnship.resize(Radar::NUM_SWEEPS);
+      gnValid.resize(Radar::NUM_SWEEPS);
+      elev.resize(Radar::PTRS_PER_SWEEP);
+      elevValid.reset(new bool[Radar::PTRS_PER_SWEEP]);
+   }
+
+   landGamma = org.landGamma;
+   seaGamma = org.seaGamma;
+   improvementFactor = org.improvementFactor;
+   minVelocity = org.minVelocity;
+   updateDistance = org.updateDistance;
+
+   // the sweeps are recomputed for our own radar
+   reset();
+}
+
+void RadarClutter::deleteData()
+{
+}
+
+//------------------------------------------------------------------------------
+// reset() -- invalidates all sweeps
+//------------------------------------------------------------------------------
+void RadarClutter::reset()
+{
+   for (unsigned int i = 0; i < NUM_CELLS; i++) {
+      rcs[i] = 0.0;
+      rcsR4[i] = 0.0;
+      sinGraze[i] = 0.0;
+      tanDep[i] = 0.0;
+      g2R4[i] = 0.0;
+   }
+   for (unsigned int n = 0; n < Radar::NUM_SWEEPS; n++) {
+      swValid[n] = false;
+      gnValid[n] = false;
+   }
+   numCells = 0;
+}
+
+//------------------------------------------------------------------------------
+// Get functions
+//------------------------------------------------------------------------------
+double RadarClutter::getRcs(const unsigned int n, const unsigned int j) const
+{
+   if (n < Radar::NUM_SWEEPS && j < Radar::PTRS_PER_SWEEP) return rcs[n * Radar::PTRS_PER_SWEEP + j];
+   return 0.0;
+}
+
+double RadarClutter::getGrazingAngle(const unsigned int n, const unsigned int j) const
+{
+   if (n < Radar::NUM_SWEEPS && j < Radar::PTRS_PER_SWEEP) return std::asin(sinGraze[n * Radar::PTRS_PER_SWEEP + j]);
+   return 0.0;
+}
+
+const double* RadarClutter::getRcsR4(const unsigned int n) const
+{
+   return (n < Radar::NUM_SWEEPS ? &rcsR4[n * Radar::PTRS_PER_SWEEP] : nullptr);
+}
+
+// Sweep's azimuth, relative to the ownship (degs)
+double RadarClutter::sweepAzimuth(const unsigned int n)
+{
+   return static_cast<double>(n) * 60.0 / static_cast<double>(Radar::NUM_SWEEPS - 1) - 30.0;
+}
+
+//------------------------------------------------------------------------------
+// computeGains() -- two-way antenna gains toward the cells of sweep 'n': the
+// cells' LOS vectors are transformed into antenna coordinates, as the target's
+// are by Tdb::computeBoresightData(), and the antenna's gain pattern is looked
+// up at their azimuth and elevation (or total angle) off boresight.
+//------------------------------------------------------------------------------
+void RadarClutter::computeGains(const Radar* const radar, const unsigned int n, double* const gains) const
+{
+   const unsigned int ns = Radar::PTRS_PER_SWEEP;
+   for (unsigned int j = 0; j < ns; j++) {
+      gains[j] = 0.0;
+   }
+
+   const Antenna* ant = (radar != nullptr ? radar->getAntenna() : nullptr);
+   const Player* own = (radar != nullptr ? radar->getOwnship() : nullptr);
+   if (ant == nullptr || own == nullptr || n >= Radar::NUM_SWEEPS) return;
+
+   const double g = ant->getGain();
+   const base::Function* pattern = ant->gainPatternTable();
+   const auto gainFunc1 = dynamic_cast<const base::Func1*>(pattern);
+   const auto gainFunc2 = dynamic_cast<const base::Func2*>(pattern);
+   if (gainFunc1 == nullptr && gainFunc2 == nullptr) {
+      // No antenna pattern table
+      for (unsigned int j = 0; j < ns; j++) {
+         gains[j] = g * g;
+      }
+      return;
+   }
+
+   // NED to antenna matrix
+   base::Matrixd mm = ant->getRotMat();
+   if (ant->isUsingHeadingOnly()) {
+      base::Matrixd rr;
+      rr.makeRotate( own->getHeading(), 0, 0, 1);
+      mm *= rr;
+   }
+   else {
+      mm *= own->getRotMat();
+   }
+
+   // Sweep's true bearing
+   const double brg = (own->getHeadingD() + sweepAzimuth(n)) * base::angle::D2RCC;
+   const double cb = std::cos(brg);
+   const double sb = std::sin(brg);
+
+   const double k = (ant->isGainPatternDegrees() ? base::angle::R2DCC : 1.0);
+   const double* const td = &tanDep[n * ns];
+   for (unsigned int j = 1; j < ns; j++) {
+      // LOS vector to the cell in antenna coordinates, and the angles off boresight
+      const base::Vec3d losG = mm * base::Vec3d(cb, sb, td[j]);
+      const double x = losG.x();
+      const double y = losG.y();
+      const double z = -losG.z();
+      const double ra = std::sqrt(x * x + y * y);
+
+      double db = 0.0;
+      if (gainFunc2 != nullptr) {
+         db = gainFunc2->f( std::atan2(y, x) * k, std::atan2(z, ra) * k );
+      }
+      else {
+         db = gainFunc1->f( std::atan2(std::sqrt(y * y + z * z), x) * k );
+      }
+      const double gain = g * std::pow(10.0, db / 10.0);
+      gains[j] = gain * gain;
+   }
+}
+
+//------------------------------------------------------------------------------
+// getG2R4() -- cells' two-way gains times their cross section / range^4; the
+// gains are recomputed if the sweep has been recomputed, or if the antenna's
+// gimbal or the ownship's attitude has moved by more than a tenth of the
+// antenna's beam width since they were computed.
+//------------------------------------------------------------------------------
+const double* RadarClutter::getG2R4(const Radar* const radar, const unsigned int n)
+{
+   if (n >= Radar::NUM_SWEEPS) return nullptr;
+
+   double* const g2 = &g2R4[n * Radar::PTRS_PER_SWEEP];
+   const Antenna* ant = (radar != nullptr ? radar->getAntenna() : nullptr);
+   const Player* own = (radar != nullptr ? radar->getOwnship() : nullptr);
+   if (ant == nullptr || own == nullptr) {
+      for (unsigned int j = 0; j < Radar::PTRS_PER_SWEEP; j++) {
+         g2[j] = 0.0;
+      }
+      gnValid[n] = false;
+      return g2;
+   }
+
+   const base::Vec3d gimbal = ant->getPosition();
+   const base::Vec3d att(own->getRoll(), own->getPitch(), own->getHeading());
+   if (gnValid[n]) {
+      const double maxMove = 0.1 * ant->getBeamWidth();
+      const base::Vec3d dg = gimbal - gnGimbal[n];
+      const base::Vec3d da = att - gnOwnship[n];
+      bool moved = false;
+      for (unsigned int i = 0; i < 3 && !moved; i++) {
+         moved = (std::fabs(base::angle::aepcdRad(dg[i])) > maxMove ||
+                  std::fabs(base::angle::aepcdRad(da[i])) > maxMove);
+      }
+      if (!moved) return g2;
+   }
+
+   computeGains(radar, n, g2);
+   const double* const r4 = &rcsR4[n * Radar::PTRS_PER_SWEEP];
+   for (unsigned int j = 0; j < Radar::PTRS_PER_SWEEP; j++) {
+      g2[j] *= r4[j];
+   }
+   gnGimbal[n] = gimbal;
+   gnOwnship[n] = att;
+   gnValid[n] = true;
+   return g2;
+}
+
+//------------------------------------------------------------------------------
+// update() -- recomputes sweep 'n' if the ownship has moved or turned, or if
+//             the radar's range has changed since it was computed.
+//------------------------------------------------------------------------------
+bool RadarClutter::update(const Radar* const radar, const unsigned int n)
+{
+   if (radar == nullptr || n >= Radar::NUM_SWEEPS) return false;
+
+   const Player* own = radar->getOwnship();
+   if (own == nullptr) return false;
+
+   const double maxRng = radar->getRange() * base::distance::NM2M;
+   if (maxRng <= 0) return false;
+
+   const base::Vec3d& pos = own->getGeocPosition();
+   const double hdg = own->getHeadingD();
+
+   if (swValid[n] && swRng[n] == maxRng &&
+         (pos - swPos[n]).length2() <= (updateDistance * updateDistance) &&
+         std::fabs(base::angle::aepcdDeg(hdg - swHdg[n])) <= MAX_HDG_CHANGE) {
+      return false;
+   }
+
+   computeSweep(radar, n, hdg, maxRng);
+
+   swPos[n] = pos;
+   swHdg[n] = hdg;
+   swRng[n] = maxRng;
+   swValid[n] = true;
+   gnValid[n] = false;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// computeSweep() -- computes the clutter cells of sweep 'n'
+//------------------------------------------------------------------------------
+void RadarClutter::computeSweep(const Radar* const radar, const unsigned int n, const double hdg, const double maxRng)
+{
+   const unsigned int ns = Radar::PTRS_PER_SWEEP;
+   const Player* own = radar->getOwnship();
+
+   // Cell length (the radar's range index rounds to the nearest cell, so the
+   // center of cell 'j' is at range j * cellLen)
+   const double cellLen = maxRng / static_cast<double>(ns);
+
+   // Sweep's true bearing (degs)
+   const double brg = base::angle::aepcdDeg(hdg + sweepAzimuth(n));
+
+   // Beam width (radians) and range resolution (m)
+   double bw = 0.5 * base::angle::D2RCC;
+   if (radar->getAntenna() != nullptr) bw = radar->getAntenna()->getBeamWidth();
+   double dRng = base::LIGHTSPEED * radar->getPulseWidth() / 2.0;
+   if (dRng <= 0) dRng = cellLen;
+
+   // ---
+   // 1) Terrain elevations along the sweep
+   // ---
+   double* const e = elev.data();
+   bool* const valid = elevValid.get();
+   for (unsigned int j = 0; j < ns; j++) {
+      e[j] = 0.0;
+      valid[j] = false;
+   }
+   const WorldModel* wm = own->getWorldModel();
+   const terrain::Terrain* terrain = (wm != nullptr ? wm->getTerrain() : nullptr);
+   if (terrain != nullptr && terrain->isDataLoaded()) {
+      terrain->getElevations(e, valid, ns, own->getLatitude(), own->getLongitude(), brg, ((ns - 1) * cellLen));
+      for (unsigned int j = 0; j < ns; j++) {
+         if (!valid[j]) e[j] = 0.0;
+      }
+   }
+
+   // ---
+   // 2, 3, 4) Shadowing, grazing angles and cross sections
+   // ---
+   const unsigned int i0 = n * ns;
+   const double h = own->getAltitudeM();
+
+   rcs[i0] = 0.0;
+   rcsR4[i0] = 0.0;
+   sinGraze[i0] = 0.0;
+   tanDep[i0] = 0.0;
+
+   double maxTanEl = -1.0e30;
+   for (unsigned int j = 1; j < ns; j++) {
+      const double r = j * cellLen;
+      const double curve = r / (2.0 * EFF_ERAD);
+
+      // Shadowed if a nearer cell has a higher look angle
+      const double tanEl = (e[j] - h) / r - curve;
+      const bool shadowed = (tanEl < maxTanEl);
+      if (tanEl > maxTanEl) maxTanEl = tanEl;
+
+      // Local grazing angle: flat grazing angle plus the terrain slope toward
+      // the radar (tangent of the sum)
+      double sinG = 0.0;
+      double cosG = 1.0;
+      if (!shadowed) {
+         const double ta = (h - e[j]) / r - curve;
+         const double tb = (e[j] - e[j-1]) / cellLen;
+         const double den = 1.0 - ta * tb;
+         if (den > 0.0) {
+            const double t = (ta + tb) / den;
+            if (t > 0.0) {
+               cosG = 1.0 / std::sqrt(1.0 + t * t);
+               sinG = t * cosG;
+            }
+         }
+         else if ((ta + tb) > 0.0) {
+            sinG = 1.0;
+            cosG = 0.0;
+         }
+      }
+
+      double sigma = 0.0;
+      if (sinG > 0.0) {
+         // Resolution patch: the beam width by the smaller of the pulse-limited
+         // and beam-limited range extents
+         const double cross = r * bw;
+         double along = cross / sinG;
+         if (cosG > 0.0 && (dRng / cosG) < along) along = dRng / cosG;
+
+         const double gamma = ((valid[j] && e[j] <= 0.0) ? seaGamma : landGamma);
+         sigma = gamma * sinG * cross * along;
+      }
+
+      const double r2 = r * r;
+      rcs[i0 + j] = sigma;
+      rcsR4[i0 + j] = sigma / (r2 * r2);
+      sinGraze[i0 + j] = sinG;
+      tanDep[i0 + j] = -tanEl;
+   }
+
+   numCells += ns;
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+bool RadarClutter::setLandGamma(const double v)
+{
+   landGamma = v;
+   reset();
+   return true;
+}
+
+bool RadarClutter::setSeaGamma(const double v)
+{
+   seaGamma = v;
+   reset();
+   return true;
+}
+
+bool RadarClutter::setImprovementFactor(const double v)
+{
+   improvementFactor = v;
+   return true;
+}
+
+bool RadarClutter::setMinVelocity(const double v)
+{
+   minVelocity = v;
+   return true;
+}
+
+bool RadarClutter::setUpdateDistance(const double v)
+{
+   updateDistance = v;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+
+// landGamma: Land reflectivity, gamma (no units, or base::Decibel)
+bool RadarClutter::setSlotLandGamma(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double g = msg->getReal();
+      if (g >= 0.0) {
+         ok = setLandGamma(g);
+      }
+      else {
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "RadarClutter::setSlotLandGamma(): ERROR, gamma must not be negative; use ( Decibel ... ) for dB values" << std::endl;
+         }
+      }
+   }
+   return ok;
+}
+
+// seaGamma: Sea reflectivity, gamma (no units, or base::Decibel)
+bool RadarClutter::setSlotSeaGamma(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double g = msg->getReal();
+      if (g >= 0.0) {
+         ok = setSeaGamma(g);
+      }
+      else {
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "RadarClutter::setSlotSeaGamma(): ERROR, gamma must not be negative; use ( Decibel ... ) for dB values" << std::endl;
+         }
+      }
+   }
+   return ok;
+}
+
+// improvementFactor: Clutter improvement factor (no units, or base::Decibel)
+bool RadarClutter::setSlotImprovementFactor(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double f = msg->getReal();
+      if (f >= 1.0) {
+         ok = setImprovementFactor(f);
+      }
+      else {
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "RadarClutter::setSlotImprovementFactor(): ERROR, factor must be greater than or equal to one (i.e., 0db)" << std::endl;
+         }
+      }
+   }
+   return ok;
+}
+
+// minVelocity: Minimum detectable velocity (m/s)
+bool RadarClutter::setSlotMinVelocity(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double v = msg->getReal();
+      if (v >= 0.0) {
+         ok = setMinVelocity(v);
+      }
+      else {
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "RadarClutter::setSlotMinVelocity(): ERROR, velocity must not be negative" << std::endl;
+         }
+      }
+   }
+   return ok;
+}
+
+// updateDistance: Ownship movement before a sweep is recomputed (Distance)
+bool RadarClutter::setSlotUpdateDistance(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const double d = base::Meters::convertStatic(*msg);
+      if (d >= 0.0) {
+         ok = setUpdateDistance(d);
+      }
+      else {
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "RadarClutter::setSlotUpdateDistance(): ERROR, distance must not be negative" << std::endl;
+         }
+      }
+   }
+   return ok;
+}
+
+}
+}
@@ -13,6 +13,7 @@
 #include "openeaagles/base/Decibel.hpp"
 #include "openeaagles/base/units/Frequencies.hpp"
 #include "openeaagles/base/units/Powers.hpp"
+#include "openeaagles/base/util/math_utils.hpp"
 
 #include <cmath>
 
@@ -222,46 +223,30 @@ void Radio::receive(const double dt)
    double noise = getRfRecvNoise();
 
    // ---
-   // Process Emissions
+   // Process Emissions: take all of the received emissions at once, and
+   // process them as a batch (newest first)
    // ---
+   EmissionBuffer* buff = takeReceivedEmissions();
+   const unsigned int n = buff->n;
 
-   Emission* em = nullptr;
-   double signal = 0;
-
-   // Get an emission from the queue
-   base::lock(packetLock);
-   if (np > 0) {
-      np--; // Decrement 'np', now the array index
-      em = packets[np];
-      signal = signals[np];
+   // Signal/Noise  (Equation 2-9)
+   double snDbl[MAX_EMISSIONS];
+   for (unsigned int i = 0; i < n; i++) {
+      snDbl[i] = buff->signals[n-1-i] / noise;
    }
-   base::unlock(packetLock);
-
-   while (em != nullptr) {
-
-
-      // Signal/Noise  (Equation 2-9)
-      double sn = signal / noise;
-      double snDbl = 10.0 * std::log10(sn);
+   base::log10Array(snDbl, snDbl, n);
+   base::multArrayConst(snDbl, 10.0, snDbl, n);
 
-      // Is S/N above receiver threshold?
-      if ( snDbl >= getRfThreshold() ) {
+   // Is S/N above receiver threshold?
+   const double threshold = getRfThreshold();
+   for (unsigned int i = 0; i < n; i++) {
+      if ( snDbl[i] >= threshold ) {
          // Report this valid emission to the radio model ...
-         receivedEmissionReport(em);
+         receivedEmissionReport(buff->packets[n-1-i]);
       }
-
-      em->unref();
-      em = nullptr;
-
-      // Get another emission from the queue
-      base::lock(packetLock);
-      if (np > 0) {
-         np--;
-         em = packets[np];
-         signal = signals[np];
-      }
-      base::unlock(packetLock);
    }
+
+   releaseReceivedEmissions(buff);
 }
 
 //------------------------------------------------------------------------------
@@ -172,6 +172,30 @@ void RfSensor::reset()
     }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our range and scan state
+//------------------------------------------------------------------------------
+void RfSensor::saveState(base::Checkpoint* const cp) const
+{
+    cp->beginSection();
+    cp->put(rng);
+    cp->put(rngIdx);
+    cp->put(scanning);
+    cp->put(scanBar);
+    cp->endSection();
+
+    BaseClass::saveState(cp);
+}
+
+bool RfSensor::restoreState(base::Checkpoint::Reader* const rd)
+{
+    bool ok = rd->beginSection() && rd->get(&rng) && rd->get(&rngIdx);
+    ok = ok && rd->get(&scanning) && rd->get(&scanBar);
+    ok = rd->endSection() && ok;
+
+    return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // onStartScanEvent() -- process the start of a scan
 //------------------------------------------------------------------------------
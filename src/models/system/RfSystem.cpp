@@ -93,13 +93,8 @@ void RfSystem::deleteData()
 {
    setAntenna(nullptr);
    setSlotAntennaName(nullptr);
-   for (unsigned int i = 0; i < np && i < MAX_EMISSIONS; i++) {
-      if (packets[i] != nullptr) {
-         packets[i]->unref();
-         packets[i] = nullptr;
-      }
-   }
-   np = 0;
+   releaseReceivedEmissions(&rcvBuffers[0]);
+   releaseReceivedEmissions(&rcvBuffers[1]);
 }
 
 //------------------------------------------------------------------------------
@@ -109,13 +104,10 @@ bool RfSystem::shutdownNotification()
 {
    setAntenna(nullptr);
 
-   for (unsigned int i = 0; i < np && i < MAX_EMISSIONS; i++) {
-      if (packets[i] != nullptr) {
-         packets[i]->unref();
-         packets[i] = nullptr;
-      }
-   }
-   np = 0;
+   base::lock(packetLock);
+   releaseReceivedEmissions(&rcvBuffers[0]);
+   releaseReceivedEmissions(&rcvBuffers[1]);
+   base::unlock(packetLock);
 
    return BaseClass::shutdownNotification();
 }
@@ -154,6 +146,35 @@ void RfSystem::reset()
    processPlayersOfInterest();
 
 }
+
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our transmitter and receiver enables; the
+// received emissions are from before the restore, so they're released
+//------------------------------------------------------------------------------
+void RfSystem::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(xmitEnable);
+   cp->put(recvEnable);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool RfSystem::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&xmitEnable) && rd->get(&recvEnable);
+   ok = rd->endSection() && ok;
+
+   base::lock(packetLock);
+   releaseReceivedEmissions(&rcvBuffers[0]);
+   releaseReceivedEmissions(&rcvBuffers[1]);
+   jamSignal = 0.0;
+   base::unlock(packetLock);
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // updateData() -- update background data here
 //------------------------------------------------------------------------------
@@ -206,8 +227,10 @@ void RfSystem::processPlayersOfInterest()
 //------------------------------------------------------------------------------
 void RfSystem::rfReceivedEmission(Emission* const em, Antenna* const, double raGain)
 {
-   // Queue up emissions for receive() to process
-   if (em != nullptr && isReceiverEnabled()) {
+   // Queue up emissions for receive() to process (which is suspended while
+   // our ownship is low fidelity)
+   const Player* own = getOwnship();
+   if (em != nullptr && isReceiverEnabled() && (own == nullptr || !own->isLowFidelity())) {
 
       // Test to make sure the received emission is in-band before proceeding
       if (affectsRfSystem(em)) {
@@ -242,11 +265,12 @@ void RfSystem::rfReceivedEmission(Emission* const em, Antenna* const, double raG
 
          // Save packet and signal for receive()
          base::lock(packetLock);
-         if (np < MAX_EMISSIONS) {
+         EmissionBuffer& buff = rcvBuffers[inBuffer];
+         if (buff.n < MAX_EMISSIONS) {
             em->ref();
-            packets[np] = em;
-            signals[np] = signal;
-            np++;
+            buff.packets[buff.n] = em;
+            buff.signals[buff.n] = signal;
+            buff.n++;
          }
          base::unlock(packetLock);
 
@@ -254,6 +278,33 @@ void RfSystem::rfReceivedEmission(Emission* const em, Antenna* const, double raG
    }
 }
 
+//------------------------------------------------------------------------------
+// takeReceivedEmissions() -- take all of the received emission packets by
+//                            swapping the input buffer with the other buffer
+//------------------------------------------------------------------------------
+RfSystem::EmissionBuffer* RfSystem::takeReceivedEmissions()
+{
+   base::lock(packetLock);
+   EmissionBuffer* buff = &rcvBuffers[inBuffer];
+   inBuffer = 1 - inBuffer;
+   base::unlock(packetLock);
+   return buff;
+}
+
+//------------------------------------------------------------------------------
+// releaseReceivedEmissions() -- unref() the packets and empty the buffer
+//------------------------------------------------------------------------------
+void RfSystem::releaseReceivedEmissions(EmissionBuffer* const buff)
+{
+   for (unsigned int i = 0; i < buff->n; i++) {
+      if (buff->packets[i] != nullptr) {
+         buff->packets[i]->unref();
+         buff->packets[i] = nullptr;
+      }
+   }
+   buff->n = 0;
+}
+
 
 //------------------------------------------------------------------------------
 // transmitPower() -- Compute transmitter power (Part of equation 2-1)
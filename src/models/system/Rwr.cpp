@@ -85,83 +85,72 @@ void Rwr::receive(const double dt)
    const double noise = getRfRecvNoise() * getRfReceiveLoss();
 #endif
 
-   // Process received emissions
+   // Process received emissions: take all of the received emissions at once, and
+   // process them as a batch (newest first) without holding the packet semaphore
    TrackManager* tm = getTrackManager();
-   Emission* em = nullptr;
-   double signal = 0;
-
-   // Get an emission from the queue
-   base::lock(packetLock);
-   if (np > 0) {
-      np--; // Decrement 'np', now the array index
-      em = packets[np];
-      signal = signals[np];
-   }
-   base::unlock(packetLock);
-
-   while (em != nullptr) {
-
-      //std::cout << "Rwr::receive(" << em->getOwnship() << "): ";
-      //std::cout << " pwr=" << em->getPower();
-      //std::cout << " gain=" << em->getGain();
-      //std::cout << " rl=" << rl;
-      //std::cout << " pulses=" << pulses;
-      //std::cout << " losses=" << losses;
-      //std::cout << " signal=" << signal;
-      //std::cout << " recvN=" << getRfRecvNoise();
-      //std::cout << " sn=" << sn;
-      //std::cout << " snDbl=" << snDbl;
-      //std::cout << " thrs=" << getRfThreshold();
-      //std::cout << std::endl;
-
-      // CGB, if "signal <= 0.0", then "snDbl" is probably invalid
-      if (signal > 0.0 && dt != 0.0) {
-
-         // Signal over noise (equation 3-5)
-         const double sn = signal / noise;
-         const double snDbl = 10.0 * std::log10(sn);
-
-         // Is S/N above receiver threshold  ## dpg -- for now, don't include ECM emissions
-         if (snDbl > getRfThreshold() && !em->isECM() && rptQueue.isNotFull()) {
-            // Send report to the track manager
-            if (tm != nullptr) {
-               tm->newReport(em, snDbl);
-            }
-
-            // Get Angle Of Arrival
-            const double aoa= em->getAzimuthAoi();
-
-            // Store received power for real-beam display
-            const double sigDbl = 10.0f * std::log10(signal);
-            const double signal10 = (sigDbl + 50.0f)/50.f;
-            const int idx = getRayIndex( static_cast<double>(base::angle::R2DCC * aoa) );
-            rays[0][idx] = base::lim01(rays[0][idx] + signal10);
-            //if (idx == 0 && getOwnship()->getID() == 1011) {
-            //   std::cout << "sig = " << signal10 << std::endl;
-            //}
-
-            // Send to the track list processor
-            em->ref();  // ref() for track list processing
-            rptQueue.put(em);
+   EmissionBuffer* buff = takeReceivedEmissions();
+
+   // 1) Received signals
+   // CGB, if "signal <= 0.0", then "snDbl" is probably invalid
+   Emission* rems[MAX_EMISSIONS];
+   double rsig[MAX_EMISSIONS];
+   unsigned int nr = 0;
+   if (dt != 0.0) {
+      for (unsigned int i = buff->n; i > 0; i--) {
+         if (buff->signals[i-1] > 0.0) {
+            rems[nr] = buff->packets[i-1];
+            rsig[nr] = buff->signals[i-1];
+            nr++;
          }
       }
+   }
 
-      // finished
-      em->unref();   // this unref() undoes the ref() done by RfSystem::rfReceivedEmission
-      em = nullptr;
-
-
-      // Get another emission from the queue
-      base::lock(packetLock);
-      if (np > 0) {
-         np--;
-         em = packets[np];
-         signal = signals[np];
+   // 2) Signal over noise (equation 3-5) and received power (dB)
+   double snDbl[MAX_EMISSIONS];
+   double sigDbl[MAX_EMISSIONS];
+   for (unsigned int i = 0; i < nr; i++) {
+      snDbl[i] = rsig[i] / noise;
+   }
+   base::log10Array(snDbl, snDbl, nr);
+   base::multArrayConst(snDbl, 10.0, snDbl, nr);
+   base::log10Array(rsig, sigDbl, nr);
+   base::multArrayConst(sigDbl, 10.0, sigDbl, nr);
+
+   // 3) Is S/N above receiver threshold  ## dpg -- for now, don't include ECM emissions
+   Emission* tmRpts[MAX_EMISSIONS];
+   double tmSn[MAX_EMISSIONS];
+   unsigned int ntm = 0;
+   const double threshold = getRfThreshold();
+   for (unsigned int i = 0; i < nr; i++) {
+      Emission* em = rems[i];
+      if (snDbl[i] > threshold && !em->isECM() && rptQueue.isNotFull()) {
+         // Report to the track manager
+         tmRpts[ntm] = em;
+         tmSn[ntm] = snDbl[i];
+         ntm++;
+
+         // Get Angle Of Arrival
+         const double aoa= em->getAzimuthAoi();
+
+         // Store received power for real-beam display
+         const double signal10 = (sigDbl[i] + 50.0f)/50.f;
+         const int idx = getRayIndex( static_cast<double>(base::angle::R2DCC * aoa) );
+         rays[0][idx] = base::lim01(rays[0][idx] + signal10);
+
+         // Send to the track list processor
+         em->ref();  // ref() for track list processing
+         rptQueue.put(em);
       }
-      base::unlock(packetLock);
+   }
 
+   // Send the reports to the track manager, as a batch
+   if (tm != nullptr && ntm > 0) {
+      tm->newReports(tmRpts, tmSn, ntm);
    }
 
+   // finished: this undoes the ref() done by RfSystem::rfReceivedEmission
+   releaseReceivedEmissions(buff);
+
    // Transfer the rays
    xferRays();
 }
@@ -3,13 +3,17 @@
 
 #include "openeaagles/models/player/Player.hpp"
 #include "openeaagles/models/system/Antenna.hpp"
+#include "openeaagles/models/system/SarImager.hpp"
 #include "openeaagles/models/Image.hpp"
+#include "openeaagles/models/Signatures.hpp"
 
 #include "openeaagles/models/WorldModel.hpp"
 
 #include "openeaagles/base/Number.hpp"
 #include "openeaagles/base/Pair.hpp"
 #include "openeaagles/base/PairStream.hpp"
+#include "openeaagles/base/concurrent/ThreadPool.hpp"
+#include "openeaagles/base/util/atomics.hpp"
 
 #include "openeaagles/base/util/nav_utils.hpp"
 
@@ -23,14 +27,17 @@ EMPTY_SERIALIZER(Sar)
 
 BEGIN_SLOTTABLE(Sar)
     "chipSize",         // 1) Chip size (pixels)   <base::Number>
+    "numImageThreads",  // 2) Number of image rendering threads <base::Number>
 END_SLOTTABLE(Sar)
 
 BEGIN_SLOT_MAP(Sar)
     ON_SLOT( 1, setSlotChipSize,  base::Number)
+    ON_SLOT( 2, setSlotNumImageThreads,  base::Number)
 END_SLOT_MAP()
 
 // Default parameters
 static const double DEFAULT_SAR_TIME = 10.0f;
+static const unsigned int MAX_IMAGE_THREADS = 32;     // base::ThreadPool's limit
 
 Sar::Sar() : imgList(nullptr)
 {
@@ -62,6 +69,21 @@ void Sar::copyData(const Sar& org, const bool cc)
    width = org.width;
    height = org.height;
    timer = org.timer;
+   numImageThreads = org.numImageThreads;
+
+   // The image chips and thread pool are not copied
+   if (cc) {
+      chip = nullptr;
+      pendingChip = nullptr;
+      chipLock = 0;
+      poolChip = nullptr;
+      pool = nullptr;
+   }
+   else {
+      clearChips();
+      destroyPool();
+   }
+   busy = false;
 
    // Copy the images
    if (imgList != nullptr) {
@@ -80,6 +102,67 @@ void Sar::deleteData()
         imgList->unref();
         imgList = nullptr;
     }
+
+    // Drop the image chips and shutdown the thread pool
+    clearChips();
+    destroyPool();
+}
+
+//------------------------------------------------------------------------------
+// reset() -- Reset parameters
+//------------------------------------------------------------------------------
+void Sar::reset()
+{
+   BaseClass::reset();
+
+   // Any image in progress is dropped
+   clearChips();
+   busy = false;
+}
+
+//------------------------------------------------------------------------------
+// updateData() -- background thread: renders any pending image chip, or
+// hands it to the thread pool once the pool's previous chip is idle.
+//------------------------------------------------------------------------------
+void Sar::updateData(const double dt)
+{
+   BaseClass::updateData(dt);
+
+   // Release the pool's chip once its threads are done with it
+   if (poolChip != nullptr && poolChip->isIdle()) {
+      poolChip->unref();
+      poolChip = nullptr;
+   }
+
+   if (numImageThreads > 0 && pool == nullptr) {
+      const auto mgr = new SarImager();
+      pool = new base::ThreadPool(mgr, numImageThreads, 0.0);
+      mgr->unref();
+      pool->initialize(this);
+   }
+
+   // Still rendering the previous chip?  The new one waits in the mailbox.
+   if (poolChip != nullptr) return;
+
+   base::lock(chipLock);
+   SarChip* const p = pendingChip;
+   pendingChip = nullptr;
+   base::unlock(chipLock);
+
+   if (p != nullptr) {
+      if (pool != nullptr) {
+         // The pool's threads are all available, so these don't block
+         for (unsigned int i = 0; i < numImageThreads; i++) {
+            p->ref();
+            pool->execute(p);
+         }
+         poolChip = p;
+      }
+      else {
+         p->render();
+         p->unref();
+      }
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -146,6 +229,27 @@ bool Sar::setSlotChipSize(const base::Number* const msg)
     return ok;
 }
 
+bool Sar::setSlotNumImageThreads(const base::Number* const msg)
+{
+    bool ok = false;
+    if (msg != nullptr) {
+        const int n = msg->getInt();
+        if (n >= 0 && n <= static_cast<int>(MAX_IMAGE_THREADS)) {
+            ok = setNumImageThreads( n );
+        }
+        else {
+            std::cerr << "Sar::setSlotNumImageThreads: numImageThreads is invalid, range: [0 .. " << MAX_IMAGE_THREADS << "]" << std::endl;
+        }
+    }
+    return ok;
+}
+
+bool Sar::setNumImageThreads(const unsigned int n)
+{
+   numImageThreads = n;
+   return true;
+}
+
 bool Sar::setResolution(const double res)
 {
    resolution = res;
@@ -233,22 +337,8 @@ void Sar::process(const double dt)
       double ttimer = timer - dt;
       if (ttimer <= 0) {
 
-         // ### test -- Generate a test image ###
-         const auto p = new Image();
-         p->testImage(width,height);
-         p->setImageId(getNextId());
-         p->setLatitude(getStarePointLatitude());
-         p->setLongitude(getStarePointLongitude());
-         p->setElevation(getStarePointElevation());
-         p->setOrientation(0);
-         if (isMessageEnabled(MSG_INFO)) {
-            std::cout << "Sar:: Generating test image: resolution: " << getResolution() << std::endl;
-         }
-         if (getResolution() > 0) p->setResolution( getResolution() );
-         else p->setResolution( 3.0 * base::distance::FT2M );
-         const auto pp = new base::Pair("image", p);
-         addImage(pp);
-         // ### TEST
+         // Start rendering the image
+         startImage();
 
          // Just finished!
          ttimer = 0;
@@ -257,10 +347,149 @@ void Sar::process(const double dt)
       timer = ttimer;
    }
 
+   // Image chip rendered?
+   if (chip != nullptr && chip->isDone()) {
+      finishImage();
+   }
+
    BaseClass::updateData(dt);
 }
 
 
+//------------------------------------------------------------------------------
+// startImage() -- Creates the image chip job and starts rendering it; the
+// chip is rendered by the thread pool, or by our background thread.
+//------------------------------------------------------------------------------
+void Sar::startImage()
+{
+   WorldModel* const sim = getWorldModel();
+   Player* const own = getOwnship();
+   if (sim == nullptr || own == nullptr) return;
+
+   // Drop any unfinished image
+   clearChips();
+
+   const double refLat = sim->getRefLatitude();
+   const double refLon = sim->getRefLongitude();
+
+   base::Vec3d starePos;
+   base::nav::convertLL2PosVec(
+      refLat, refLon,
+      getStarePointLatitude(), getStarePointLongitude(), getStarePointElevation(),
+      &starePos);
+
+   unsigned int w = width;
+   unsigned int h = height;
+   if (chipSize > 0) {
+      w = chipSize;
+      h = chipSize;
+   }
+   double res = getResolution();
+   if (res <= 0) res = 3.0 * base::distance::FT2M;
+
+   chip = new SarChip();
+   const terrain::Terrain* const terrain = static_cast<const WorldModel*>(sim)->getTerrain();
+   chip->setup(w, h, res, own->getPosition(), starePos, refLat, refLon, getFrequency(), terrain);
+
+   // Point returns from the active players within the chip; their RCS is
+   // sampled by the rendering threads.
+   const double maxRng = (w > h ? w : h) * res;
+   base::PairStream* players = sim->getPlayers();
+   if (players != nullptr) {
+      base::List::Item* item = players->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         const auto player = static_cast<Player*>(pair->object());
+         RfSignature* const sig = player->getSignature();
+         if (player != own && sig != nullptr && player->isActive() && !player->isDestroyed()) {
+            const base::Vec3d dp = player->getPosition() - starePos;
+            if ( std::fabs(dp.x()) < maxRng && std::fabs(dp.y()) < maxRng ) {
+               // Angles of incidence: the LOS back to the sensor in the target's body coordinates
+               const base::Vec3d aoi = player->getRotMat() * (own->getPosition() - player->getPosition());
+               const double az = std::atan2(aoi.y(), aoi.x());
+               const double el = std::atan2(-aoi.z(), std::sqrt(aoi.x() * aoi.x() + aoi.y() * aoi.y()));
+               chip->addTarget(player->getPosition(), sig, az, el);
+            }
+         }
+         item = item->getNext();
+      }
+      players->unref();
+   }
+
+   if (isMessageEnabled(MSG_INFO)) {
+      std::cout << "Sar:: Generating image (" << w << "," << h << "): resolution: " << res << std::endl;
+   }
+
+   // Post the chip to the background thread; an older chip that's
+   // still waiting is dropped.
+   chip->ref();
+   base::lock(chipLock);
+   SarChip* const old = pendingChip;
+   pendingChip = chip;
+   base::unlock(chipLock);
+   if (old != nullptr) old->unref();
+
+   busy = true;
+}
+
+//------------------------------------------------------------------------------
+// finishImage() -- Adds the rendered image chip to our list of images
+//------------------------------------------------------------------------------
+void Sar::finishImage()
+{
+   const auto p = new Image();
+   p->setImageData(chip->getImageData(), chip->getWidth(), chip->getHeight(), 1);
+   p->setImageId(getNextId());
+   p->setLatitude(getStarePointLatitude());
+   p->setLongitude(getStarePointLongitude());
+   p->setElevation(getStarePointElevation());
+   p->setOrientation(chip->getLookBearing() * base::angle::R2DCC);
+   p->setResolution(chip->getResolution());
+   const auto pp = new base::Pair("image", p);
+   addImage(pp);
+   pp->unref();
+   p->unref();
+
+   chip->unref();
+   chip = nullptr;
+   busy = false;
+}
+
+//------------------------------------------------------------------------------
+// clearChips() -- Drops any image chips; a chip being rendered is canceled,
+// and released by its rendering threads.
+//------------------------------------------------------------------------------
+void Sar::clearChips()
+{
+   base::lock(chipLock);
+   SarChip* const p = pendingChip;
+   pendingChip = nullptr;
+   base::unlock(chipLock);
+   if (p != nullptr) p->unref();
+
+   if (chip != nullptr) {
+      chip->cancel();
+      chip->unref();
+      chip = nullptr;
+   }
+}
+
+//------------------------------------------------------------------------------
+// destroyPool() -- Shuts down the thread pool
+//------------------------------------------------------------------------------
+void Sar::destroyPool()
+{
+   if (pool != nullptr) {
+      pool->destroy();
+      pool->unref();
+      pool = nullptr;
+   }
+   if (poolChip != nullptr) {
+      poolChip->unref();
+      poolChip = nullptr;
+   }
+}
+
 //------------------------------------------------------------------------------
 // getNextId() -- Get the next image ID and increment the counter
 //------------------------------------------------------------------------------
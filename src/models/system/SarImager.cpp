@@ -0,0 +1,379 @@
+#include "openeaagles/models/system/SarImager.hpp"
+
+#include "openeaagles/models/Signatures.hpp"
+#include "openeaagles/terrain/Terrain.hpp"
+
+#include "openeaagles/base/util/atomics.hpp"
+#include "openeaagles/base/util/nav_utils.hpp"
+#include "openeaagles/base/units/angle_utils.hpp"
+
+#include <cmath>
+#include <memory>
+
+namespace oe {
+namespace models {
+
+//==============================================================================
+// Class: SarChip
+//==============================================================================
+IMPLEMENT_EMPTY_SLOTTABLE_SUBCLASS(SarChip, "SarChip")
+EMPTY_SERIALIZER(SarChip)
+
+// Constant-gamma terrain backscatter coefficient
+static const double TERRAIN_GAMMA = 0.1;
+
+// Gray scale mapping of the pixel reflectivity (dB)
+static const double MIN_DB = -30.0;
+static const double MAX_DB =  10.0;
+
+SarChip::SarChip()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void SarChip::copyData(const SarChip& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   width = org.width;
+   height = org.height;
+   resolution = org.resolution;
+   sensorPos = org.sensorPos;
+   starePos = org.starePos;
+   refLat = org.refLat;
+   refLon = org.refLon;
+   freq = org.freq;
+   lookBrg = org.lookBrg;
+   cosBrg = org.cosBrg;
+   sinBrg = org.sinBrg;
+
+   if (terrain != nullptr) terrain->unref();
+   terrain = org.terrain;
+   if (terrain != nullptr) terrain->ref();
+
+   clearTargets();
+   targets = org.targets;
+   for (const Target& tgt : targets) {
+      if (tgt.sig != nullptr) tgt.sig->ref();
+   }
+
+   image = org.image;
+   nextColumn = org.nextColumn;
+   columnsDone = org.columnsDone;
+   columnsClaimed = org.columnsClaimed;
+   bandLock = 0;
+}
+
+void SarChip::deleteData()
+{
+   if (terrain != nullptr) {
+      terrain->unref();
+      terrain = nullptr;
+   }
+   clearTargets();
+}
+
+void SarChip::clearTargets()
+{
+   for (const Target& tgt : targets) {
+      if (tgt.sig != nullptr) tgt.sig->unref();
+   }
+   targets.clear();
+}
+
+//------------------------------------------------------------------------------
+// setup() -- sets up the chip's imaging geometry; clears targets and the image
+//------------------------------------------------------------------------------
+void SarChip::setup(
+      const unsigned int w,
+      const unsigned int h,
+      const double res,
+      const base::Vec3d& sPos,
+      const base::Vec3d& tPos,
+      const double lat,
+      const double lon,
+      const double f,
+      const terrain::Terrain* const terr
+   )
+{
+   width = w;
+   height = h;
+   resolution = (res > 0 ? res : 1.0);
+   sensorPos = sPos;
+   starePos = tPos;
+   refLat = lat;
+   refLon = lon;
+   freq = f;
+
+   // Look direction: sensor to stare point
+   lookBrg = std::atan2( (starePos.y() - sensorPos.y()), (starePos.x() - sensorPos.x()) );
+   cosBrg = std::cos(lookBrg);
+   sinBrg = std::sin(lookBrg);
+
+   if (terrain != nullptr) terrain->unref();
+   terrain = terr;
+   if (terrain != nullptr) terrain->ref();
+
+   clearTargets();
+   image.assign(width * height, 0);
+
+   nextColumn = 0;
+   columnsDone = 0;
+   columnsClaimed = 0;
+}
+
+void SarChip::addTarget(const base::Vec3d& pos, RfSignature* const sig, const double az, const double el)
+{
+   if (sig == nullptr) return;
+   Target tgt;
+   tgt.pos = pos;
+   tgt.sig = sig;
+   tgt.az = az;
+   tgt.el = el;
+   sig->ref();
+   targets.push_back(tgt);
+}
+
+//------------------------------------------------------------------------------
+// isDone() -- True when all columns have been rendered
+//------------------------------------------------------------------------------
+bool SarChip::isDone() const
+{
+   base::lock(bandLock);
+   const bool done = (columnsDone >= width);
+   base::unlock(bandLock);
+   return done;
+}
+
+//------------------------------------------------------------------------------
+// isIdle() -- True when no thread is rendering a band of the chip
+//------------------------------------------------------------------------------
+bool SarChip::isIdle() const
+{
+   base::lock(bandLock);
+   const bool idle = (columnsDone >= columnsClaimed);
+   base::unlock(bandLock);
+   return idle;
+}
+
+//------------------------------------------------------------------------------
+// cancel() -- no more bands are handed out; bands already claimed are finished
+//------------------------------------------------------------------------------
+void SarChip::cancel()
+{
+   base::lock(bandLock);
+   nextColumn = width;
+   base::unlock(bandLock);
+}
+
+//------------------------------------------------------------------------------
+// Band management
+//------------------------------------------------------------------------------
+bool SarChip::claimBand(unsigned int* const c0, unsigned int* const c1)
+{
+   base::lock(bandLock);
+   const bool ok = (nextColumn < width);
+   if (ok) {
+      *c0 = nextColumn;
+      nextColumn += BAND_SIZE;
+      if (nextColumn > width) nextColumn = width;
+      *c1 = nextColumn;
+      columnsClaimed += (*c1 - *c0);
+   }
+   base::unlock(bandLock);
+   return ok;
+}
+
+void SarChip::bandDone(const unsigned int n)
+{
+   base::lock(bandLock);
+   columnsDone += n;
+   base::unlock(bandLock);
+}
+
+//------------------------------------------------------------------------------
+// render() -- renders bands of columns until there are none left
+//------------------------------------------------------------------------------
+void SarChip::render()
+{
+   if (width == 0 || height == 0) return;
+
+   // Per thread work arrays; the far end of each range line is extended
+   // so that tall terrain beyond the chip can layover into it.
+   const unsigned int ns = height + height/8 + 1;
+   std::vector<double> elev(ns);
+   std::unique_ptr<bool[]> valid(new bool[ns]);
+   std::vector<double> maxSlope(ns);
+   std::vector<double> acc(height);
+
+   unsigned int c0 = 0;
+   unsigned int c1 = 0;
+   while (claimBand(&c0, &c1)) {
+      for (unsigned int c = c0; c < c1; c++) {
+         renderColumn(c, elev.data(), valid.get(), maxSlope.data(), acc.data());
+      }
+      bandDone(c1 - c0);
+   }
+}
+
+//------------------------------------------------------------------------------
+// renderColumn() -- renders one range line (column) of the chip
+//------------------------------------------------------------------------------
+void SarChip::renderColumn(
+      const unsigned int c,
+      double* const elev,
+      bool* const valid,
+      double* const maxSlope,
+      double* const acc
+   )
+{
+   const unsigned int ns = height + height/8 + 1;
+   const double res = resolution;
+   const double stareElev = -starePos.z();
+   const double sensorAlt = -sensorPos.z();
+   const double hRef = sensorAlt - stareElev;
+
+   // Column geometry, relative to the stare point: 'along' the look
+   // direction and 'cross' (right of) the look direction.
+   const double xc = (static_cast<double>(c) - static_cast<double>(width - 1) / 2.0) * res;
+   const double a0 = -(static_cast<double>(height - 1) / 2.0) * res;
+
+   const double dn = starePos.x() - sensorPos.x();
+   const double de = starePos.y() - sensorPos.y();
+   const double sa = -std::sqrt(dn*dn + de*de);    // Sensor's along offset (behind the stare point)
+
+   // ---
+   // 1) Terrain elevations along the range line
+   // ---
+   for (unsigned int i = 0; i < ns; i++) {
+      elev[i] = stareElev;
+      valid[i] = false;
+   }
+   if (terrain != nullptr && terrain->isDataLoaded()) {
+      const base::Vec3d p0(
+         starePos.x() + cosBrg * a0 - sinBrg * xc,
+         starePos.y() + sinBrg * a0 + cosBrg * xc,
+         0.0);
+      double lat0 = 0.0;
+      double lon0 = 0.0;
+      double alt0 = 0.0;
+      base::nav::convertPosVec2LL(refLat, refLon, p0, &lat0, &lon0, &alt0);
+      terrain->getElevations(elev, valid, ns, lat0, lon0, (lookBrg * base::angle::R2DCC), ((ns - 1) * res), true);
+      for (unsigned int i = 0; i < ns; i++) {
+         if (!valid[i]) elev[i] = stareElev;
+      }
+   }
+
+   // ---
+   // 2, 3, 4) Shadowing, backscatter and layover
+   // ---
+   for (unsigned int b = 0; b < height; b++) acc[b] = 0.0;
+
+   double maxS = -1.0e30;
+   for (unsigned int i = 0; i < ns; i++) {
+      const double a = a0 + i * res;
+      const double ga = a - sa;                          // Ground range along the look direction
+      const double d = std::sqrt(ga*ga + xc*xc);         // Ground range from the sensor
+      const double dh = elev[i] - sensorAlt;
+
+      // Shadowed if a nearer sample has a higher look angle
+      const double slope = (d > 0 ? dh / d : 0.0);
+      const bool shadowed = (slope < maxS);
+      if (slope > maxS) maxS = slope;
+      maxSlope[i] = maxS;
+      if (shadowed) continue;
+
+      // Local grazing angle: flat grazing angle plus the terrain slope toward the sensor
+      const unsigned int im = (i > 0 ? i - 1 : i);
+      const unsigned int ip = (i < ns - 1 ? i + 1 : i);
+      const double tslope = (elev[ip] - elev[im]) / ((ip - im) * res);
+      const double graze = std::atan2(-dh, d) + std::atan(tslope);
+      if (graze <= 0) continue;
+      const double sigma0 = TERRAIN_GAMMA * std::sin(graze);
+
+      // Layover: slant range projected onto the stare point's plane
+      const double r2 = d*d + dh*dh;
+      const double g2 = r2 - hRef*hRef - xc*xc;
+      if (g2 < 0) continue;
+      const double ab = sa + std::sqrt(g2);
+      const int bin = static_cast<int>(std::floor((ab - a0) / res + 0.5));
+      if (bin >= 0 && bin < static_cast<int>(height)) acc[bin] += sigma0;
+   }
+
+   // ---
+   // 5) Point targets
+   // ---
+   const double cOffset = static_cast<double>(width - 1) / 2.0;
+   for (const Target& tgt : targets) {
+      const double tn = tgt.pos.x() - starePos.x();
+      const double te = tgt.pos.y() - starePos.y();
+      const double tx = -sinBrg * tn + cosBrg * te;
+      const int tc = static_cast<int>(std::floor(tx / res + cOffset + 0.5));
+      if (tc != static_cast<int>(c)) continue;
+
+      // Only this column's thread samples the target's RCS
+      double rcs = 0.0;
+      tgt.sig->getRCSArray(&tgt.az, &tgt.el, &freq, &rcs, 1);
+      if (rcs <= 0) continue;
+
+      const double ta = cosBrg * tn + sinBrg * te;
+      const double ga = ta - sa;
+      const double d = std::sqrt(ga*ga + tx*tx);
+      const double dh = -tgt.pos.z() - sensorAlt;
+
+      // Shadowed by the terrain in front of it?
+      const int ti = static_cast<int>(std::floor((ta - a0) / res + 0.5));
+      if (ti > 0 && ti < static_cast<int>(ns) && d > 0) {
+         if ((dh / d) < maxSlope[ti - 1]) continue;
+      }
+
+      const double r2 = d*d + dh*dh;
+      const double g2 = r2 - hRef*hRef - tx*tx;
+      if (g2 < 0) continue;
+      const double ab = sa + std::sqrt(g2);
+      const int bin = static_cast<int>(std::floor((ab - a0) / res + 0.5));
+      if (bin >= 0 && bin < static_cast<int>(height)) acc[bin] += rcs / (res * res);
+   }
+
+   // ---
+   // Gray scale; far range at the top (row zero)
+   // ---
+   unsigned char* const p = image.data();
+   for (unsigned int b = 0; b < height; b++) {
+      unsigned char v = 0;
+      if (acc[b] > 0) {
+         const double db = 10.0 * std::log10(acc[b]);
+         double g = (db - MIN_DB) / (MAX_DB - MIN_DB) * 255.0;
+         if (g < 0) g = 0;
+         if (g > 255.0) g = 255.0;
+         v = static_cast<unsigned char>(g);
+      }
+      p[(height - 1 - b) * width + c] = v;
+   }
+}
+
+//==============================================================================
+// Class: SarImager
+//==============================================================================
+IMPLEMENT_EMPTY_SLOTTABLE_SUBCLASS(SarImager, "SarImager")
+EMPTY_SERIALIZER(SarImager)
+EMPTY_COPYDATA(SarImager)
+EMPTY_DELETEDATA(SarImager)
+
+SarImager::SarImager()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void SarImager::execute(base::Object* const, base::Object* cur)
+{
+   // The chip was ref()'d for us by the Sar
+   const auto chip = dynamic_cast<SarChip*>(cur);
+   if (chip != nullptr) {
+      chip->render();
+      chip->unref();
+   }
+}
+
+}
+}
@@ -97,6 +97,48 @@ void ScanGimbal::reset()
    BaseClass::reset();
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our scan pattern state
+//------------------------------------------------------------------------------
+void ScanGimbal::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->putDoubles(scanPos.ptr(), 2);
+   cp->put(cprv);
+   cp->put(scanMode);
+   cp->put(scanWidth);
+   cp->put(scanHeight);
+   cp->put(scanState);
+   cp->putDoubles(refAngle.ptr(), 2);
+   cp->putDoubles(lastRefAngle.ptr(), 2);
+   cp->put(numBars);
+   cp->put(barSpacing);
+   cp->put(oddNumberOfBars);
+   cp->put(leftToRightScan);
+   cp->put(reverseScan);
+   cp->put(barNum);
+   cp->put(conAngle);
+   cp->put(myLastAngle);
+   cp->put(numRevs);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool ScanGimbal::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->getDoubles(scanPos.ptr(), 2) && rd->get(&cprv);
+   ok = ok && rd->get(&scanMode) && rd->get(&scanWidth) && rd->get(&scanHeight) && rd->get(&scanState);
+   ok = ok && rd->getDoubles(refAngle.ptr(), 2) && rd->getDoubles(lastRefAngle.ptr(), 2);
+   ok = ok && rd->get(&numBars) && rd->get(&barSpacing) && rd->get(&oddNumberOfBars);
+   ok = ok && rd->get(&leftToRightScan) && rd->get(&reverseScan) && rd->get(&barNum);
+   ok = ok && rd->get(&conAngle) && rd->get(&myLastAngle) && rd->get(&numRevs);
+   ok = ok && (cprv <= nprv);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // dynamics() -- System class "Dynamics phase" call back
 //------------------------------------------------------------------------------
@@ -66,6 +66,54 @@ void Stores::reset()
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our selected station and our stores, which
+// aren't our components, so they're saved here, in order
+//------------------------------------------------------------------------------
+void Stores::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(selected);
+
+   const base::PairStream* stores = getStores();
+   const auto n = static_cast<unsigned int>(stores != nullptr ? stores->entries() : 0);
+   cp->put(n);
+   if (stores != nullptr) {
+      const base::List::Item* item = stores->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<const base::Pair*>(item->getValue());
+         static_cast<const base::Component*>(pair->object())->saveState(cp);
+         item = item->getNext();
+      }
+      stores->unref();
+   }
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool Stores::restoreState(base::Checkpoint::Reader* const rd)
+{
+   unsigned int n {};
+   bool ok = rd->beginSection() && rd->get(&selected) && rd->get(&n);
+   ok = ok && (selected <= ns);
+
+   base::PairStream* stores = getStores();
+   ok = ok && (n == static_cast<unsigned int>(stores != nullptr ? stores->entries() : 0));
+   if (stores != nullptr) {
+      base::List::Item* item = stores->getFirstItem();
+      while (item != nullptr && ok) {
+         const auto pair = static_cast<base::Pair*>(item->getValue());
+         ok = static_cast<base::Component*>(pair->object())->restoreState(rd);
+         item = item->getNext();
+      }
+      stores->unref();
+   }
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // process() -- Process phase
 //------------------------------------------------------------------------------
@@ -71,6 +71,28 @@ void StoresMgr::process(const double dt)
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our gun select, delivery and arming modes
+//------------------------------------------------------------------------------
+void StoresMgr::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(gunFlg);
+   cp->put(mode);
+   cp->put(masterArm);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool StoresMgr::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&gunFlg) && rd->get(&mode) && rd->get(&masterArm);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // shutdownNotification() -- We're shutting down
 //------------------------------------------------------------------------------
@@ -441,6 +463,28 @@ void SimpleStoresMgr::process(const double dt)
    }
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our weapon released timer and current weapon
+//------------------------------------------------------------------------------
+void SimpleStoresMgr::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(wpnRelTimer);
+   cp->put(curWpnID);
+   cp->put(nCurWpn);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool SimpleStoresMgr::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection() && rd->get(&wpnRelTimer) && rd->get(&curWpnID) && rd->get(&nCurWpn);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // updateData() -- update non-time critical stuff here
 //------------------------------------------------------------------------------
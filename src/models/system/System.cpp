@@ -7,6 +7,9 @@
 
 #include "openeaagles/base/Number.hpp"
 #include "openeaagles/base/PairStream.hpp"
+#include "openeaagles/base/units/Distances.hpp"
+
+#include <climits>
 
 namespace oe {
 namespace models {
@@ -15,10 +18,16 @@ IMPLEMENT_SUBCLASS(System, "System")
 
 BEGIN_SLOTTABLE(System)
    "powerSwitch",    //  1) Power switch position ("OFF", "STBY", "ON") (default: "ON")
+   "ratePolicy",     //  2) Update rate policy ("full", "fixed", "ownship", "sensor", "demand") (default: "full")
+   "rateDivisor",    //  3) Frames per update at the reduced rate (default: 1)
+   "rateRange",      //  4) Range beyond which the "ownship" and "sensor" policies use the reduced rate (default: 0)
 END_SLOTTABLE(System)
 
 BEGIN_SLOT_MAP(System)
    ON_SLOT( 1, setSlotPowerSwitch, base::String)
+   ON_SLOT( 2, setSlotRatePolicy,  base::String)
+   ON_SLOT( 3, setSlotRateDivisor, base::Number)
+   ON_SLOT( 4, setSlotRateRange,   base::Distance)
 END_SLOT_MAP()
 
 BEGIN_EVENT_HANDLER(System)
@@ -39,6 +48,17 @@ void System::copyData(const System& org, const bool)
    ownship = nullptr;
 
    pwrSw = org.pwrSw;
+
+   ratePolicy = org.ratePolicy;
+   rateDiv = org.rateDiv;
+   rateRng = org.rateRng;
+   rateCurDiv = 1;
+   rateFrames = 0;
+   rateDt = 0.0;
+   rateDataDt = 0.0;
+   rateRun = true;
+   rateDataDue = false;
+   rateDemand = false;
 }
 
 void System::deleteData()
@@ -64,9 +84,52 @@ void System::reset()
    // We're nothing without an ownship ...
    if (ownship == nullptr && getOwnship() == nullptr) return;
 
+   // Start over at the full rate
+   rateCurDiv = 1;
+   rateFrames = 0;
+   rateDt = 0.0;
+   rateDataDt = 0.0;
+   rateRun = true;
+   rateDataDue = false;
+
    BaseClass::reset();
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our power switch and update rate state
+//------------------------------------------------------------------------------
+void System::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(pwrSw);
+   cp->put(rateCurDiv);
+   cp->put(rateFrames);
+   cp->put(rateDt);
+   cp->put(rateDataDt);
+   cp->put(rateRun);
+   cp->put(rateDataDue.load());
+   cp->put(rateDemand.load());
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool System::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool dataDue {};
+   bool demand {};
+   bool ok = rd->beginSection() && rd->get(&pwrSw);
+   ok = ok && rd->get(&rateCurDiv) && rd->get(&rateFrames) && rd->get(&rateDt) && rd->get(&rateDataDt);
+   ok = ok && rd->get(&rateRun) && rd->get(&dataDue) && rd->get(&demand);
+   if (ok) {
+      rateDataDue = dataDue;
+      rateDemand = demand;
+   }
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // updateData() -- update background data here
 //------------------------------------------------------------------------------
@@ -113,12 +176,12 @@ void System::updateTC(const double dt0)
          transmit(dt4);
          break;
 
-      case 2 : // Frame2 --- Receive method
-         receive(dt4);
+      case 2 : // Frame2 --- Receive method (suspended while our ownship is low fidelity)
+         if (!ownship->isLowFidelity()) receive(dt4);
          break;
 
-      case 3 : // Frame3 --- Process method
-         process(dt4);
+      case 3 : // Frame3 --- Process method (suspended while our ownship is low fidelity)
+         if (!ownship->isLowFidelity()) process(dt4);
          break;
    }
 
@@ -129,6 +192,83 @@ void System::updateTC(const double dt0)
    BaseClass::updateTC(dt);
 }
 
+//------------------------------------------------------------------------------
+// isTcFrameDue() -- update rate control: at the start of each frame (phase 0),
+// decide if we're running this frame; if we are, then 'dt' is set to the phase
+// delta time accumulated since our last update, for all four phases.
+//------------------------------------------------------------------------------
+bool System::isTcFrameDue(double* const dt)
+{
+   if (ratePolicy == RATE_FULL) return true;
+
+   // We're nothing without an ownship ...
+   if (ownship == nullptr && getOwnship() == nullptr) return true;
+   WorldModel* sim = ownship->getWorldModel();
+   if (sim == nullptr) return true;
+
+   if (sim->phase() == 0) {
+      if (rateRun) {
+         rateFrames = 0;
+         rateDt = 0.0;
+      }
+      rateFrames++;
+      if (!isFrozen()) rateDt += *dt;
+
+      rateRun = (rateFrames >= rateCurDiv);
+      if (ratePolicy == RATE_DEMAND && rateDemand.exchange(false)) rateRun = true;
+
+      if (rateRun) {
+         rateCurDiv = computeRateDivisor();
+         rateDataDue = true;
+      }
+   }
+
+   if (rateRun) *dt = rateDt;
+   return rateRun;
+}
+
+//------------------------------------------------------------------------------
+// isDataFrameDue() -- update rate control: background updates only after a
+// time-critical update, with the delta time since our last background update
+//------------------------------------------------------------------------------
+bool System::isDataFrameDue(double* const dt)
+{
+   if (ratePolicy == RATE_FULL) return true;
+
+   rateDataDt += *dt;
+   if (!rateDataDue.exchange(false)) return false;
+
+   *dt = rateDataDt;
+   rateDataDt = 0.0;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// computeRateDivisor() -- frames per update until our next update
+//------------------------------------------------------------------------------
+unsigned int System::computeRateDivisor()
+{
+   unsigned int n = 1;
+   switch (ratePolicy) {
+
+      case RATE_FIXED :
+         n = rateDiv;
+         break;
+
+      case RATE_OWNSHIP :
+      case RATE_SENSOR : {
+         const double rng = ownship->getWorldModel()->getRateRefRange(ownship, (ratePolicy == RATE_SENSOR));
+         if (rng > rateRng) n = rateDiv;
+      }
+      break;
+
+      case RATE_DEMAND :
+         n = (rateDiv > 1) ? rateDiv : UINT_MAX;
+         break;
+   }
+   return n;
+}
+
 //------------------------------------------------------------------------------
 // Default phase callbacks
 //------------------------------------------------------------------------------
@@ -193,6 +333,24 @@ unsigned int System::getPowerSwitch() const
    return pwrSw;
 }
 
+// Update rate policy (see rate enumeration)
+unsigned int System::getRatePolicy() const
+{
+   return ratePolicy;
+}
+
+// Frames per update at the reduced rate
+unsigned int System::getRateDivisor() const
+{
+   return rateDiv;
+}
+
+// Range for the reduced rate (meters)
+double System::getRateRange() const
+{
+   return rateRng;
+}
+
 // Returns a pointer to our ownship player
 Player* System::getOwnship()
 {
@@ -220,6 +378,39 @@ bool System::setPowerSwitch(const unsigned int p)
    return true;
 }
 
+// Sets the update rate policy (see rate enumeration)
+bool System::setRatePolicy(const unsigned int p)
+{
+   bool ok = (p <= RATE_DEMAND);
+   if (ok) {
+      ratePolicy = p;
+      rateCurDiv = 1;
+   }
+   return ok;
+}
+
+// Sets the frames per update at the reduced rate
+bool System::setRateDivisor(const unsigned int n)
+{
+   bool ok = (n >= 1);
+   if (ok) rateDiv = n;
+   return ok;
+}
+
+// Sets the range for the reduced rate (meters)
+bool System::setRateRange(const double m)
+{
+   bool ok = (m >= 0.0);
+   if (ok) rateRng = m;
+   return ok;
+}
+
+// Requests an update next frame ("demand" policy); from any thread
+void System::requestUpdate()
+{
+   rateDemand = true;
+}
+
 // find our ownship
 bool System::findOwnship()
 {
@@ -244,6 +435,47 @@ bool System::setSlotPowerSwitch(const base::String* const msg)
    return ok;
 }
 
+bool System::setSlotRatePolicy(const base::String* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      if (*msg == "full") ok = setRatePolicy(RATE_FULL);
+      else if (*msg == "fixed") ok = setRatePolicy(RATE_FIXED);
+      else if (*msg == "ownship") ok = setRatePolicy(RATE_OWNSHIP);
+      else if (*msg == "sensor") ok = setRatePolicy(RATE_SENSOR);
+      else if (*msg == "demand") ok = setRatePolicy(RATE_DEMAND);
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "System::setSlotRatePolicy(): invalid policy: " << *msg << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool System::setSlotRateDivisor(const base::Number* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      const int n = msg->getInt();
+      if (n >= 1) ok = setRateDivisor(static_cast<unsigned int>(n));
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "System::setSlotRateDivisor(): must be one or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool System::setSlotRateRange(const base::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setRateRange(base::Meters::convertStatic(*msg));
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "System::setSlotRateRange(): must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
 std::ostream& System::serialize(std::ostream& sout, const int i, const bool slotsOnly) const
 {
    int j = 0;
@@ -264,6 +496,25 @@ std::ostream& System::serialize(std::ostream& sout, const int i, const bool slot
       sout << std::endl;
    }
 
+   // Update rate policy
+   if (getRatePolicy() != RATE_FULL) {
+      indent(sout,i+j);
+      sout << "ratePolicy: " ;
+      switch (getRatePolicy()) {
+         case RATE_FIXED : sout << "fixed"; break;
+         case RATE_OWNSHIP : sout << "ownship"; break;
+         case RATE_SENSOR : sout << "sensor"; break;
+         case RATE_DEMAND : sout << "demand"; break;
+      }
+      sout << std::endl;
+
+      indent(sout,i+j);
+      sout << "rateDivisor: " << getRateDivisor() << std::endl;
+
+      indent(sout,i+j);
+      sout << "rateRange: ( Meters " << getRateRange() << " )" << std::endl;
+   }
+
    BaseClass::serialize(sout,i+j,true);
 
    if ( !slotsOnly ) {
@@ -146,6 +146,59 @@ void TrackManager::reset()
    nextTrkId = firstTrkId;
 }
 
+//------------------------------------------------------------------------------
+// saveState() -- save our next track ID and our tracks, each with its type:
+// 0 -- Track, 1 -- RfTrack, 2 -- IrTrack.  Queued reports aren't saved.
+//------------------------------------------------------------------------------
+void TrackManager::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(nextTrkId);
+
+   base::lock(trkListLock);
+   cp->put(nTrks);
+   for (unsigned int i = 0; i < nTrks; i++) {
+      unsigned char kind {};
+      if (dynamic_cast<const RfTrack*>(tracks[i]) != nullptr) kind = 1;
+      else if (dynamic_cast<const IrTrack*>(tracks[i]) != nullptr) kind = 2;
+      cp->put(kind);
+      tracks[i]->saveState(cp);
+   }
+   base::unlock(trkListLock);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+//------------------------------------------------------------------------------
+// restoreState() -- replace our tracks with the checkpoint's (see saveState())
+//------------------------------------------------------------------------------
+bool TrackManager::restoreState(base::Checkpoint::Reader* const rd)
+{
+   clearTracksAndQueues();
+
+   unsigned int n {};
+   bool ok = rd->beginSection() && rd->get(&nextTrkId) && rd->get(&n);
+   ok = ok && (n <= maxTrks);
+
+   WorldModel* const sim = getWorldModel();
+   for (unsigned int i = 0; i < n && ok; i++) {
+      unsigned char kind {};
+      ok = rd->get(&kind) && (kind <= 2);
+      if (ok) {
+         Track* trk {};
+         if (kind == 1) trk = new RfTrack();
+         else if (kind == 2) trk = new IrTrack();
+         else trk = new Track();
+         ok = trk->restoreState(rd, sim) && addTrack(trk);
+         trk->unref();
+      }
+   }
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //------------------------------------------------------------------------------
 // shutdownNotification() -- Shutdown the simulation
 //------------------------------------------------------------------------------
@@ -320,6 +373,23 @@ void TrackManager::newReport(Emission* em, double sn)
    }
 }
 
+//------------------------------------------------------------------------------
+// newReports() -- Accept a batch of new emission reports
+//------------------------------------------------------------------------------
+void TrackManager::newReports(Emission* const* const ems, const double* const sn, const unsigned int n)
+{
+   // Queue up emissions reports
+   base::lock(queueLock);
+   for (unsigned int i = 0; i < n && emQueue.isNotFull(); i++) {
+      if (ems[i] != nullptr) {
+         ems[i]->ref();
+         emQueue.put(ems[i]);
+         snQueue.put(sn[i]);
+      }
+   }
+   base::unlock(queueLock);
+}
+
 //------------------------------------------------------------------------------
 // getReport() -- Get the next 'new' report of the queue
 //------------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 #include "openeaagles/otw/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/otw/Otm.hpp"
 
@@ -17,26 +18,17 @@ namespace otw {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    // Common Image Generation Interface (CIGI)
-    if ( name == OtwCigiCl::getFactoryName() ) {
-        obj = new OtwCigiCl();
-    }
-    else if ( name == CigiClNetwork::getFactoryName() ) {
-        obj = new CigiClNetwork();
-    }
-
-    // PC Visual Driver
-    else if ( name == OtwPC::getFactoryName() ) {
-        obj = new OtwPC();
-    }
-
-    else if ( name == Otm::getFactoryName() ) {
-        obj = new Otm();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        // Common Image Generation Interface (CIGI)
+        { OtwCigiCl::getFactoryName(),      base::FactoryTable::make<OtwCigiCl> },
+        { CigiClNetwork::getFactoryName(),  base::FactoryTable::make<CigiClNetwork> },
+
+        // PC Visual Driver
+        { OtwPC::getFactoryName(),          base::FactoryTable::make<OtwPC> },
+
+        { Otm::getFactoryName(),            base::FactoryTable::make<Otm> },
+    };
+    return table.create(name);
 }
 
 }
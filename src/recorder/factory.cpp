@@ -2,6 +2,7 @@
 #include "openeaagles/recorder/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/recorder/DataRecorder.hpp"
 #include "openeaagles/recorder/FileWriter.hpp"
@@ -20,37 +21,18 @@ namespace recorder {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    if ( name == FileWriter::getFactoryName() ) {
-        obj = new FileWriter();
-    }
-    else if ( name == FileReader::getFactoryName() ) {
-        obj = new FileReader();
-    }
-    else if ( name == NetInput::getFactoryName() ) {
-        obj = new NetInput();
-    }
-    else if ( name == NetOutput::getFactoryName() ) {
-        obj = new NetOutput();
-    }
-    else if ( name == OutputHandler::getFactoryName() ) {
-        obj = new OutputHandler();
-    }
-    else if ( name == TabPrinter::getFactoryName() ) {
-        obj = new TabPrinter();
-    }
-    else if ( name == PrintPlayer::getFactoryName() ) {
-        obj = new PrintPlayer();
-    }
-    else if ( name == DataRecorder::getFactoryName()) {
-        obj = new DataRecorder();
-    }
-    else if ( name == PrintSelected::getFactoryName() ) {
-        obj = new PrintSelected();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        { FileWriter::getFactoryName(),     base::FactoryTable::make<FileWriter> },
+        { FileReader::getFactoryName(),     base::FactoryTable::make<FileReader> },
+        { NetInput::getFactoryName(),       base::FactoryTable::make<NetInput> },
+        { NetOutput::getFactoryName(),      base::FactoryTable::make<NetOutput> },
+        { OutputHandler::getFactoryName(),  base::FactoryTable::make<OutputHandler> },
+        { TabPrinter::getFactoryName(),     base::FactoryTable::make<TabPrinter> },
+        { PrintPlayer::getFactoryName(),    base::FactoryTable::make<PrintPlayer> },
+        { DataRecorder::getFactoryName(),   base::FactoryTable::make<DataRecorder> },
+        { PrintSelected::getFactoryName(),  base::FactoryTable::make<PrintSelected> },
+    };
+    return table.create(name);
 }
 
 }
@@ -103,6 +103,28 @@ void AbstractPlayer::reset()
    BaseClass::reset();
 }
 
+//------------------------------------------------------------------------------
+// saveState(), restoreState() -- our mode
+//------------------------------------------------------------------------------
+void AbstractPlayer::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(mode);
+   cp->endSection();
+
+   BaseClass::saveState(cp);
+}
+
+bool AbstractPlayer::restoreState(base::Checkpoint::Reader* const rd)
+{
+   Mode m {};
+   bool ok = rd->beginSection() && rd->get(&m);
+   if (ok) setMode(m);
+   ok = rd->endSection() && ok;
+
+   return ok && BaseClass::restoreState(rd);
+}
+
 //-----------------------------------------------------------------------------
 
 // Sets the player's ID
@@ -0,0 +1,556 @@
+
+#include "openeaagles/simulation/BatchRunner.hpp"
+
+#include "openeaagles/simulation/AbstractDataRecorder.hpp"
+#include "openeaagles/simulation/BatchThread.hpp"
+#include "openeaagles/simulation/Simulation.hpp"
+#include "openeaagles/simulation/Station.hpp"
+
+#include "openeaagles/base/Checkpoint.hpp"
+#include "openeaagles/base/List.hpp"
+#include "openeaagles/base/Number.hpp"
+#include "openeaagles/base/Rng.hpp"
+#include "openeaagles/base/String.hpp"
+#include "openeaagles/base/units/Times.hpp"
+#include "openeaagles/base/util/atomics.hpp"
+#include "openeaagles/base/util/system_utils.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace oe {
+namespace simulation {
+
+IMPLEMENT_SUBCLASS(BatchRunner, "BatchRunner")
+
+BEGIN_SLOTTABLE(BatchRunner)
+   "station",           //  1: Station prototype
+   "replications",      //  2: Number of replications
+   "threads",           //  3: Number of replications to run at a time (zero for one per processor)
+   "seed",              //  4: Random number seed of the first replication
+   "runTime",           //  5: Simulated run time of each replication (base::Time)
+   "rate",              //  6: Frame rate (Hz) (zero for the station's tcRate)
+   "cpus",              //  7: Processor set of the batch threads (base::List)
+   "checkpoint",        //  8: Checkpoint file to branch each replication from (base::String)
+END_SLOTTABLE(BatchRunner)
+
+BEGIN_SLOT_MAP(BatchRunner)
+   ON_SLOT( 1, setSlotStation,       Station)
+   ON_SLOT( 2, setSlotReplications,  base::Number)
+   ON_SLOT( 3, setSlotThreads,       base::Number)
+   ON_SLOT( 4, setSlotSeed,          base::Number)
+   ON_SLOT( 5, setSlotRunTime,       base::Time)
+   ON_SLOT( 6, setSlotRate,          base::Number)
+   ON_SLOT( 7, setSlotCpus,          base::List)
+   ON_SLOT( 8, setSlotCheckpoint,    base::String)
+END_SLOT_MAP()
+
+BatchRunner::BatchRunner()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void BatchRunner::copyData(const BatchRunner& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   if (org.station != nullptr) {
+      Station* copy = org.station->clone();
+      setStation(copy);
+      copy->unref();
+   }
+   else {
+      setStation(nullptr);
+   }
+
+   numReps = org.numReps;
+   numThreads = org.numThreads;
+   seed0 = org.seed0;
+   runTime = org.runTime;
+   rate = org.rate;
+   cpus = org.cpus;
+   setCheckpoint(org.checkpoint);
+
+   numCompleted = 0;
+   simTime = 0.0;
+   wallTime = 0.0;
+   threadsUsed = 0;
+}
+
+void BatchRunner::deleteData()
+{
+   setStation(nullptr);
+   setCheckpoint(nullptr);
+}
+
+//------------------------------------------------------------------------------
+// run() -- Runs all of the replications
+//------------------------------------------------------------------------------
+bool BatchRunner::run()
+{
+   if (station == nullptr) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::run(): ERROR, no station prototype" << std::endl;
+      }
+      return false;
+   }
+
+   // Number of threads, including this one
+   unsigned int n = numThreads;
+   if (n == 0) n = base::Thread::getNumProcessors();
+   if (n == 0) n = 1;
+   if (n > numReps) n = numReps;
+   if (n == 0) n = 1;
+
+   nextRep = 0;
+   numCompleted = 0;
+   threadsDone = 0;
+   simTime = 0.0;
+
+   const double t0 = base::getComputerTime();
+
+   // Start the other threads at normal (time sharing) priority
+   std::vector<BatchThread*> threads;
+   for (unsigned int i = 1; i < n; i++) {
+      const auto thread = new BatchThread(this, 0.0);
+      if (!cpus.empty()) thread->setCpuAffinity(cpus);
+      if (thread->create()) {
+         threads.push_back(thread);
+      }
+      else {
+         thread->unref();
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "BatchRunner::run(): ERROR, unable to create batch thread " << i << std::endl;
+         }
+      }
+   }
+   const auto nStarted = static_cast<unsigned int>(threads.size() + 1);
+
+   // We're a batch thread too
+   runReplications();
+
+   // Wait for the other threads to finish their last replications
+   while (threadsDone.load() < nStarted) {
+      base::msleep(1);
+   }
+   for (BatchThread* thread : threads) {
+      thread->unref();
+   }
+
+   wallTime = base::getComputerTime() - t0;
+   threadsUsed = nStarted;
+
+   return (numCompleted.load() == numReps);
+}
+
+//------------------------------------------------------------------------------
+// runReplications() -- Runs the next replications until there are none left
+//------------------------------------------------------------------------------
+void BatchRunner::runReplications()
+{
+   unsigned int idx = nextRep.fetch_add(1);
+   while (idx < numReps && !isShutdown()) {
+      const double t = runReplication(idx);
+      if (t >= 0) {
+         base::lock(simTimeLock);
+         simTime += t;
+         base::unlock(simTimeLock);
+         numCompleted.fetch_add(1);
+      }
+      idx = nextRep.fetch_add(1);
+   }
+   threadsDone.fetch_add(1);
+}
+
+//------------------------------------------------------------------------------
+// runReplication() -- Runs replication 'idx' to completion; returns the
+// simulated time (sec), or less than zero if the replication wasn't run.
+//------------------------------------------------------------------------------
+double BatchRunner::runReplication(const unsigned int idx)
+{
+   // Seed our thread's random number stream
+   const auto rng = new base::Rng(seed0 + idx);
+   rng->unref();
+
+   // Our own copy of the station
+   Station* const s = station->clone();
+   if (s == nullptr) return -1.0;
+   s->event(RESET_EVENT);
+
+   // ... and the streams of its T/C and background pool threads
+   Simulation* const sim = s->getSimulation();
+   if (sim != nullptr) sim->seedRngStreams(seed0 + idx);
+
+   // Branch from the checkpoint, with our own random number streams
+   if (checkpoint != nullptr) {
+      if (sim == nullptr || !sim->restore(checkpoint)) {
+         if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "BatchRunner::runReplication(): ERROR, unable to restore the checkpoint; replication " << idx << std::endl;
+         }
+         s->event(SHUTDOWN_EVENT);
+         s->unref();
+         return -1.0;
+      }
+      const auto rng1 = new base::Rng(seed0 + idx);
+      rng1->unref();
+      sim->seedRngStreams(seed0 + idx);
+   }
+
+   replicationStarted(idx, s);
+
+   const double hz = (rate > 0 ? rate : s->getTimeCriticalRate());
+   const double dt = 1.0 / hz;
+   const auto numFrames = static_cast<unsigned long long>(runTime * hz + 0.5);
+
+   unsigned long long frames = 0;
+   bool done = false;
+   while (frames < numFrames && !done && !isShutdown()) {
+      s->tcFrame(dt);
+      s->processBackgroundTasks(dt);
+      AbstractDataRecorder* const dr = s->getDataRecorder();
+      if (dr != nullptr) dr->processRecords();
+
+      frames++;
+      done = isReplicationDone(idx, s);
+   }
+
+   replicationCompleted(idx, s);
+
+   s->event(SHUTDOWN_EVENT);
+   s->unref();
+
+   return static_cast<double>(frames) * dt;
+}
+
+//------------------------------------------------------------------------------
+// Replication hooks -- default: nothing to do
+//------------------------------------------------------------------------------
+void BatchRunner::replicationStarted(const unsigned int, Station* const)
+{
+}
+
+bool BatchRunner::isReplicationDone(const unsigned int, const Station* const) const
+{
+   return false;
+}
+
+void BatchRunner::replicationCompleted(const unsigned int, Station* const)
+{
+}
+
+//------------------------------------------------------------------------------
+// Get functions
+//------------------------------------------------------------------------------
+const Station* BatchRunner::getStation() const
+{
+   return station;
+}
+
+unsigned int BatchRunner::getNumReplications() const
+{
+   return numReps;
+}
+
+unsigned int BatchRunner::getNumThreads() const
+{
+   return numThreads;
+}
+
+unsigned int BatchRunner::getSeed() const
+{
+   return seed0;
+}
+
+double BatchRunner::getRunTime() const
+{
+   return runTime;
+}
+
+double BatchRunner::getRate() const
+{
+   return rate;
+}
+
+const std::vector<unsigned int>& BatchRunner::getCpus() const
+{
+   return cpus;
+}
+
+const base::Checkpoint* BatchRunner::getCheckpoint() const
+{
+   return checkpoint;
+}
+
+unsigned int BatchRunner::getNumCompleted() const
+{
+   return numCompleted.load();
+}
+
+unsigned int BatchRunner::getNumThreadsUsed() const
+{
+   return threadsUsed;
+}
+
+double BatchRunner::getSimulatedTime() const
+{
+   return simTime;
+}
+
+double BatchRunner::getWallTime() const
+{
+   return wallTime;
+}
+
+// Simulated seconds per wall clock second per core; the number of cores is the
+// number of threads used, up to the number of processors.
+double BatchRunner::getThroughput() const
+{
+   unsigned int cores = threadsUsed;
+   const unsigned int np = base::Thread::getNumProcessors();
+   if (np > 0 && cores > np) cores = np;
+
+   double tp = 0.0;
+   if (wallTime > 0 && cores > 0) tp = simTime / wallTime / static_cast<double>(cores);
+   return tp;
+}
+
+void BatchRunner::printStats(std::ostream& sout) const
+{
+   sout << "BatchRunner: " << getNumCompleted() << " of " << numReps << " replications";
+   sout << ", " << threadsUsed << " threads";
+   sout << "; simulated " << simTime << " sec in " << wallTime << " sec";
+   sout << "; " << getThroughput() << " sim-sec/sec/core" << std::endl;
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+bool BatchRunner::setStation(Station* const s)
+{
+   if (station != nullptr) station->unref();
+   station = s;
+   if (station != nullptr) station->ref();
+   return true;
+}
+
+bool BatchRunner::setNumReplications(const unsigned int n)
+{
+   numReps = n;
+   return true;
+}
+
+bool BatchRunner::setNumThreads(const unsigned int n)
+{
+   numThreads = n;
+   return true;
+}
+
+bool BatchRunner::setSeed(const unsigned int s)
+{
+   seed0 = s;
+   return true;
+}
+
+bool BatchRunner::setRunTime(const double sec)
+{
+   bool ok = false;
+   if (sec >= 0) {
+      runTime = sec;
+      ok = true;
+   }
+   return ok;
+}
+
+bool BatchRunner::setRate(const double hz)
+{
+   bool ok = false;
+   if (hz >= 0) {
+      rate = hz;
+      ok = true;
+   }
+   return ok;
+}
+
+bool BatchRunner::setCpus(const std::vector<unsigned int>& x)
+{
+   cpus = x;
+   return true;
+}
+
+bool BatchRunner::setCheckpoint(const base::Checkpoint* const cp)
+{
+   if (checkpoint != nullptr) checkpoint->unref();
+   checkpoint = cp;
+   if (checkpoint != nullptr) checkpoint->ref();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+bool BatchRunner::setSlotStation(Station* const s)
+{
+   return setStation(s);
+}
+
+bool BatchRunner::setSlotReplications(const base::Number* const num)
+{
+   bool ok = false;
+   if (num != nullptr) {
+      const int n = num->getInt();
+      if (n >= 0) {
+         ok = setNumReplications(static_cast<unsigned int>(n));
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::setSlotReplications(): invalid number of replications; must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool BatchRunner::setSlotThreads(const base::Number* const num)
+{
+   bool ok = false;
+   if (num != nullptr) {
+      const int n = num->getInt();
+      if (n >= 0) {
+         ok = setNumThreads(static_cast<unsigned int>(n));
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::setSlotThreads(): invalid number of threads; must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool BatchRunner::setSlotSeed(const base::Number* const num)
+{
+   bool ok = false;
+   if (num != nullptr) {
+      ok = setSeed(static_cast<unsigned int>(num->getInt()));
+   }
+   return ok;
+}
+
+bool BatchRunner::setSlotRunTime(const base::Time* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      ok = setRunTime( base::Seconds::convertStatic(*msg) );
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::setSlotRunTime(): invalid run time; must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool BatchRunner::setSlotRate(const base::Number* const num)
+{
+   bool ok = false;
+   if (num != nullptr) {
+      ok = setRate(num->getReal());
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::setSlotRate(): invalid frame rate; must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool BatchRunner::setSlotCpus(const base::List* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      static const unsigned int MAX_CPUS = 1024;
+      int values[MAX_CPUS];
+      const unsigned int n = msg->getNumberList(values, MAX_CPUS);
+      const unsigned int numCpus = base::Thread::getNumOnlineCpus();
+      std::vector<unsigned int> x;
+      unsigned int dropped = 0;
+      ok = true;
+      for (unsigned int i = 0; i < n && ok; i++) {
+         if (values[i] < 0) ok = false;
+         else if (static_cast<unsigned int>(values[i]) < numCpus) x.push_back(static_cast<unsigned int>(values[i]));
+         else dropped++;
+      }
+      if (ok) {
+         ok = setCpus(x);
+         if (dropped > 0 && isMessageEnabled(MSG_WARNING)) {
+            std::cerr << "BatchRunner::setSlotCpus(): WARNING, ignored " << dropped << " processor number(s) that aren't online" << std::endl;
+         }
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::setSlotCpus(): invalid processor number(s)" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool BatchRunner::setSlotCheckpoint(const base::String* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      std::ifstream fin(msg->getString(), std::ios::in | std::ios::binary);
+      const auto cp = new base::Checkpoint();
+      ok = fin.is_open() && cp->read(fin);
+      if (ok) ok = setCheckpoint(cp);
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "BatchRunner::setSlotCheckpoint(): unable to read checkpoint file: " << msg->getString() << std::endl;
+      }
+      cp->unref();
+   }
+   return ok;
+}
+
+std::ostream& BatchRunner::serialize(std::ostream& sout, const int i, const bool slotsOnly) const
+{
+   int j = 0;
+   if ( !slotsOnly ) {
+      indent(sout,i);
+      sout << "( " << getFactoryName() << std::endl;
+      j = 4;
+   }
+
+   indent(sout,i+j);
+   sout << "replications: " << numReps << std::endl;
+
+   if (numThreads > 0) {
+      indent(sout,i+j);
+      sout << "threads: " << numThreads << std::endl;
+   }
+
+   indent(sout,i+j);
+   sout << "seed: " << seed0 << std::endl;
+
+   indent(sout,i+j);
+   sout << "runTime: ( Seconds " << runTime << " )" << std::endl;
+
+   if (rate > 0) {
+      indent(sout,i+j);
+      sout << "rate: " << rate << std::endl;
+   }
+
+   if (!cpus.empty()) {
+      indent(sout,i+j);
+      sout << "cpus: [";
+      for (const unsigned int cpu : cpus) sout << " " << cpu;
+      sout << " ]" << std::endl;
+   }
+
+   if (station != nullptr) {
+      indent(sout,i+j);
+      sout << "station: " << std::endl;
+      station->serialize(sout,(i+j));
+   }
+
+   BaseClass::serialize(sout,i+j,true);
+
+   if ( !slotsOnly ) {
+      indent(sout,i);
+      sout << ")" << std::endl;
+   }
+
+   return sout;
+}
+
+}
+}
@@ -0,0 +1,28 @@
+
+#include "openeaagles/simulation/BatchThread.hpp"
+
+#include "openeaagles/simulation/BatchRunner.hpp"
+
+namespace oe {
+namespace simulation {
+
+IMPLEMENT_SUBCLASS(BatchThread, "BatchThread")
+EMPTY_SLOTTABLE(BatchThread)
+EMPTY_COPYDATA(BatchThread)
+EMPTY_DELETEDATA(BatchThread)
+EMPTY_SERIALIZER(BatchThread)
+
+BatchThread::BatchThread(BatchRunner* const parent, const double priority): base::SingleTask(parent, priority)
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+unsigned long BatchThread::userFunc()
+{
+   BatchRunner* runner = static_cast<BatchRunner*>(getParent());
+   runner->runReplications();
+   return 0;
+}
+
+}
+}
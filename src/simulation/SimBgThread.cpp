@@ -20,7 +20,7 @@ SimBgThread::SimBgThread(base::Component* const parent, const double priority):
    STANDARD_CONSTRUCTOR()
 }
 
-void SimBgThread::start(
+void SimBgThread::setup(
          base::PairStream* const pl1,
          const double dt1,
          const unsigned int idx1,
@@ -31,7 +31,16 @@ void SimBgThread::start(
    dt0 = dt1;
    idx0 = idx1;
    n0 = n1;
+}
 
+void SimBgThread::start(
+         base::PairStream* const pl1,
+         const double dt1,
+         const unsigned int idx1,
+         const unsigned int n1
+      )
+{
+   setup(pl1, dt1, idx1, n1);
    signalStart();
 }
 
@@ -4,6 +4,7 @@
 #include "openeaagles/simulation/Simulation.hpp"
 
 #include "openeaagles/base/Component.hpp"
+#include "openeaagles/base/FrameProfiler.hpp"
 #include "openeaagles/base/PairStream.hpp"
 
 namespace oe {
@@ -20,7 +21,7 @@ SimTcThread::SimTcThread(base::Component* const parent, const double priority):
    STANDARD_CONSTRUCTOR()
 }
 
-void SimTcThread::start(
+void SimTcThread::setup(
          base::PairStream* const pl1,
          const double dt1,
          const unsigned int idx1,
@@ -31,7 +32,16 @@ void SimTcThread::start(
    dt0 = dt1;
    idx0 = idx1;
    n0 = n1;
+}
 
+void SimTcThread::start(
+         base::PairStream* const pl1,
+         const double dt1,
+         const unsigned int idx1,
+         const unsigned int n1
+      )
+{
+   setup(pl1, dt1, idx1, n1);
    signalStart();
 }
 
@@ -41,6 +51,7 @@ unsigned long SimTcThread::userFunc()
    if (pl0 != nullptr && idx0 > 0 && idx0 <= n0) {
       // then call the simulation executives update TC player list functions
       Simulation* sim = static_cast<Simulation*>(getParent());
+      base::FrameProfiler::setPhase(sim->phase());
       sim->updateTcPlayerList(pl0, dt0, idx0, n0);
    }
 
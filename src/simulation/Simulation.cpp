@@ -10,12 +10,15 @@
 #include "openeaagles/simulation/AbstractNib.hpp"
 #include "openeaagles/simulation/Station.hpp"
 
+#include "openeaagles/base/List.hpp"
 #include "openeaagles/base/PairStream.hpp"
 #include "openeaagles/base/Pair.hpp"
 #include "openeaagles/base/units/Times.hpp"
+#include "openeaagles/base/Rng.hpp"
 #include "openeaagles/base/Statistic.hpp"
 #include "openeaagles/base/util/system_utils.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 
@@ -34,7 +37,10 @@ BEGIN_SLOTTABLE(Simulation)
    "firstWeaponId",  // 6) First Released Weapon ID (default: 10001)
 
    "numTcThreads",   // 7) Number of T/C threads to use with the player list
-   "numBgThreads"    // 8) Number of background threads to use with the player list
+   "numBgThreads",   // 8) Number of background threads to use with the player list
+
+   "tcThreadCpus",   // 9) Processors for the T/C thread pool
+   "bgThreadCpus"    // 10) Processors for the background thread pool
 END_SLOTTABLE(Simulation)
 
 BEGIN_SLOT_MAP(Simulation)
@@ -49,6 +55,9 @@ BEGIN_SLOT_MAP(Simulation)
 
     ON_SLOT( 7, setSlotNumTcThreads,    base::Number)
     ON_SLOT( 8, setSlotNumBgThreads,    base::Number)
+
+    ON_SLOT( 9, setSlotTcThreadCpus,    base::List)
+    ON_SLOT(10, setSlotBgThreadCpus,    base::List)
 END_SLOT_MAP()
 
 Simulation::Simulation() : newPlayerQueue(MAX_NEW_PLAYERS)
@@ -139,6 +148,7 @@ void Simulation::copyData(const Simulation& org, const bool)
    numTcThreads = 0;
    tcThreadsFailed = false;
    reqTcThreads = org.reqTcThreads;
+   tcThreadCpus = org.tcThreadCpus;
 
    for (unsigned int i = 0; i < numBgThreads; i++) {
       bgThreads[i]->terminate();
@@ -148,6 +158,7 @@ void Simulation::copyData(const Simulation& org, const bool)
    numBgThreads = 0;
    bgThreadsFailed = false;
    reqBgThreads = org.reqBgThreads;
+   bgThreadCpus = org.bgThreadCpus;
 }
 
 void Simulation::deleteData()
@@ -242,6 +253,7 @@ void Simulation::reset()
    // Swap the lists
    // ---
    players = newList;
+   ++playerListVersion;
 
    // ---
    // Create the T/C thread pool
@@ -255,8 +267,12 @@ void Simulation::reset()
          pri = sta->getTimeCriticalPriority();
       }
 
+      const std::vector<unsigned int> cpus = numaOrder(tcThreadCpus);
       for (unsigned int i = 0; i < (reqTcThreads-1); i++) {
          tcThreads[numTcThreads] = new SimTcThread(this, pri);
+         if (!cpus.empty()) tcThreads[numTcThreads]->setCpuAffinity( { cpus[numTcThreads % cpus.size()] } );
+         tcThreads[numTcThreads]->setBarrier(&tcBarrier);
+         tcThreads[numTcThreads]->setRngSeed(base::Rng::getThreadSeed(), RNG_TC_INDEX + numTcThreads);
          bool ok = tcThreads[numTcThreads]->create();
          if (ok) {
             std::cout << "Created T/C pool thread[" << i << "] = " << tcThreads[i] << std::endl;
@@ -274,6 +290,7 @@ void Simulation::reset()
       // If we still don't have any threads then something failed
       // and we don't want to try again.
       tcThreadsFailed = (reqTcThreads > 1 && numTcThreads == 0);
+      tcBarrier.setNumWorkers(numTcThreads);
 
    }
 
@@ -289,8 +306,12 @@ void Simulation::reset()
          pri = sta->getBackgroundPriority();
       }
 
+      const std::vector<unsigned int> cpus = numaOrder(bgThreadCpus);
       for (unsigned int i = 0; i < (reqBgThreads-1); i++) {
          bgThreads[numBgThreads] = new SimBgThread(this, pri);
+         if (!cpus.empty()) bgThreads[numBgThreads]->setCpuAffinity( { cpus[numBgThreads % cpus.size()] } );
+         bgThreads[numBgThreads]->setBarrier(&bgBarrier);
+         bgThreads[numBgThreads]->setRngSeed(base::Rng::getThreadSeed(), RNG_BG_INDEX + numBgThreads);
          bool ok = bgThreads[numBgThreads]->create();
          if (ok) {
             std::cout << "Created background pool thread[" << i << "] = " << bgThreads[i] << std::endl;
@@ -308,6 +329,7 @@ void Simulation::reset()
       // If we still don't have any threads then something failed
       // and we don't want to try again.
       bgThreadsFailed = (reqBgThreads > 1 && numBgThreads == 0);
+      bgBarrier.setNumWorkers(numBgThreads);
 
    }
 
@@ -437,23 +459,39 @@ bool Simulation::shutdownNotification()
    // Shut down the thread pools
    // ---
    if (numTcThreads > 0) {
-      for (unsigned int i = 0; i < numTcThreads; i++) {
-         // We're just going to make sure the threads not suspended,
-         // and they'll check our shutdown flag.
-         tcThreads[i]->signalStart();
-      }
+      // We're just going to make sure the threads not suspended,
+      // and they'll check our shutdown flag.
+      tcBarrier.start();
    }
    if (numBgThreads > 0) {
-      for (unsigned int i = 0; i < numBgThreads; i++) {
-         // We're just going to make sure the threads not suspended,
-         // and they'll check our shutdown flag.
-         bgThreads[i]->signalStart();
-      }
+      // We're just going to make sure the threads not suspended,
+      // and they'll check our shutdown flag.
+      bgBarrier.start();
    }
 
    return true;
 }
 
+//------------------------------------------------------------------------------
+// numaOrder() -- orders a thread pool's processors by NUMA node; the node of
+// the first processor comes first, then the other nodes in ascending order.
+//------------------------------------------------------------------------------
+std::vector<unsigned int> Simulation::numaOrder(const std::vector<unsigned int>& cpus)
+{
+   std::vector<unsigned int> ordered(cpus);
+   if (!ordered.empty()) {
+      const unsigned int node0 = base::Thread::getCpuNode(ordered[0]);
+      std::stable_sort(ordered.begin(), ordered.end(),
+         [node0](const unsigned int a, const unsigned int b) {
+            const unsigned int na = base::Thread::getCpuNode(a);
+            const unsigned int nb = base::Thread::getCpuNode(b);
+            if (na == node0 || nb == node0) return (na == node0 && nb != node0);
+            return (na < nb);
+         });
+   }
+   return ordered;
+}
+
 //------------------------------------------------------------------------------
 // updateTC() -- update time critical stuff here
 //------------------------------------------------------------------------------
@@ -552,6 +590,10 @@ void Simulation::updateTC(const double dt)
 
          // Set the current phase
          setPhase(f);
+         base::FrameProfiler::setPhase(f);
+
+         // No player has been updated for this phase
+         tcPhaseStarting(currentPlayerList, f, (dt0/4.0));
 
          if (reqTcThreads == 1) {
             // Our single TC thread
@@ -563,15 +605,15 @@ void Simulation::updateTC(const double dt)
 
                // assign the threads from the pool
                unsigned int idx = (i+1);
-               tcThreads[i]->start(currentPlayerList, (dt0/4.0), idx, reqTcThreads);
+               tcThreads[i]->setup(currentPlayerList, (dt0/4.0), idx, reqTcThreads);
             }
+            tcBarrier.start();
 
             // we're the last thread
             updateTcPlayerList(currentPlayerList, (dt0/4.0), reqTcThreads, reqTcThreads);
 
             // Now wait for the other thread(s) to complete
-            base::SyncTask** pp = reinterpret_cast<base::SyncTask**>(&tcThreads[0]);
-            base::SyncTask::waitForAllCompleted(pp, numTcThreads);
+            tcBarrier.waitForCompleted();
 
          }
          else if (isMessageEnabled(MSG_ERROR)) {
@@ -580,6 +622,9 @@ void Simulation::updateTC(const double dt)
             std::cerr << "; numTcThreads = " << numTcThreads;
             std::cerr << std::endl;
          }
+
+         // All players are done with this phase
+         tcPhaseCompleted(currentPlayerList, f);
       }
    }
 
@@ -591,6 +636,7 @@ void Simulation::updateTC(const double dt)
    }
    setFrame(cframe);
    setPhase(0);
+   base::FrameProfiler::setPhase(0);
 }
 
 //------------------------------------------------------------------------------
@@ -620,6 +666,22 @@ void Simulation::updateTcPlayerList(
    }
 }
 
+//------------------------------------------------------------------------------
+// tcPhaseStarting() -- called from the main T/C thread before any player has
+//                      been updated for 'phase'; 'dt' is the phase's delta time
+//------------------------------------------------------------------------------
+void Simulation::tcPhaseStarting(base::PairStream* const, const unsigned int, const double)
+{
+}
+
+//------------------------------------------------------------------------------
+// tcPhaseCompleted() -- called from the main T/C thread after all players have
+//                       been updated for 'phase', and before the next phase
+//------------------------------------------------------------------------------
+void Simulation::tcPhaseCompleted(base::PairStream* const, const unsigned int)
+{
+}
+
 //------------------------------------------------------------------------------
 // updateData() -- update non-time critical stuff here
 //------------------------------------------------------------------------------
@@ -649,15 +711,15 @@ void Simulation::updateData(const double dt)
 
                // assign the threads from the pool
                unsigned int idx = (i+1);
-               bgThreads[i]->start(currentPlayerList, dt0, idx, reqBgThreads);
+               bgThreads[i]->setup(currentPlayerList, dt0, idx, reqBgThreads);
             }
+            bgBarrier.start();
 
             // we're the last thread
             updateBgPlayerList(currentPlayerList, dt0, reqBgThreads, reqBgThreads);
 
             // Now wait for the other thread(s) to complete
-            base::SyncTask** pp = reinterpret_cast<base::SyncTask**>(&bgThreads[0]);
-            base::SyncTask::waitForAllCompleted(pp, numBgThreads);
+            bgBarrier.waitForCompleted();
 
          }
          else if (isMessageEnabled(MSG_ERROR)) {
@@ -688,6 +750,7 @@ void Simulation::updateBgPlayerList(
          if (count == index) {
          base::Pair* pair = static_cast<base::Pair*>(item->getValue());
             AbstractPlayer* ip = static_cast<AbstractPlayer*>(pair->object());
+            base::FrameProfiler::Scope scope(ip);
             ip->updateData(dt);
             index += n;
          }
@@ -727,6 +790,240 @@ const base::PairStream* Simulation::getPlayers() const
    return players.getRefPtr();
 }
 
+unsigned int Simulation::getPlayerListVersion() const
+{
+   return playerListVersion.load();
+}
+
+//------------------------------------------------------------------------------
+// seedRngStreams() -- seeds the random number streams of our pool threads
+// (they're idle between frames)
+//------------------------------------------------------------------------------
+void Simulation::seedRngStreams(const unsigned int seed)
+{
+   for (unsigned int i = 0; i < numTcThreads; i++) {
+      tcThreads[i]->setRngSeed(seed, RNG_TC_INDEX + i);
+   }
+   for (unsigned int i = 0; i < numBgThreads; i++) {
+      bgThreads[i]->setRngSeed(seed, RNG_BG_INDEX + i);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Checkpoint and restore
+//------------------------------------------------------------------------------
+
+// Pre-ref()'d checkpoint of our state
+base::Checkpoint* Simulation::checkpoint() const
+{
+   const auto cp = new base::Checkpoint();
+   saveState(cp);
+   return cp;
+}
+
+// Restores a checkpoint
+bool Simulation::restore(const base::Checkpoint* const cp)
+{
+   bool ok = false;
+   if (cp != nullptr) {
+      base::Checkpoint::Reader rd(cp);
+      ok = restoreState(&rd) && rd.isOk() && rd.isEnd();
+   }
+   return ok;
+}
+
+// Saves what's needed to recreate player 'ip', if it's not in the simulation
+// that the checkpoint is restored into; default: nothing
+void Simulation::saveOrigin(const AbstractPlayer* const, base::Checkpoint* const) const
+{
+}
+
+// Recreates a player from its origin (see saveOrigin()); default: can't
+AbstractPlayer* Simulation::recreatePlayer(base::Checkpoint::Reader* const)
+{
+   return nullptr;
+}
+
+void Simulation::saveState(base::Checkpoint* const cp) const
+{
+   cp->beginSection();
+   cp->put(cycleCnt);
+   cp->put(frameCnt);
+   cp->put(phaseCnt);
+   cp->put(execTime);
+   cp->put(pcTime);
+   cp->put(pcTvSec);
+   cp->put(pcTvUSec);
+   cp->put(simTime);
+   cp->put(simTvSec);
+   cp->put(simTvUSec);
+   cp->put(eventID);
+   cp->put(eventWpnID);
+   cp->put(relWpnId);
+
+   // Random number streams: ours and our pool threads'
+   base::Rng::saveState(cp);
+   cp->put(numTcThreads);
+   for (unsigned int i = 0; i < numTcThreads; i++) {
+      base::Rng::saveState(cp, tcThreads[i]->getRngStream());
+   }
+   cp->put(numBgThreads);
+   for (unsigned int i = 0; i < numBgThreads; i++) {
+      base::Rng::saveState(cp, bgThreads[i]->getRngStream());
+   }
+
+   // Our local players; each in its own section, by name
+   const base::PairStream* playerList = players.getRefPtr();
+   std::vector<const AbstractPlayer*> list;
+   if (playerList != nullptr) {
+      const base::List::Item* item = playerList->getFirstItem();
+      while (item != nullptr) {
+         const auto pair = static_cast<const base::Pair*>(item->getValue());
+         const auto ip = static_cast<const AbstractPlayer*>(pair->object());
+         if (ip->isLocalPlayer()) list.push_back(ip);
+         item = item->getNext();
+      }
+   }
+   cp->put(static_cast<unsigned int>(list.size()));
+   for (const AbstractPlayer* ip : list) {
+      cp->beginSection();
+      cp->putString(*ip->getName());
+      cp->beginSection();
+      saveOrigin(ip, cp);
+      cp->endSection();
+      ip->saveState(cp);
+      cp->endSection();
+   }
+   cp->endSection();
+   if (playerList != nullptr) playerList->unref();
+
+   BaseClass::saveState(cp);
+}
+
+bool Simulation::restoreState(base::Checkpoint::Reader* const rd)
+{
+   bool ok = rd->beginSection();
+   ok = ok && rd->get(&cycleCnt) && rd->get(&frameCnt) && rd->get(&phaseCnt);
+   ok = ok && rd->get(&execTime) && rd->get(&pcTime) && rd->get(&pcTvSec) && rd->get(&pcTvUSec);
+   ok = ok && rd->get(&simTime) && rd->get(&simTvSec) && rd->get(&simTvUSec);
+   ok = ok && rd->get(&eventID) && rd->get(&eventWpnID) && rd->get(&relWpnId);
+   ok = ok && base::Rng::restoreState(rd);
+
+   // Our pool threads' streams; the pools must match the checkpoint's
+   unsigned int nTc {};
+   ok = ok && rd->get(&nTc) && nTc == numTcThreads;
+   for (unsigned int i = 0; ok && i < numTcThreads; i++) {
+      ok = base::Rng::restoreState(rd, tcThreads[i]->getRngStream());
+   }
+   unsigned int nBg {};
+   ok = ok && rd->get(&nBg) && nBg == numBgThreads;
+   for (unsigned int i = 0; ok && i < numBgThreads; i++) {
+      ok = base::Rng::restoreState(rd, bgThreads[i]->getRngStream());
+   }
+
+   unsigned int n {};
+   ok = ok && rd->get(&n);
+
+   // Our local players
+   const auto getLocalPlayers = [this]() {
+      std::vector<AbstractPlayer*> list;
+      base::safe_ptr<base::PairStream> playerList = players;
+      if (playerList != nullptr) {
+         base::List::Item* item = playerList->getFirstItem();
+         while (item != nullptr) {
+            const auto pair = static_cast<base::Pair*>(item->getValue());
+            const auto ip = static_cast<AbstractPlayer*>(pair->object());
+            if (ip->isLocalPlayer()) list.push_back(ip);
+            item = item->getNext();
+         }
+      }
+      return list;
+   };
+   std::vector<AbstractPlayer*> notRestored = getLocalPlayers();
+   const auto findLocal = [&notRestored](const std::string& name) {
+      return std::find_if(notRestored.begin(), notRestored.end(),
+         [&name](const AbstractPlayer* ip) { return ip->isName(name.c_str()); } );
+   };
+
+   // First pass: recreate the checkpoint's players that we don't have
+   // (e.g., weapons released before the checkpoint) from their origins
+   std::string name;
+   if (ok) {
+      base::Checkpoint::Reader rd1(*rd);
+      unsigned int added {};
+      for (unsigned int i = 0; i < n && ok; i++) {
+         ok = rd1.beginSection() && rd1.getString(&name) && rd1.beginSection();
+         if (ok && findLocal(name) == notRestored.end()) {
+            AbstractPlayer* const ip = recreatePlayer(&rd1);
+            ok = rd1.endSection() && (ip != nullptr);
+            if (ip != nullptr) {
+               if (ok) ok = addNewPlayer(name.c_str(), ip);
+               if (ok) added++;
+               ip->unref();
+            }
+            if (!ok && isMessageEnabled(MSG_ERROR)) {
+               std::cerr << "Simulation::restoreState(): ERROR, unable to recreate checkpoint player: " << name << std::endl;
+            }
+         }
+         else {
+            ok = ok && rd1.skipSection();
+         }
+         ok = ok && rd1.skipSection();
+      }
+      if (ok && added > 0) {
+         updatePlayerList();
+         notRestored = getLocalPlayers();
+      }
+   }
+
+   // Second pass: restore our players by name; local players that are
+   // not in the checkpoint (i.e., removed before the checkpoint) are removed
+   for (unsigned int i = 0; i < n && ok; i++) {
+      ok = rd->beginSection() && rd->getString(&name) && rd->beginSection() && rd->skipSection();
+      if (ok) {
+         const auto found = findLocal(name);
+         if (found != notRestored.end()) {
+            ok = (*found)->restoreState(rd);
+            notRestored.erase(found);
+         }
+         else {
+            ok = false;
+         }
+         if (!ok && isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "Simulation::restoreState(): ERROR, checkpoint player doesn't match: " << name << std::endl;
+         }
+      }
+      ok = rd->endSection() && ok;
+   }
+
+   if (ok) {
+      for (AbstractPlayer* ip : notRestored) {
+         ip->setMode(AbstractPlayer::DELETE_REQUEST);
+      }
+   }
+   ok = rd->endSection() && ok;
+
+   ok = ok && BaseClass::restoreState(rd);
+
+   if (!ok && isMessageEnabled(MSG_ERROR)) {
+      std::cerr << "Simulation::restoreState(): ERROR, invalid checkpoint" << std::endl;
+   }
+   return ok;
+}
+
+// Finds the name of a player or a component
+const base::Identifier* Simulation::findNameOfComponent(const base::Component* const p) const
+{
+   const base::Identifier* name {};
+   const base::PairStream* pl = players.getRefPtr();
+   if (pl != nullptr) {
+      name = pl->findName(p);
+      pl->unref();
+   }
+   if (name == nullptr) name = BaseClass::findNameOfComponent(p);
+   return name;
+}
+
 // Real-time cycle counter
 unsigned int Simulation::cycle() const
 {
@@ -947,6 +1244,7 @@ bool Simulation::setSlotPlayers(base::PairStream* const pl)
 
       // Set the active player list pointer
       players = newList;
+      ++playerListVersion;
       newList->unref();
    }
 
@@ -957,6 +1255,10 @@ bool Simulation::setSlotPlayers(base::PairStream* const pl)
 // updatePlayerList() -- update the player list ...
 //                       1) remove 'deleteRequest' mode players
 //                       2) add new players
+//
+// The new players are sorted and then merged with the current players, so the
+// new list is built with one pass through the current list, no matter how many
+// players are added or removed.
 //------------------------------------------------------------------------------
 void Simulation::updatePlayerList()
 {
@@ -984,6 +1286,32 @@ void Simulation::updatePlayerList()
 
         // Update Required!
 
+        // ---
+        // Get the new players, and sort them (stable, so equal players stay
+        // in the order that they were added)
+        // ---
+        std::vector<base::Pair*> newPlayers;
+        base::Pair* newPlayer = newPlayerQueue.get();
+        while (newPlayer != nullptr) {
+            // get the player
+            const auto ip = static_cast<AbstractPlayer*>(newPlayer->object());
+
+            BEGIN_RECORD_DATA_SAMPLE( getDataRecorder(), REID_NEW_PLAYER )
+               SAMPLE_1_OBJECT( ip )
+            END_RECORD_DATA_SAMPLE()
+
+            // Set container and name
+            ip->container(this);
+            ip->setName(*newPlayer->slot());
+
+            newPlayers.push_back(newPlayer);
+            newPlayer = newPlayerQueue.get();
+        }
+        std::stable_sort(newPlayers.begin(), newPlayers.end(),
+           [](const base::Pair* const p1, const base::Pair* const p2) {
+              return isPlayerBefore(static_cast<const AbstractPlayer*>(p1->object()), static_cast<const AbstractPlayer*>(p2->object()));
+           });
+
         // ---
         // Something old and something new ...
         // ---
@@ -991,8 +1319,10 @@ void Simulation::updatePlayerList()
         newList->unref();  // 'newList' has it, so unref() from the 'new'
 
         // ---
-        // Copy players to the new list; except 'deleteRequest' mode players
+        // Merge the current players, except 'deleteRequest' mode players,
+        // and the new players into the new list
         // ---
+        auto np = newPlayers.begin();
         base::safe_ptr<base::PairStream> oldList = players;
         base::List::Item* item = oldList->getFirstItem();
         while (item != nullptr) {
@@ -1000,7 +1330,12 @@ void Simulation::updatePlayerList()
             item = item->getNext();
             const auto p = static_cast<AbstractPlayer*>(pair->object());
             if (p->isNotMode(AbstractPlayer::DELETE_REQUEST)) {
-                // Add the player to the new list
+                // Add any new players that go before this player,
+                // and then add this player to the new list
+                while (np != newPlayers.end() && isPlayerBefore(static_cast<AbstractPlayer*>((*np)->object()), p)) {
+                    newList->put(*np);
+                    ++np;
+                }
                 newList->put(pair);
             }
             else {
@@ -1014,34 +1349,22 @@ void Simulation::updatePlayerList()
             }
         }
 
-        // ---
-        // Add any new players
-        // ---
-      base::Pair* newPlayer = newPlayerQueue.get();
-      while (newPlayer != nullptr) {
-            // get the player
-            const auto ip = static_cast<AbstractPlayer*>(newPlayer->object());
-
-            BEGIN_RECORD_DATA_SAMPLE( getDataRecorder(), REID_NEW_PLAYER )
-               SAMPLE_1_OBJECT( ip )
-            END_RECORD_DATA_SAMPLE()
-
-            // Set container and name
-            ip->container(this);
-            ip->setName(*newPlayer->slot());
-
-            // Insert the new player into the new list in sorted order
-            insertPlayerSort(newPlayer, newList);
-
-            newPlayer->unref();
+        // The rest of the new players go at the end
+        while (np != newPlayers.end()) {
+            newList->put(*np);
+            ++np;
+        }
 
-         newPlayer = newPlayerQueue.get();
+        // The new list has them now (our queue's ref())
+        for (base::Pair* pair : newPlayers) {
+            pair->unref();
         }
 
         // ---
         // Swap the lists
         // ---
         players = newList;
+        ++playerListVersion;
     }
 }
 
@@ -1056,9 +1379,15 @@ bool Simulation::addNewPlayer(base::Pair* const player)
     if (player == nullptr) return false;
     player->ref();
 
-    newPlayerQueue.put(player);
+    const bool ok = newPlayerQueue.put(player);
+    if (!ok) {
+        player->unref();
+        if (isMessageEnabled(MSG_ERROR)) {
+           std::cerr << "Simulation::addNewPlayer(): ERROR, new player queue is full; player not added" << std::endl;
+        }
+    }
 
-    return true;
+    return ok;
 }
 
 //------------------------------------------------------------------------------
@@ -1100,34 +1429,7 @@ bool Simulation::insertPlayerSort(base::Pair* const newPlayerPair, base::PairStr
         base::Pair* refPair = static_cast<base::Pair*>(refItem->getValue());
         const auto refPlayer = static_cast<AbstractPlayer*>(refPair->object());
 
-        bool insert = false;
-        if (newPlayer->isNetworkedPlayer()) {
-
-            // *** Insert IPlayer -- after local players and lower NIB IDs first
-            if (refPlayer->isNetworkedPlayer()) {
-
-               // Get the NIBs
-               const AbstractNib* nNib = newPlayer->getNib();
-               const AbstractNib* rNib = refPlayer->getNib();
-
-               // Compare federate names
-               int result = std::strcmp(*nNib->getFederateName(), *rNib->getFederateName());
-               if (result == 0) {
-                  // Same federate name; compare player IDs
-                  if (nNib->getPlayerID() > rNib->getPlayerID()) result = +1;
-                  else if (nNib->getPlayerID() < rNib->getPlayerID()) result = -1;
-               }
-
-               // Insert if the new NIB's IDs are less than the ref NIB's IDs
-               insert = (result < 0);
-            }
-        }
-        else {
-
-            // *** Insert a local player -- by player ID and before any IPlayer
-            insert = ( (newPlayer->getID() < refPlayer->getID()) || refPlayer->isNetworkedPlayer() );
-
-        }
+        const bool insert = isPlayerBefore(newPlayer, refPlayer);
 
         if (insert) {
             newList->insert(newItem, refItem);
@@ -1146,6 +1448,43 @@ bool Simulation::insertPlayerSort(base::Pair* const newPlayerPair, base::PairStr
     return true;
 }
 
+//------------------------------------------------------------------------------
+// isPlayerBefore() -- True if player 'p1' goes before player 'p2' on the
+//                     player list: local players first, by player ID, and
+//                     then networked players, by federate name and player ID
+//------------------------------------------------------------------------------
+bool Simulation::isPlayerBefore(const AbstractPlayer* const p1, const AbstractPlayer* const p2)
+{
+    bool before = false;
+    if (p1->isNetworkedPlayer()) {
+
+        // *** IPlayer -- after local players and lower NIB IDs first
+        if (p2->isNetworkedPlayer()) {
+
+           // Get the NIBs
+           const AbstractNib* nNib = p1->getNib();
+           const AbstractNib* rNib = p2->getNib();
+
+           // Compare federate names
+           int result = std::strcmp(*nNib->getFederateName(), *rNib->getFederateName());
+           if (result == 0) {
+              // Same federate name; compare player IDs
+              if (nNib->getPlayerID() > rNib->getPlayerID()) result = +1;
+              else if (nNib->getPlayerID() < rNib->getPlayerID()) result = -1;
+           }
+
+           before = (result < 0);
+        }
+    }
+    else {
+
+        // *** Local player -- by player ID and before any IPlayer
+        before = ( (p1->getID() < p2->getID()) || p2->isNetworkedPlayer() );
+
+    }
+    return before;
+}
+
 
 //------------------------------------------------------------------------------
 // findPlayer() -- Find a player that matches 'id' and 'networkID'
@@ -1407,6 +1746,60 @@ bool Simulation::setSlotNumBgThreads(const base::Number* const msg)
    return ok;
 }
 
+//------------------------------------------------------------------------------
+// getCpuList() -- Gets a list of processor numbers from a slot's list; the
+// processors that aren't online are dropped, and counted in 'dropped'
+//------------------------------------------------------------------------------
+static bool getCpuList(const base::List* const msg, std::vector<unsigned int>* const cpus, unsigned int* const dropped)
+{
+   static const unsigned int MAX_CPUS = 1024;
+   int values[MAX_CPUS];
+   const unsigned int n = msg->getNumberList(values, MAX_CPUS);
+   const unsigned int numCpus = base::Thread::getNumOnlineCpus();
+   cpus->clear();
+   *dropped = 0;
+   for (unsigned int i = 0; i < n; i++) {
+      if (values[i] < 0) return false;
+      if (static_cast<unsigned int>(values[i]) < numCpus) cpus->push_back(static_cast<unsigned int>(values[i]));
+      else (*dropped)++;
+   }
+   return true;
+}
+
+bool Simulation::setSlotTcThreadCpus(const base::List* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      unsigned int dropped = 0;
+      ok = getCpuList(msg, &tcThreadCpus, &dropped);
+      if (!ok) {
+         tcThreadCpus.clear();
+         std::cerr << "simulation::setSlotTcThreadCpus(): invalid processor number(s)" << std::endl;
+      }
+      else if (dropped > 0 && isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "simulation::setSlotTcThreadCpus(): WARNING, ignored " << dropped << " processor number(s) that aren't online" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool Simulation::setSlotBgThreadCpus(const base::List* const msg)
+{
+   bool ok = false;
+   if (msg != nullptr) {
+      unsigned int dropped = 0;
+      ok = getCpuList(msg, &bgThreadCpus, &dropped);
+      if (!ok) {
+         bgThreadCpus.clear();
+         std::cerr << "simulation::setSlotBgThreadCpus(): invalid processor number(s)" << std::endl;
+      }
+      else if (dropped > 0 && isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "simulation::setSlotBgThreadCpus(): WARNING, ignored " << dropped << " processor number(s) that aren't online" << std::endl;
+      }
+   }
+   return ok;
+}
+
 std::ostream& Simulation::serialize(std::ostream& sout, const int i, const bool slotsOnly) const
 {
     int j = 0;
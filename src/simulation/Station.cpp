@@ -9,10 +9,13 @@
 #include "openeaagles/simulation/Simulation.hpp"
 
 #include "openeaagles/base/Color.hpp"
+#include "openeaagles/base/Identifier.hpp"
+#include "openeaagles/base/List.hpp"
 #include "openeaagles/base/io/IoHandler.hpp"
 #include "openeaagles/base/Number.hpp"
 #include "openeaagles/base/Pair.hpp"
 #include "openeaagles/base/PairStream.hpp"
+#include "openeaagles/base/Rng.hpp"
 #include "openeaagles/base/Timers.hpp"
 #include "openeaagles/base/units/Times.hpp"
 
@@ -50,6 +53,11 @@ BEGIN_SLOTTABLE(Station)
    "startupResetTimer", // 16: Startup (initial) RESET event timer value (base::Time) (default: no reset event)
    "enableUpdateTimers",// 17: Enable calling base::Timers::updateTimers() from updateTC() (default: false)
    "dataRecorder",      // 18) Our Data Recorder
+   "tcOverrunPolicy",   // 19: Time-critical thread frame overrun policy (catchUp, skip or stretch)
+   "tcSpinTime",        // 20: Time-critical thread spin time before each frame's deadline (base::Time)
+   "tcCpus",            // 21: Time-critical thread processor set (base::List)
+   "netCpus",           // 22: Network thread processor set (base::List)
+   "bgCpus",            // 23: Background thread processor set (base::List)
 END_SLOTTABLE(Station)
 
 BEGIN_SLOT_MAP(Station)
@@ -82,6 +90,13 @@ BEGIN_SLOT_MAP(Station)
    ON_SLOT(17,  setSlotEnableUpdateTimers,    base::Number)
 
    ON_SLOT(18, setDataRecorder,               AbstractDataRecorder)
+
+   ON_SLOT(19, setSlotTimeCriticalOverrunPolicy, base::Identifier)
+   ON_SLOT(20, setSlotTimeCriticalSpinTime,      base::Time)
+
+   ON_SLOT(21, setSlotTimeCriticalCpus,          base::List)
+   ON_SLOT(22, setSlotNetworkCpus,               base::List)
+   ON_SLOT(23, setSlotBackgroundCpus,            base::List)
 END_SLOT_MAP()
 
 Station::Station()
@@ -148,15 +163,20 @@ void Station::copyData(const Station& org, const bool)
    tcRate = org.tcRate;
    tcPri = org.tcPri;
    tcStackSize = org.tcStackSize;
+   tcOverrunPolicy = org.tcOverrunPolicy;
+   tcSpinTime = org.tcSpinTime;
+   tcCpus = org.tcCpus;
    fastForwardRate = org.fastForwardRate;
 
    netRate = org.netRate;
    netPri = org.netPri;
    netStackSize = org.netStackSize;
+   netCpus = org.netCpus;
 
    bgRate = org.bgRate;
    bgPri = org.bgPri;
    bgStackSize = org.bgStackSize;
+   bgCpus = org.bgCpus;
 
    tmrUpdateEnbl = org.tmrUpdateEnbl;
 
@@ -484,10 +504,15 @@ void Station::outputDevices(const double dt)
 void Station::createTimeCriticalProcess()
 {
    if ( tcThread == nullptr ) {
-      tcThread = new TcThread(this, getTimeCriticalPriority(), getTimeCriticalRate());
+      const auto thread = new TcThread(this, getTimeCriticalPriority(), getTimeCriticalRate());
+      thread->setOverrunPolicy(tcOverrunPolicy);
+      thread->setSpinTime(tcSpinTime);
+      tcThread = thread;
       tcThread->unref(); // 'tcThread' is a safe_ptr<>
 
       if (tcStackSize > 0) tcThread->setStackSize( tcStackSize );
+      tcThread->setCpuAffinity( tcCpus );
+      tcThread->setRngSeed( base::Rng::getThreadSeed(), RNG_TC_INDEX );
 
       bool ok = tcThread->create();
       if (!ok) {
@@ -509,6 +534,8 @@ void Station::createNetworkProcess()
       netThread->unref(); // 'netThread' is a safe_ptr<>
 
       if (netStackSize > 0) netThread->setStackSize( netStackSize );
+      netThread->setCpuAffinity( netCpus );
+      netThread->setRngSeed( base::Rng::getThreadSeed(), RNG_NET_INDEX );
 
       bool ok = netThread->create();
       if (!ok) {
@@ -530,6 +557,8 @@ void Station::createBackgroundProcess()
       bgThread->unref(); // 'bgThread' is a safe_ptr<>
 
       if (bgStackSize > 0) bgThread->setStackSize( bgStackSize );
+      bgThread->setCpuAffinity( bgCpus );
+      bgThread->setRngSeed( base::Rng::getThreadSeed(), RNG_BG_INDEX );
 
       bool ok = bgThread->create();
       if (!ok) {
@@ -559,19 +588,25 @@ void Station::processBackgroundTasks(const double dt)
    // Note: interoperability networks are handled by
    // processNetworkInputTasks() and processNetworkOutputTasks()
 
+   base::FrameProfiler::Scope scope(this);
+
    // The I/O handlers
    if (ioHandlers != nullptr) {
       base::List::Item* item = ioHandlers ->getFirstItem();
       while (item != nullptr) {
          base::Pair* pair = static_cast<base::Pair*>(item->getValue());
          base::IoHandler* p = static_cast<base::IoHandler*>(pair->object());
+         base::FrameProfiler::Scope ioScope(p);
          p->updateData(dt);
          item = item->getNext();
       }
    }
 
    // Our simulation model
-   if (sim != nullptr) sim->updateData(dt);
+   if (sim != nullptr) {
+      base::FrameProfiler::Scope simScope(sim);
+      sim->updateData(dt);
+   }
 
    // Our OTW interfaces
    if (otw != nullptr) {
@@ -579,6 +614,7 @@ void Station::processBackgroundTasks(const double dt)
       while (item != nullptr) {
          const auto pair = static_cast<base::Pair*>(item->getValue());
          const auto p = static_cast<AbstractOtw*>(pair->object());
+         base::FrameProfiler::Scope otwScope(p);
          p->updateData(dt);
          item = item->getNext();
       }
@@ -742,6 +778,45 @@ bool Station::doWeHaveTheTcThread() const
    return (tcThread != nullptr);
 }
 
+// Time-critical thread frame overrun policy
+base::PeriodicTask::OverrunPolicy Station::getTimeCriticalOverrunPolicy() const
+{
+   return tcOverrunPolicy;
+}
+
+// Time-critical thread spin time (sec)
+double Station::getTimeCriticalSpinTime() const
+{
+   return tcSpinTime;
+}
+
+// Frame statistics of a periodic task thread
+static bool getThreadFrameStats(const base::Thread* const thread, base::PeriodicTask::FrameStats* const stats)
+{
+   const auto task = dynamic_cast<const base::PeriodicTask*>(thread);
+   if (task == nullptr || stats == nullptr) return false;
+   task->getFrameStats(stats);
+   return true;
+}
+
+// Time-critical thread frame statistics
+bool Station::getTimeCriticalFrameStats(base::PeriodicTask::FrameStats* const stats) const
+{
+   return getThreadFrameStats(tcThread, stats);
+}
+
+// Network thread frame statistics
+bool Station::getNetworkFrameStats(base::PeriodicTask::FrameStats* const stats) const
+{
+   return getThreadFrameStats(netThread, stats);
+}
+
+// Background thread frame statistics
+bool Station::getBackgroundFrameStats(base::PeriodicTask::FrameStats* const stats) const
+{
+   return getThreadFrameStats(bgThread, stats);
+}
+
 // Pre-ref() pointer to the T/Cthread
 base::Thread* Station::getTcThread()
 {
@@ -844,6 +919,22 @@ bool Station::setTimeCriticalStackSize(const unsigned int bytes)
    return true;
 }
 
+bool Station::setTimeCriticalOverrunPolicy(const base::PeriodicTask::OverrunPolicy policy)
+{
+   tcOverrunPolicy = policy;
+   return true;
+}
+
+bool Station::setTimeCriticalSpinTime(const double seconds)
+{
+   bool ok = false;
+   if (seconds >= 0) {
+      tcSpinTime = seconds;
+      ok = true;
+   }
+   return ok;
+}
+
 bool Station::setNetworkStackSize(const unsigned int bytes)
 {
    netStackSize = bytes;
@@ -856,6 +947,42 @@ bool Station::setBackgroundStackSize(const unsigned int bytes)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// Thread processor sets (empty for any processor)
+//------------------------------------------------------------------------------
+const std::vector<unsigned int>& Station::getTimeCriticalCpus() const
+{
+   return tcCpus;
+}
+
+bool Station::setTimeCriticalCpus(const std::vector<unsigned int>& cpus)
+{
+   tcCpus = cpus;
+   return true;
+}
+
+const std::vector<unsigned int>& Station::getNetworkCpus() const
+{
+   return netCpus;
+}
+
+bool Station::setNetworkCpus(const std::vector<unsigned int>& cpus)
+{
+   netCpus = cpus;
+   return true;
+}
+
+const std::vector<unsigned int>& Station::getBackgroundCpus() const
+{
+   return bgCpus;
+}
+
+bool Station::setBackgroundCpus(const std::vector<unsigned int>& cpus)
+{
+   bgCpus = cpus;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Set thread handle functions
 //------------------------------------------------------------------------------
@@ -1201,6 +1328,80 @@ bool Station::setSlotTimeCriticalStackSize(const base::Number* const num)
 }
 
 
+//------------------------------------------------------------------------------
+// setSlotTimeCriticalOverrunPolicy() -- Sets the T/C thread's frame overrun policy
+//------------------------------------------------------------------------------
+bool Station::setSlotTimeCriticalOverrunPolicy(const base::Identifier* const msg)
+{
+    bool ok = false;
+    if (msg != nullptr) {
+        ok = true;  // assume that it's valid
+        if      (*msg == "catchUp") setTimeCriticalOverrunPolicy(base::PeriodicTask::OVERRUN_CATCH_UP);
+        else if (*msg == "skip")    setTimeCriticalOverrunPolicy(base::PeriodicTask::OVERRUN_SKIP);
+        else if (*msg == "stretch") setTimeCriticalOverrunPolicy(base::PeriodicTask::OVERRUN_STRETCH);
+        else {
+            if (isMessageEnabled(MSG_ERROR)) {
+               std::cerr << "Station::setSlotTimeCriticalOverrunPolicy(): invalid policy: " << *msg << std::endl;
+               std::cerr << " -- valid policies are { catchUp, skip, stretch }" << std::endl;
+            }
+            ok = false; // it's no longer ok
+        }
+    }
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// setSlotTimeCriticalSpinTime() -- Sets the T/C thread's spin time
+//------------------------------------------------------------------------------
+bool Station::setSlotTimeCriticalSpinTime(const base::Time* const msg)
+{
+    bool ok = false;
+    if (msg != nullptr) {
+        ok = setTimeCriticalSpinTime( base::Seconds::convertStatic(*msg) );
+    }
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// getCpuList() -- Gets a list of processor numbers from a slot's list; the
+// processors that aren't online are dropped, and counted in 'dropped'
+//------------------------------------------------------------------------------
+static bool getCpuList(const base::List* const msg, std::vector<unsigned int>* const cpus, unsigned int* const dropped)
+{
+    static const unsigned int MAX_CPUS = 1024;
+    int values[MAX_CPUS];
+    const unsigned int n = msg->getNumberList(values, MAX_CPUS);
+    const unsigned int numCpus = base::Thread::getNumOnlineCpus();
+    cpus->clear();
+    *dropped = 0;
+    for (unsigned int i = 0; i < n; i++) {
+        if (values[i] < 0) return false;
+        if (static_cast<unsigned int>(values[i]) < numCpus) cpus->push_back(static_cast<unsigned int>(values[i]));
+        else (*dropped)++;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// setSlotTimeCriticalCpus() -- Sets the T/C thread's processor set
+//------------------------------------------------------------------------------
+bool Station::setSlotTimeCriticalCpus(const base::List* const msg)
+{
+    bool ok = false;
+    std::vector<unsigned int> cpus;
+    unsigned int dropped = 0;
+    if (msg != nullptr && getCpuList(msg, &cpus, &dropped)) {
+        ok = setTimeCriticalCpus(cpus);
+        if (dropped > 0 && isMessageEnabled(MSG_WARNING)) {
+            std::cerr << "Station::setSlotTimeCriticalCpus(): WARNING, ignored " << dropped << " processor number(s) that aren't online" << std::endl;
+        }
+    }
+    else if (msg != nullptr && isMessageEnabled(MSG_ERROR)) {
+        std::cerr << "Station::setSlotTimeCriticalCpus(): invalid processor number(s)" << std::endl;
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // setSlotNetworkRate() -- Sets the network thread rate (hz)
 //------------------------------------------------------------------------------
@@ -1305,6 +1506,46 @@ bool Station::setSlotBackgroundStackSize(const base::Number* const num)
 }
 
 
+//------------------------------------------------------------------------------
+// setSlotNetworkCpus() -- Sets the network thread's processor set
+//------------------------------------------------------------------------------
+bool Station::setSlotNetworkCpus(const base::List* const msg)
+{
+    bool ok = false;
+    std::vector<unsigned int> cpus;
+    unsigned int dropped = 0;
+    if (msg != nullptr && getCpuList(msg, &cpus, &dropped)) {
+        ok = setNetworkCpus(cpus);
+        if (dropped > 0 && isMessageEnabled(MSG_WARNING)) {
+            std::cerr << "Station::setSlotNetworkCpus(): WARNING, ignored " << dropped << " processor number(s) that aren't online" << std::endl;
+        }
+    }
+    else if (msg != nullptr && isMessageEnabled(MSG_ERROR)) {
+        std::cerr << "Station::setSlotNetworkCpus(): invalid processor number(s)" << std::endl;
+    }
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// setSlotBackgroundCpus() -- Sets the background thread's processor set
+//------------------------------------------------------------------------------
+bool Station::setSlotBackgroundCpus(const base::List* const msg)
+{
+    bool ok = false;
+    std::vector<unsigned int> cpus;
+    unsigned int dropped = 0;
+    if (msg != nullptr && getCpuList(msg, &cpus, &dropped)) {
+        ok = setBackgroundCpus(cpus);
+        if (dropped > 0 && isMessageEnabled(MSG_WARNING)) {
+            std::cerr << "Station::setSlotBackgroundCpus(): WARNING, ignored " << dropped << " processor number(s) that aren't online" << std::endl;
+        }
+    }
+    else if (msg != nullptr && isMessageEnabled(MSG_ERROR)) {
+        std::cerr << "Station::setSlotBackgroundCpus(): invalid processor number(s)" << std::endl;
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // setSlotStartupResetTime() -- Sets the startup RESET pulse timer
 //------------------------------------------------------------------------------
@@ -1412,6 +1653,30 @@ std::ostream& Station::serialize(std::ostream& sout, const int i, const bool slo
     indent(sout,i+j);
     sout << "tcPriority: " << tcPri << std::endl;
 
+    // tcOverrunPolicy: Time-critical thread frame overrun policy
+    if (tcOverrunPolicy != base::PeriodicTask::OVERRUN_CATCH_UP) {
+        indent(sout,i+j);
+        sout << "tcOverrunPolicy: " << (tcOverrunPolicy == base::PeriodicTask::OVERRUN_SKIP ? "skip" : "stretch") << std::endl;
+    }
+
+    // tcSpinTime: Time-critical thread spin time
+    if (tcSpinTime > 0) {
+        indent(sout,i+j);
+        sout << "tcSpinTime: ( Seconds " << tcSpinTime << " )" << std::endl;
+    }
+
+    // tcCpus, netCpus and bgCpus: Thread processor sets
+    const std::vector<unsigned int>* const cpuSets[3] = { &tcCpus, &netCpus, &bgCpus };
+    const char* const cpuSlots[3] = { "tcCpus", "netCpus", "bgCpus" };
+    for (unsigned int k = 0; k < 3; k++) {
+        if (!cpuSets[k]->empty()) {
+            indent(sout,i+j);
+            sout << cpuSlots[k] << ": [";
+            for (const unsigned int cpu : *cpuSets[k]) sout << " " << cpu;
+            sout << " ]" << std::endl;
+        }
+    }
+
     // netRate: Network thread rate (Hz)
     indent(sout,i+j);
     sout << "netRate: " << netRate << std::endl;
@@ -2,7 +2,9 @@
 #include "openeaagles/simulation/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
+#include "openeaagles/simulation/BatchRunner.hpp"
 #include "openeaagles/simulation/Simulation.hpp"
 #include "openeaagles/simulation/Station.hpp"
 
@@ -13,16 +15,12 @@ namespace simulation {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    if ( name == Simulation::getFactoryName() ) {
-        obj = new Simulation();
-    }
-    else if ( name == Station::getFactoryName() ) {
-        obj = new Station();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        { BatchRunner::getFactoryName(), base::FactoryTable::make<BatchRunner> },
+        { Simulation::getFactoryName(),  base::FactoryTable::make<Simulation> },
+        { Station::getFactoryName(),     base::FactoryTable::make<Station> },
+    };
+    return table.create(name);
 }
 
 }
@@ -2,6 +2,7 @@
 #include "openeaagles/terrain/factory.hpp"
 
 #include "openeaagles/base/Object.hpp"
+#include "openeaagles/base/FactoryTable.hpp"
 
 #include "openeaagles/terrain/QuadMap.hpp"
 #include "openeaagles/terrain/ded/DedFile.hpp"
@@ -15,22 +16,13 @@ namespace terrain {
 
 base::Object* factory(const std::string& name)
 {
-    base::Object* obj = nullptr;
-
-    if ( name == QuadMap::getFactoryName() ) {
-        obj = new QuadMap();
-    }
-    else if ( name == DedFile::getFactoryName() ) {
-        obj = new DedFile();
-    }
-    else if ( name == DtedFile::getFactoryName() ) {
-        obj = new DtedFile();
-    }
-    else if ( name == SrtmHgtFile::getFactoryName() ) {
-        obj = new SrtmHgtFile();
-    }
-
-    return obj;
+    static const base::FactoryTable table {
+        { QuadMap::getFactoryName(),      base::FactoryTable::make<QuadMap> },
+        { DedFile::getFactoryName(),      base::FactoryTable::make<DedFile> },
+        { DtedFile::getFactoryName(),     base::FactoryTable::make<DtedFile> },
+        { SrtmHgtFile::getFactoryName(),  base::FactoryTable::make<SrtmHgtFile> },
+    };
+    return table.create(name);
 }
 
 }